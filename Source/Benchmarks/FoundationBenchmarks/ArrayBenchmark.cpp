@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include "Foundation/Containers/Array.h"
+#include "Foundation/Containers/SmallArray.h"
+#include "Foundation/String/String.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    void BM_ArrayPushBackInt(benchmark::State& state)
+    {
+        Int64 count = state.range(0);
+
+        for (auto _ : state)
+        {
+            Array<int> array;
+            for (Int64 i = 0; i < count; ++i)
+                array.PushBack(static_cast<int>(i));
+
+            benchmark::DoNotOptimize(array.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    void BM_ArrayPushBackString(benchmark::State& state)
+    {
+        Int64 count = state.range(0);
+        String value = "A string long enough to not fit in the small buffer.";
+
+        for (auto _ : state)
+        {
+            Array<String> array;
+            for (Int64 i = 0; i < count; ++i)
+                array.PushBack(value);
+
+            benchmark::DoNotOptimize(array.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    void BM_ArrayInsertFront(benchmark::State& state)
+    {
+        Int64 count = state.range(0);
+
+        for (auto _ : state)
+        {
+            Array<int> array;
+            for (Int64 i = 0; i < count; ++i)
+                array.Insert(array.GetBegin(), static_cast<int>(i));
+
+            benchmark::DoNotOptimize(array.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    void BM_ArrayInsertMiddle(benchmark::State& state)
+    {
+        Int64 count = state.range(0);
+
+        for (auto _ : state)
+        {
+            Array<String> array;
+            for (Int64 i = 0; i < count; ++i)
+                array.Insert(array.GetBegin() + array.Size() / 2, "Short");
+
+            benchmark::DoNotOptimize(array.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template<Usize N>
+    void BM_SmallArrayPushBack(benchmark::State& state)
+    {
+        Int64 count = state.range(0);
+
+        for (auto _ : state)
+        {
+            SmallArray<int, N> array;
+            for (Int64 i = 0; i < count; ++i)
+                array.PushBack(static_cast<int>(i));
+
+            benchmark::DoNotOptimize(array.Data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+}
+
+BENCHMARK(BM_ArrayPushBackInt)->RangeMultiplier(8)->Range(8, 64 * 1024);
+BENCHMARK(BM_ArrayPushBackString)->RangeMultiplier(8)->Range(8, 8 * 1024);
+BENCHMARK(BM_ArrayInsertFront)->RangeMultiplier(8)->Range(8, 4 * 1024);
+BENCHMARK(BM_ArrayInsertMiddle)->RangeMultiplier(8)->Range(8, 4 * 1024);
+BENCHMARK_TEMPLATE(BM_SmallArrayPushBack, 8)->Arg(4)->Arg(8)->Arg(64);
@@ -0,0 +1,30 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "Foundation/Memory/Memory.h"
+
+using namespace Kitsune;
+
+// Same memory backend as the engine, without pulling in the application layer: CMalloc, or
+// the thread-caching one with KITSUNE_MEMORY_BACKEND=threadcaching. Pass
+// --benchmark_out=<file> --benchmark_out_format=json for machine readable results.
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    const char* backend = std::getenv("KITSUNE_MEMORY_BACKEND");
+    bool threadCaching = (backend != nullptr) && (std::strcmp(backend, "threadcaching") == 0);
+
+    Memory::InitializeExplicit(threadCaching ? MemoryBackend::ThreadCaching : MemoryBackend::CMalloc);
+    benchmark::AddCustomContext("memory_backend", threadCaching ? "threadcaching" : "cmalloc");
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    Memory::Shutdown();
+    return 0;
+}
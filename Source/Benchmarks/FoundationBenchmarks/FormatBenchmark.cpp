@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include "Foundation/String/Format.h"
+#include "Foundation/Memory/LinearAllocator.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    void BM_FormatLiteral(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            String formatted = Format("Nothing to replace in here.");
+            benchmark::DoNotOptimize(formatted.Data());
+        }
+    }
+
+    void BM_FormatIntegers(benchmark::State& state)
+    {
+        int value = 0;
+
+        for (auto _ : state)
+        {
+            String formatted = Format("{0}, {1}, {2}", value, value * 31, -value);
+            benchmark::DoNotOptimize(formatted.Data());
+
+            ++value;
+        }
+    }
+
+    // Same as above, but scanned on every call instead of at compile time.
+    void BM_FormatIntegersRuntime(benchmark::State& state)
+    {
+        int value = 0;
+
+        for (auto _ : state)
+        {
+            String formatted = Format(RuntimeFormat("{0}, {1}, {2}"), value, value * 31, -value);
+            benchmark::DoNotOptimize(formatted.Data());
+
+            ++value;
+        }
+    }
+
+    void BM_FormatFloats(benchmark::State& state)
+    {
+        double value = 0.1;
+
+        for (auto _ : state)
+        {
+            String formatted = Format("{0} {1:.3f}", value, value * 1e6);
+            benchmark::DoNotOptimize(formatted.Data());
+
+            value += 0.37;
+        }
+    }
+
+    void BM_FormatStrings(benchmark::State& state)
+    {
+        StringView name = "Kitsune";
+        String message = "A string long enough to not fit in the small buffer.";
+
+        for (auto _ : state)
+        {
+            String formatted = Format("[{0}] {1} ({2})", name, message, true);
+            benchmark::DoNotOptimize(formatted.Data());
+        }
+    }
+
+    void BM_FormatToN(benchmark::State& state)
+    {
+        char buffer[128];
+        int value = 0;
+
+        for (auto _ : state)
+        {
+            auto result = FormatToN(buffer, sizeof(buffer), "[{0}] {1}: {2}", "Renderer", "Frame", value++);
+            benchmark::DoNotOptimize(result.Out);
+        }
+    }
+
+    void BM_FormatIntoArena(benchmark::State& state)
+    {
+        LinearArena arena;
+        int value = 0;
+
+        for (auto _ : state)
+        {
+            BasicString<char, LinearAllocator> formatted =
+                Format(LinearAllocator(arena), "{0}: {1}", "Frame", value++);
+
+            benchmark::DoNotOptimize(formatted.Data());
+            arena.Reset();
+        }
+    }
+}
+
+BENCHMARK(BM_FormatLiteral);
+BENCHMARK(BM_FormatIntegers);
+BENCHMARK(BM_FormatIntegersRuntime);
+BENCHMARK(BM_FormatFloats);
+BENCHMARK(BM_FormatStrings);
+BENCHMARK(BM_FormatToN);
+BENCHMARK(BM_FormatIntoArena);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include "Foundation/Logging/Logger.h"
+#include "Foundation/Logging/AsyncLogSink.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    // Measures the logger itself, not whatever the sink ends up writing to.
+    class NullSink : public ILogSink
+    {
+    public:
+        void Log(const LogMessage& message) override
+        {
+            benchmark::DoNotOptimize(message.Message.Data());
+        }
+    };
+
+    void BM_LoggerLog(benchmark::State& state)
+    {
+        Logger logger("Benchmark", MakeShared<NullSink>());
+
+        for (auto _ : state)
+            logger.Log(LogSeverity::Info, "A message of a fairly usual length.");
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LoggerLogFormat(benchmark::State& state)
+    {
+        Logger logger("Benchmark", MakeShared<NullSink>());
+        int frame = 0;
+
+        for (auto _ : state)
+            logger.LogFormat(LogSeverity::Info, SourceLocation(), "Frame {0} took {1}ms.", frame++, 16);
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // What the thread that logs pays, the sink gets called on the worker.
+    void BM_AsyncLoggerLog(benchmark::State& state)
+    {
+        Logger logger("Benchmark", MakeShared<AsyncLogSink>(MakeShared<NullSink>()));
+
+        for (auto _ : state)
+            logger.Log(LogSeverity::Info, "A message of a fairly usual length.");
+
+        logger.Flush();
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LoggerFiltered(benchmark::State& state)
+    {
+        Logger logger("Benchmark", MakeShared<NullSink>());
+        logger.SetMinimumSeverity(LogSeverity::Error);
+
+        for (auto _ : state)
+            logger.Log(LogSeverity::Info, "Dropped before reaching any sink.");
+
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(BM_LoggerLog);
+BENCHMARK(BM_LoggerLogFormat);
+BENCHMARK(BM_AsyncLoggerLog);
+BENCHMARK(BM_LoggerFiltered);
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include "Foundation/Common/Types.h"
+
+#include "Foundation/Memory/Memory.h"
+#include "Foundation/Memory/IMemoryApi.h"
+#include "Foundation/Memory/CMallocApi.h"
+#include "Foundation/Memory/ThreadCachingMemoryApi.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    constexpr Usize s_LiveBlocks = 256;
+
+    // Mostly small Array/String-sized requests, with the odd larger one in between.
+    Usize NextSize(Uint32& state)
+    {
+        state = state * 1664525u + 1013904223u;
+
+        Uint32 bucket = (state >> 24) & 0xFF;
+        if (bucket < 192) return 8 + ((state >> 8) % 120);
+        if (bucket < 248) return 128 + ((state >> 8) % 896);
+
+        return 1024 + ((state >> 8) % 7168);
+    }
+
+    // Keeps a window of live blocks around and replaces a random one every iteration, so
+    // the allocator sees a steady mix of sizes and lifetimes instead of LIFO pairs.
+    template<typename AllocateFunction, typename FreeFunction>
+    void RunChurn(benchmark::State& state, AllocateFunction&& allocate, FreeFunction&& free)
+    {
+        void* live[s_LiveBlocks] = {};
+        Uint32 seed = static_cast<Uint32>(state.thread_index()) * 7919 + 1;
+
+        for (auto _ : state)
+        {
+            Usize slot = (seed >> 4) % s_LiveBlocks;
+
+            free(live[slot]);
+            live[slot] = allocate(NextSize(seed));
+
+            // Touch it, an untouched block makes every allocator look great.
+            static_cast<volatile Uint8*>(live[slot])[0] = 1;
+        }
+
+        for (void* ptr : live)
+            free(ptr);
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template<typename Api>
+    void BM_MemoryApiChurn(benchmark::State& state)
+    {
+        // Shared by every thread of the run, like the process-wide API would be.
+        static Api api;
+
+        RunChurn(state, [](Usize bytes) { return api.TryAllocate(bytes, api.GetDefaultAlignment()); },
+                        [](void* ptr) { api.Free(ptr); });
+    }
+
+    void BM_MemoryChurn(benchmark::State& state)
+    {
+        RunChurn(state, [](Usize bytes) { return Memory::Allocate(bytes); },
+                        [](void* ptr) { Memory::Free(ptr); });
+    }
+
+    void BM_MemoryAllocateFree(benchmark::State& state)
+    {
+        Usize bytes = static_cast<Usize>(state.range(0));
+
+        for (auto _ : state)
+        {
+            void* ptr = Memory::Allocate(bytes);
+            benchmark::DoNotOptimize(ptr);
+
+            Memory::Free(ptr);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_MemoryApiChurn, CMallocApi)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MemoryApiChurn, ThreadCachingMemoryApi)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK(BM_MemoryChurn)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_MemoryAllocateFree)->RangeMultiplier(8)->Range(16, 64 * 1024);
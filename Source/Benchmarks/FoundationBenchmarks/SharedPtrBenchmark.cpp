@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include "Foundation/Memory/SharedPtr.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    void BM_MakeShared(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            SharedPtr<int> ptr = MakeShared<int>(5);
+            benchmark::DoNotOptimize(ptr.Get());
+        }
+    }
+
+    void BM_SharedPtrFromPointer(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            SharedPtr<int> ptr(new int(5));
+            benchmark::DoNotOptimize(ptr.Get());
+        }
+    }
+
+    // Every copy is a pair of atomic increments and decrements on the same control block,
+    // with more threads that becomes a contended cache line.
+    void BM_SharedPtrCopy(benchmark::State& state)
+    {
+        static SharedPtr<int> shared = MakeShared<int>(5);
+
+        for (auto _ : state)
+        {
+            SharedPtr<int> copy = shared;
+            benchmark::DoNotOptimize(copy.Get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_WeakPtrLock(benchmark::State& state)
+    {
+        static SharedPtr<int> shared = MakeShared<int>(5);
+        WeakPtr<int> weak = shared;
+
+        for (auto _ : state)
+        {
+            SharedPtr<int> locked = weak.Lock();
+            benchmark::DoNotOptimize(locked.Get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(BM_MakeShared);
+BENCHMARK(BM_SharedPtrFromPointer);
+BENCHMARK(BM_SharedPtrCopy)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_WeakPtrLock)->ThreadRange(1, 8)->UseRealTime();
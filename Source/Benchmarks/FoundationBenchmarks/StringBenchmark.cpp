@@ -0,0 +1,368 @@
+#include <benchmark/benchmark.h>
+
+#include "Foundation/String/Name.h"
+#include "Foundation/String/String.h"
+#include "Foundation/String/CharTraits.h"
+#include "Foundation/String/FromChars.h"
+#include "Foundation/String/SharedString.h"
+#include "Foundation/String/StringBuilder.h"
+#include "Foundation/String/ToChars.h"
+#include "Foundation/String/Unicode.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    void BM_StringAppend(benchmark::State& state)
+    {
+        Int64 count = state.range(0);
+
+        for (auto _ : state)
+        {
+            String string;
+            for (Int64 i = 0; i < count; ++i)
+                string.Append("Hello, ");
+
+            benchmark::DoNotOptimize(string.Data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * count * 7);
+    }
+
+    // Same text as BM_StringAppend, flattened into a String at the end or not at all.
+    void BM_StringBuilderAppend(benchmark::State& state, bool flatten)
+    {
+        Int64 count = state.range(0);
+
+        for (auto _ : state)
+        {
+            StringBuilder builder;
+            for (Int64 i = 0; i < count; ++i)
+                builder.Append("Hello, ");
+
+            if (flatten)
+                benchmark::DoNotOptimize(builder.ToString().Data());
+            else
+                benchmark::DoNotOptimize(builder.Size());
+        }
+
+        state.SetBytesProcessed(state.iterations() * count * 7);
+    }
+
+    void BM_StringAppendChar(benchmark::State& state)
+    {
+        Int64 count = state.range(0);
+
+        for (auto _ : state)
+        {
+            String string;
+            for (Int64 i = 0; i < count; ++i)
+                string += 'a';
+
+            benchmark::DoNotOptimize(string.Data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * count);
+    }
+
+    void BM_StringCopy(benchmark::State& state)
+    {
+        String source(static_cast<Usize>(state.range(0)), 'a');
+
+        for (auto _ : state)
+        {
+            String copy = source;
+            benchmark::DoNotOptimize(copy.Data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_SharedStringCopy(benchmark::State& state)
+    {
+        SharedString source(String(static_cast<Usize>(state.range(0)), 'a'));
+
+        for (auto _ : state)
+        {
+            SharedString copy = source;
+            benchmark::DoNotOptimize(copy.Data());
+        }
+    }
+
+    template<typename T>
+    void BM_CharTraitsLength(benchmark::State& state)
+    {
+        BasicString<T> string(static_cast<Usize>(state.range(0)), T('a'));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(CharTraits<T>::Length(string.Data()));
+
+        state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+    }
+
+    template<typename T>
+    void BM_CharTraitsCompare(benchmark::State& state)
+    {
+        Usize size = static_cast<Usize>(state.range(0));
+        BasicString<T> string1(size, T('a'));
+        BasicString<T> string2(size, T('a'));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(CharTraits<T>::Compare(string1.Data(), string2.Data(), size));
+
+        state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+    }
+
+    template<typename T>
+    void BM_CharTraitsFind(benchmark::State& state)
+    {
+        Usize size = static_cast<Usize>(state.range(0));
+        BasicString<T> string(size, T('a'));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(CharTraits<T>::Find(string.Data(), size, T('b')));
+
+        state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+    }
+
+    // Log-like text with the needle only at the very end.
+    String MakeSearchHaystack(Usize size, StringView tail)
+    {
+        static constexpr char s_Line[] = "[2024-01-01 12:00:00] [Render] frame took 16.6ms, 1204 draws\n";
+
+        String haystack;
+        while (haystack.Size() + tail.Size() < size)
+            haystack.Append(s_Line, KITSUNE_MIN(sizeof(s_Line) - 1, size - tail.Size() - haystack.Size()));
+
+        haystack.Append(tail);
+        return haystack;
+    }
+
+    // Log text, one line and one word at a time.
+    void BM_StringViewSplit(benchmark::State& state)
+    {
+        String text = MakeSearchHaystack(static_cast<Usize>(state.range(0)), "");
+
+        for (auto _ : state)
+        {
+            Usize words = 0;
+            for (StringView line : StringView(text).Lines())
+            {
+                for (StringView word : line.Split(' '))
+                    words += !word.IsEmpty();
+            }
+
+            benchmark::DoNotOptimize(words);
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_StringViewFind(benchmark::State& state)
+    {
+        StringView needle = "[Physics] step";
+        String haystack = MakeSearchHaystack(static_cast<Usize>(state.range(0)), needle);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(StringView(haystack).Find(needle));
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_StringViewFindLong(benchmark::State& state)
+    {
+        StringView needle = "[Physics] step took 2.0ms, 17 islands and 5004 contacts";
+        String haystack = MakeSearchHaystack(static_cast<Usize>(state.range(0)), needle);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(StringView(haystack).Find(needle));
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_StringViewFindAny(benchmark::State& state)
+    {
+        String haystack = MakeSearchHaystack(static_cast<Usize>(state.range(0)), "#");
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(StringView(haystack).FindAny("#;={}"));
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    // Log lines in English, or the same with a word of two and three byte characters (and
+    // the odd emoji) thrown in every few words.
+    String MakeUnicodeText(Usize size, bool ascii)
+    {
+        const char* words[] =
+        {
+            "window ", "resized ", "to ", "1920x1080 ", "\xC3\xA9t\xC3\xA9 ", "\xE7\x8B\x90 ", "\xF0\x9F\xA6\x8A "
+        };
+
+        String text;
+        for (Usize i = 0; text.Size() < size; ++i)
+        {
+            const char* word = words[ascii ? (i % 4) : (i % 7)];
+            text.Append(word, KITSUNE_MIN(CharTraits<char>::Length(word), size - text.Size()));
+        }
+
+        // Don't leave a character cut in half at the end.
+        return String(text.Data(), Internal::CompleteUnicodePrefix(text.Data(), text.Size()));
+    }
+
+    void BM_IsValidUtf8(benchmark::State& state, bool ascii)
+    {
+        String text = MakeUnicodeText(static_cast<Usize>(state.range(0)), ascii);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(IsValidUnicode(StringView(text)));
+
+        state.SetBytesProcessed(state.iterations() * static_cast<Int64>(text.Size()));
+    }
+
+    void BM_ConvertUtf8ToUtf16(benchmark::State& state, bool ascii)
+    {
+        String text = MakeUnicodeText(static_cast<Usize>(state.range(0)), ascii);
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(ConvertString<char16_t>(text));
+
+        state.SetBytesProcessed(state.iterations() * static_cast<Int64>(text.Size()));
+    }
+
+    void BM_ConvertUtf16ToUtf8(benchmark::State& state, bool ascii)
+    {
+        U16String text = ConvertString<char16_t>(MakeUnicodeText(static_cast<Usize>(state.range(0)), ascii));
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(ConvertString<char>(text));
+
+        state.SetBytesProcessed(state.iterations() * static_cast<Int64>(text.Size() * sizeof(char16_t)));
+    }
+
+    // Strings that are already in the table, which is what almost every lookup ends up being.
+    void BM_NameLookup(benchmark::State& state)
+    {
+        static const String names[] = { "Renderer", "AudioMixer", "AssetStreaming", "Physics.Broadphase" };
+        for (const String& name : names)
+            benchmark::DoNotOptimize(Name(StringView(name)));
+
+        Usize i = 0;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(Name(StringView(names[i++ % 4])));
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_NameEquals(benchmark::State& state)
+    {
+        Name name1("Physics.Broadphase");
+        Name name2("Physics.Broadphase");
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(name1);
+            benchmark::DoNotOptimize(name1 == name2);
+        }
+    }
+
+    void BM_StringEquals(benchmark::State& state)
+    {
+        String string1 = "Physics.Broadphase";
+        String string2 = "Physics.Broadphase";
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(string1);
+            benchmark::DoNotOptimize(StringView(string1) == StringView(string2));
+        }
+    }
+
+    // Space separated numbers, like a large data file.
+    String MakeNumberText(bool floats)
+    {
+        String text;
+        Uint64 state = 0x9E3779B97F4A7C15ull;
+
+        for (Usize i = 0; i < 10000; ++i)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+
+            char buffer[MaxFloatChars];
+            char* end = floats ? FloatToChars(buffer, static_cast<double>(state >> 11) * 0x1.0p-40)
+                               : IntegerToChars(buffer, static_cast<Int64>(state) >> (state % 48));
+
+            text.Append(buffer, static_cast<Usize>(end - buffer));
+            text.PushBack(' ');
+        }
+
+        return text;
+    }
+
+    void BM_ParseInt(benchmark::State& state)
+    {
+        String text = MakeNumberText(false);
+
+        for (auto _ : state)
+        {
+            Int64 sum = 0;
+            for (StringView number : StringView(text).Split(' '))
+                sum += ParseInt<Int64>(number).Value;
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<Int64>(text.Size()));
+    }
+
+    void BM_ParseFloat(benchmark::State& state)
+    {
+        String text = MakeNumberText(true);
+
+        for (auto _ : state)
+        {
+            double sum = 0.0;
+            for (StringView number : StringView(text).Split(' '))
+                sum += ParseFloat<double>(number).Value;
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<Int64>(text.Size()));
+    }
+}
+
+BENCHMARK(BM_StringAppend)->RangeMultiplier(8)->Range(1, 4 * 1024);
+BENCHMARK(BM_StringAppend)->Arg(256 * 1024);    // A couple of megabytes, like a large report.
+BENCHMARK_CAPTURE(BM_StringBuilderAppend, Chunks, false)->RangeMultiplier(8)->Range(1, 256 * 1024);
+BENCHMARK_CAPTURE(BM_StringBuilderAppend, ToString, true)->RangeMultiplier(8)->Range(1, 256 * 1024);
+BENCHMARK(BM_StringAppendChar)->RangeMultiplier(8)->Range(8, 32 * 1024);
+BENCHMARK(BM_StringCopy)->RangeMultiplier(8)->Range(8, 32 * 1024);
+BENCHMARK(BM_StringCopy)->Arg(20);            // Identifier sized, fits the small buffer on 64-bit.
+BENCHMARK(BM_SharedStringCopy)->RangeMultiplier(8)->Range(8, 32 * 1024);
+
+BENCHMARK_TEMPLATE(BM_CharTraitsLength, char)->RangeMultiplier(8)->Range(8, 64 * 1024);
+BENCHMARK_TEMPLATE(BM_CharTraitsLength, char16_t)->RangeMultiplier(8)->Range(8, 64 * 1024);
+BENCHMARK_TEMPLATE(BM_CharTraitsCompare, char)->RangeMultiplier(8)->Range(8, 64 * 1024);
+BENCHMARK_TEMPLATE(BM_CharTraitsCompare, char16_t)->RangeMultiplier(8)->Range(8, 64 * 1024);
+BENCHMARK_TEMPLATE(BM_CharTraitsFind, char)->RangeMultiplier(8)->Range(8, 64 * 1024);
+BENCHMARK_TEMPLATE(BM_CharTraitsFind, char16_t)->RangeMultiplier(8)->Range(8, 64 * 1024);
+
+BENCHMARK(BM_StringViewSplit)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK(BM_StringViewFind)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK(BM_StringViewFindLong)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK(BM_StringViewFindAny)->RangeMultiplier(8)->Range(64, 64 * 1024);
+
+BENCHMARK_CAPTURE(BM_IsValidUtf8, Ascii, true)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_IsValidUtf8, Mixed, false)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_ConvertUtf8ToUtf16, Ascii, true)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_ConvertUtf8ToUtf16, Mixed, false)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_ConvertUtf16ToUtf8, Ascii, true)->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK_CAPTURE(BM_ConvertUtf16ToUtf8, Mixed, false)->RangeMultiplier(8)->Range(64, 64 * 1024);
+
+BENCHMARK(BM_NameLookup)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_NameEquals);
+BENCHMARK(BM_StringEquals);
+
+BENCHMARK(BM_ParseInt);
+BENCHMARK(BM_ParseFloat);
@@ -51,6 +51,8 @@ namespace Kitsune
 
     void Application::Update()
     {
+        m_FrameArena.Reset();
+
         m_PlatformImpl->PollEvents();
         OnUpdate();
     }
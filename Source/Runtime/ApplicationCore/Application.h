@@ -1,7 +1,8 @@
 #pragma once
 
-#include "Foundation/String/String.h"
+#include "Foundation/String/SharedString.h"
 #include "Foundation/Memory/ScopedPtr.h"
+#include "Foundation/Memory/LinearAllocator.h"
 
 #include "ApplicationCore/IWindow.h"
 #include "ApplicationCore/IPlatformApplication.h"
@@ -16,7 +17,7 @@ namespace Kitsune
 {
     struct ApplicationSpecs
     {
-        String Name;
+        SharedString Name;
         Vector2<Uint32> ViewportSize = { 640, 480 };
 
         Vector2<Int32> WindowPosition;
@@ -47,6 +48,10 @@ namespace Kitsune
         inline SharedPtr<IWindow>  GetPrimaryWindow()  const { return m_PrimaryWindow; }
         inline SharedPtr<IMonitor> GetPrimaryMonitor() const { return m_PrimaryMonitor; }
 
+        // Scratch memory for the current frame only, everything allocated through
+        // it gets thrown away at the start of the next Update().
+        inline LinearAllocator GetFrameAllocator() { return LinearAllocator(m_FrameArena); }
+
     public:
         virtual void OnUpdate() { /* ... */ }
 
@@ -68,6 +73,8 @@ namespace Kitsune
 
         SharedPtr<IWindow> m_PrimaryWindow;
         SharedPtr<IMonitor> m_PrimaryMonitor;
+
+        LinearArena m_FrameArena;
     };
 
     // Should be defined in client code.
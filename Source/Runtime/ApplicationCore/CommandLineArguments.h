@@ -5,6 +5,7 @@
 
 #include "Foundation/String/String.h"
 #include "Foundation/Containers/Array.h"
+#include "Foundation/Containers/SmallArray.h"
 
 #include "Foundation/Diagnostics/OutOfRangeException.h"
 #include "Foundation/Diagnostics/InvalidArgumentException.h"
@@ -14,7 +15,9 @@ namespace Kitsune
     class CommandLineArguments
     {
     public:
-        using Iterator = Array<String>::ConstIterator;
+        // Enough for the handful of arguments most launches get.
+        using ArgumentArray = SmallArray<String, 8>;
+        using Iterator = ArgumentArray::ConstIterator;
 
     public:
         CommandLineArguments() = default;
@@ -32,13 +35,15 @@ namespace Kitsune
         }
 
         inline CommandLineArguments(const Array<String>& args)
-            : m_Arguments(args)
+            : m_Arguments(args.GetBegin(), args.GetEnd())
         {
         }
 
         inline CommandLineArguments(Array<String>&& args)
-            : m_Arguments(Move(args))
+            : m_Arguments(args.Size())
         {
+            for (String& arg : args)
+                m_Arguments.PushBack(Move(arg));
         }
 
     public:
@@ -60,6 +65,6 @@ namespace Kitsune
         inline Iterator end()   const { return GetEnd(); }
 
     private:
-        Array<String> m_Arguments;
+        ArgumentArray m_Arguments;
     };
 }
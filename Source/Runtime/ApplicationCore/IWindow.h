@@ -3,7 +3,7 @@
 #include "Foundation/Maths/Vector2.h"
 #include "Foundation/Maths/AABB.h"
 
-#include "Foundation/String/String.h"
+#include "Foundation/String/SharedString.h"
 #include "Foundation/Memory/SharedPtr.h"
 
 #include "ApplicationCore/VideoMode.h"
@@ -34,7 +34,7 @@ namespace Kitsune
         Vector2<Int32> Position;
         Vector2<Uint32> Size = { 640, 480 };
 
-        String Title;
+        SharedString Title;
         VideoMode VideoMode;
 
         WindowState WindowState = WindowState::Floating;
@@ -69,7 +69,7 @@ namespace Kitsune
 
     public:
         virtual void SetTitle(StringView title) = 0;
-        virtual String GetTitle() const = 0;
+        virtual SharedString GetTitle() const = 0;
 
     public:
         virtual void SetState(WindowState state) = 0;
@@ -24,7 +24,7 @@ namespace Kitsune
 
     public:
         void SetTitle(StringView title) override { m_Title = title; }
-        String GetTitle()         const override { return m_Title; }
+        SharedString GetTitle()   const override { return m_Title; }
 
     public:
         KITSUNE_API_ void SetState(WindowState state) override;
@@ -52,7 +52,7 @@ namespace Kitsune
         Vector2<Uint32> m_RestoreSize;
         Vector2<Int32> m_RestorePosition;
 
-        String m_Title;
+        SharedString m_Title;
         WindowState m_State;
 
         VideoMode m_VideoMode;
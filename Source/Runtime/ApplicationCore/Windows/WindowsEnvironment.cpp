@@ -3,7 +3,7 @@
 #include <cstdlib>
 #include <Windows.h>
 
-#include "Foundation/Windows/StringConversions.h"
+#include "Foundation/String/Unicode.h"
 
 namespace Kitsune
 {
@@ -31,7 +31,7 @@ namespace Kitsune
         Array<String> argv(argc);
         for (int i = 0; i < argc; ++i)
         {
-            argv.PushBack(Internal::WindowsConvertToUtf8(wargv[i]));
+            argv.PushBack(ConvertStringLossy<char>(wargv[i]));
         }
 
        ::LocalFree(wargv);
@@ -1,5 +1,5 @@
 #include "ApplicationCore/Windows/WindowsMonitor.h"
-#include "Foundation/Windows/StringConversions.h"
+#include "Foundation/String/Unicode.h"
 
 #include "ApplicationCore/BadMonitorCreationException.h"
 
@@ -8,7 +8,7 @@ namespace Kitsune
     WindowsMonitor::WindowsMonitor(LPDISPLAY_DEVICEW adapterDevice,
                                    LPDISPLAY_DEVICEW monitorDevice)
     {
-        m_MonitorString = Internal::WindowsConvertToUtf8(monitorDevice->DeviceString);
+        m_MonitorString = ConvertStringLossy<char>(monitorDevice->DeviceString);
         m_AdapterName = adapterDevice->DeviceName;
     }
 
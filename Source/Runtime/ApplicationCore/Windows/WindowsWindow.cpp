@@ -1,5 +1,5 @@
 #include "ApplicationCore/Windows/WindowsWindow.h"
-#include "Foundation/Windows/StringConversions.h"
+#include "Foundation/String/Unicode.h"
 
 #include "ApplicationCore/IWindow.h"
 #include "ApplicationCore/Application.h"
@@ -14,7 +14,7 @@ namespace Kitsune
     Uint32 WindowsWindow::s_WindowCount = 0;
 
     WindowsWindow::WindowsWindow(const WindowProperties& props)
-        : m_Application(Application::GetInstance())
+        : m_Application(Application::GetInstance()), m_Title(props.Title)
     {
         KITSUNE_ASSERT(m_Application != nullptr, "Application has not been instanced.");
 
@@ -24,7 +24,7 @@ namespace Kitsune
 
         DWORD exStyle = GetExtendedWindowStyles();
         DWORD style = GetWindowStyles();
-        WideString wideTitle = Internal::WindowsConvertToUtf16(props.Title);
+        WideString wideTitle = ConvertStringLossy<wchar_t>(props.Title.ToStringView());
 
         Vector2<Int32> pos;
         Vector2<Uint32> size;
@@ -141,7 +141,7 @@ namespace Kitsune
 
     void WindowsWindow::SetTitle(StringView title)
     {
-        WideString wideTitle = Internal::WindowsConvertToUtf16(title);
+        WideString wideTitle = ConvertStringLossy<wchar_t>(title);
         ::SetWindowTextW(m_NativeHandle, wideTitle.Raw());
 
         m_Title = title;
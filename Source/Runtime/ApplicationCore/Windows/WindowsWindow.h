@@ -24,7 +24,7 @@ namespace Kitsune
         KITSUNE_API_ AABB2<Int32> GetFrameBoundingBox() const override;
 
         KITSUNE_API_ void SetTitle(StringView title) override;
-        inline String GetTitle() const override { return m_Title; }
+        inline SharedString GetTitle() const override { return m_Title; }
 
     public:
         KITSUNE_API_ void SetState(WindowState state) override;
@@ -55,7 +55,7 @@ namespace Kitsune
         HWND m_NativeHandle;
         Application* m_Application;
 
-        String m_Title;
+        SharedString m_Title;
         VideoMode m_VideoMode;
 
         WindowState m_State;
@@ -1,28 +1,74 @@
 #pragma once
 
+#include <cstring>
+#include <type_traits>
+
+#include "Foundation/Common/Macros.h"
 #include "Foundation/Iterators/Iterator.h"
 #include "Foundation/Iterators/IteratorTraits.h"
 
+namespace Kitsune::Internal
+{
+    // Pointer ranges going into a bulk writer or into more memory of the same type don't
+    // have to be copied one element at a time.
+    template<typename It, typename OutIt>
+    concept CopiesContiguously =
+        std::is_pointer_v<It> &&
+        (BulkWritableIterator<OutIt, std::remove_cv_t<std::remove_pointer_t<It>>> ||
+         (std::is_pointer_v<OutIt> &&
+          std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, std::remove_pointer_t<OutIt>> &&
+          std::is_trivially_copyable_v<std::remove_pointer_t<OutIt>>));
+
+    template<typename It, typename OutIt>
+    KITSUNE_FORCEINLINE OutIt CopyContiguous(It begin, Usize count, OutIt outBegin)
+    {
+        if constexpr (std::is_pointer_v<OutIt>)
+        {
+            if (count != 0)
+                std::memmove(outBegin, begin, count * sizeof(*begin));
+
+            return outBegin + count;
+        }
+        else
+        {
+            if (count != 0)
+                outBegin.Write(begin, count);
+
+            return outBegin;
+        }
+    }
+}
+
 namespace Kitsune::Algorithms
 {
     template<ForwardIterator It,
              WritableIterator<typename IteratorTraits<It>::ValueType> OutIt>
     OutIt Copy(It begin, It end, OutIt outBegin)
     {
-        for (; begin != end; ++begin, ++outBegin)
-            *outBegin = *begin;
+        if constexpr (Internal::CopiesContiguously<It, OutIt>)
+            return Internal::CopyContiguous(begin, static_cast<Usize>(end - begin), outBegin);
+        else
+        {
+            for (; begin != end; ++begin, ++outBegin)
+                *outBegin = *begin;
 
-        return outBegin;
+            return outBegin;
+        }
     }
 
     template<ForwardIterator It, typename Sz,
              WritableIterator<typename IteratorTraits<It>::ValueType> OutIt>
     OutIt CopyN(It begin, Sz n, OutIt outBegin)
     {
-        for (; n > 0; ++begin, ++outBegin, --n)
-            *outBegin = *begin;
+        if constexpr (Internal::CopiesContiguously<It, OutIt>)
+            return Internal::CopyContiguous(begin, (n > 0) ? static_cast<Usize>(n) : 0, outBegin);
+        else
+        {
+            for (; n > 0; ++begin, ++outBegin, --n)
+                *outBegin = *begin;
 
-        return outBegin;
+            return outBegin;
+        }
     }
 
     template<ForwardIterator It,
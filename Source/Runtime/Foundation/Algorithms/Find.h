@@ -1,10 +1,27 @@
 #pragma once
 
+#include <type_traits>
+
 #include "Foundation/Iterators/IteratorTraits.h"
 #include "Foundation/Iterators/Iterator.h"
 
+#include "Foundation/Concepts/Character.h"
+#include "Foundation/String/StringSearch.h"
+
 #include "Foundation/Algorithms/Equal.h"
 
+namespace Kitsune::Internal
+{
+    // Both ranges are plain arrays of the same character type, Internal::FindSubstring()
+    // can take them.
+    template<typename It1, typename It2>
+    concept SearchableCharacterRanges =
+        std::is_pointer_v<It1> && std::is_pointer_v<It2> &&
+        Character<std::remove_cv_t<std::remove_pointer_t<It1>>> &&
+        std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It1>>,
+                       std::remove_cv_t<std::remove_pointer_t<It2>>>;
+}
+
 namespace Kitsune::Algorithms
 {
     template<ForwardIterator It, typename T>
@@ -20,20 +37,33 @@ namespace Kitsune::Algorithms
     template<ForwardIterator It1, ForwardIterator It2>
     [[nodiscard]] It1 Find(It1 begin, It1 end, It2 findBegin, It2 findEnd)
     {
-        // Thanks MSVC.
-        while (true)
+        if constexpr (Internal::SearchableCharacterRanges<It1, It2>)
         {
-            It1 it = begin;
-            for (It2 fit = findBegin; ; ++it, ++fit)
+            if (findBegin == findEnd)
+                return begin;
+
+            auto found = Internal::FindSubstring(begin, static_cast<Usize>(end - begin),
+                                                 findBegin, static_cast<Usize>(findEnd - findBegin));
+
+            return (found != nullptr) ? begin + (found - begin) : end;
+        }
+        else
+        {
+            // Thanks MSVC.
+            while (true)
             {
-                if (fit == findEnd) return begin;
-                if (it == end) return it;
+                It1 it = begin;
+                for (It2 fit = findBegin; ; ++it, ++fit)
+                {
+                    if (fit == findEnd) return begin;
+                    if (it == end) return it;
 
-                if (*it != *fit)
-                    break;
-            }
+                    if (*it != *fit)
+                        break;
+                }
 
-            ++begin;
+                ++begin;
+            }
         }
     }
 
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstring>
+#include <type_traits>
+
 #include "Foundation/Common/Types.h"
 #include "Foundation/Templates/Move.h"
+#include "Foundation/Templates/IsTriviallyRelocatable.h"
 
 #include "Foundation/Memory/Memory.h"
 #include "Foundation/Memory/AddressOf.h"
@@ -15,16 +19,17 @@ namespace Kitsune::Algorithms
     OutputIt UninitializedCopy(InputIt begin, InputIt end, OutputIt outBegin)
     {
         InputIt it = begin;
+        OutputIt out = outBegin;
         try
         {
-            for (; it != end; ++it, ++outBegin)
-                Memory::ConstructAt(AddressOf(*outBegin), *it);
+            for (; it != end; ++it, ++out)
+                Memory::ConstructAt(AddressOf(*out), *it);
 
-            return outBegin;
+            return out;
         }
         catch (...)
         {
-            Algorithms::Destroy(begin, it);
+            Algorithms::Destroy(outBegin, out);
             throw;
         }
     }
@@ -33,16 +38,17 @@ namespace Kitsune::Algorithms
     OutputIt UninitializedCopyN(InputIt begin, Usize n, OutputIt outBegin)
     {
         InputIt it = begin;
+        OutputIt out = outBegin;
         try
         {
-            for (; n > 0; ++it, --n, ++outBegin)
-                Memory::ConstructAt(AddressOf(*outBegin), *it);
+            for (; n > 0; ++it, --n, ++out)
+                Memory::ConstructAt(AddressOf(*out), *it);
 
-            return outBegin;
+            return out;
         }
         catch (...)
         {
-            Algorithms::Destroy(begin, it);
+            Algorithms::Destroy(outBegin, out);
             throw;
         }
     }
@@ -51,16 +57,17 @@ namespace Kitsune::Algorithms
     OutputIt UninitializedMove(InputIt begin, InputIt end, OutputIt outBegin)
     {
         InputIt it = begin;
+        OutputIt out = outBegin;
         try
         {
-            for (; it != end; ++it, ++outBegin)
-                Memory::ConstructAt(AddressOf(*outBegin), Move(*it));
+            for (; it != end; ++it, ++out)
+                Memory::ConstructAt(AddressOf(*out), Move(*it));
 
-            return outBegin;
+            return out;
         }
         catch (...)
         {
-            Algorithms::Destroy(begin, it);
+            Algorithms::Destroy(outBegin, out);
             throw;
         }
     }
@@ -69,16 +76,17 @@ namespace Kitsune::Algorithms
     OutputIt UninitializedMoveN(InputIt begin, Usize n, OutputIt outBegin)
     {
         InputIt it = begin;
+        OutputIt out = outBegin;
         try
         {
-            for (; n > 0; ++it, --n, ++outBegin)
-                Memory::ConstructAt(AddressOf(*outBegin), Move(*it));
+            for (; n > 0; ++it, --n, ++out)
+                Memory::ConstructAt(AddressOf(*out), Move(*it));
 
-            return outBegin;
+            return out;
         }
         catch (...)
         {
-            Algorithms::Destroy(begin, it);
+            Algorithms::Destroy(outBegin, out);
             throw;
         }
     }
@@ -116,4 +124,77 @@ namespace Kitsune::Algorithms
             throw;
         }
     }
+
+    // Whether relocating a T one element at a time can't be interrupted by an exception.
+    template<typename T>
+    inline constexpr bool IsNothrowRelocatable = IsTriviallyRelocatable<T> ||
+                                                 std::is_nothrow_move_constructible_v<T>;
+
+    // Moves [begin, end) into the uninitialized memory at `outBegin`, leaving the source range
+    // uninitialized. The ranges may overlap as long as `outBegin` comes before `begin`.
+    //
+    // Unless IsNothrowRelocatable<T>, every element gets moved before any of them is destroyed,
+    // so the source is left untouched if a move constructor throws. The ranges can't overlap then.
+    template<typename T>
+    T* UninitializedRelocate(T* begin, T* end, T* outBegin)
+    {
+        if constexpr (IsTriviallyRelocatable<T>)
+        {
+            Usize count = static_cast<Usize>(end - begin);
+            if (count != 0)
+                std::memmove(static_cast<void*>(outBegin), static_cast<const void*>(begin), count * sizeof(T));
+
+            return outBegin + count;
+        }
+        else if constexpr (IsNothrowRelocatable<T>)
+        {
+            for (; begin != end; ++begin, ++outBegin)
+            {
+                Memory::ConstructAt(outBegin, Move(*begin));
+                Memory::DestroyAt(begin);
+            }
+
+            return outBegin;
+        }
+        else
+        {
+            T* outEnd = Algorithms::UninitializedMove(begin, end, outBegin);
+            Algorithms::Destroy(begin, end);
+
+            return outEnd;
+        }
+    }
+
+    // Same as UninitializedRelocate(), but goes from the back so that `outEnd` may come after `end`.
+    // The ranges can only overlap if IsNothrowRelocatable<T>.
+    template<typename T>
+    T* UninitializedRelocateBackward(T* begin, T* end, T* outEnd)
+    {
+        if constexpr (IsTriviallyRelocatable<T>)
+        {
+            Usize count = static_cast<Usize>(end - begin);
+            if (count != 0)
+                std::memmove(static_cast<void*>(outEnd - count), static_cast<const void*>(begin), count * sizeof(T));
+
+            return outEnd - count;
+        }
+        else if constexpr (IsNothrowRelocatable<T>)
+        {
+            while (end != begin)
+            {
+                Memory::ConstructAt(--outEnd, Move(*--end));
+                Memory::DestroyAt(end);
+            }
+
+            return outEnd;
+        }
+        else
+        {
+            T* outBegin = outEnd - (end - begin);
+            Algorithms::UninitializedMove(begin, end, outBegin);
+            Algorithms::Destroy(begin, end);
+
+            return outBegin;
+        }
+    }
 }
@@ -0,0 +1,86 @@
+#include "Foundation/Common/CpuFeatures.h"
+
+#if defined(KITSUNE_ARCH_X86)
+    #if defined(KITSUNE_COMPILER_MSVC)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace Kitsune
+{
+    namespace
+    {
+#if defined(KITSUNE_ARCH_X86)
+        struct CpuidRegisters
+        {
+            Uint32 Eax, Ebx, Ecx, Edx;
+        };
+
+        CpuidRegisters Cpuid(Uint32 leaf, Uint32 subleaf = 0)
+        {
+            CpuidRegisters regs = { 0, 0, 0, 0 };
+
+    #if defined(KITSUNE_COMPILER_MSVC)
+            int info[4];
+            __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+
+            regs = { static_cast<Uint32>(info[0]), static_cast<Uint32>(info[1]),
+                     static_cast<Uint32>(info[2]), static_cast<Uint32>(info[3]) };
+    #else
+            __cpuid_count(leaf, subleaf, regs.Eax, regs.Ebx, regs.Ecx, regs.Edx);
+    #endif
+
+            return regs;
+        }
+
+        Uint64 ReadXcr0()
+        {
+    #if defined(KITSUNE_COMPILER_MSVC)
+            return _xgetbv(0);
+    #else
+            // The intrinsic needs -mxsave, the instruction itself is fine once OSXSAVE is set.
+            Uint32 low, high;
+            __asm__ __volatile__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+
+            return (static_cast<Uint64>(high) << 32) | low;
+    #endif
+        }
+#endif
+
+        CpuFeatures DetectCpuFeatures()
+        {
+            CpuFeatures features;
+
+#if defined(KITSUNE_ARCH_X86)
+            Uint32 maxLeaf = Cpuid(0).Eax;
+            if (maxLeaf < 1)
+                return features;
+
+            CpuidRegisters leaf1 = Cpuid(1);
+            features.SSE2 = (leaf1.Edx & (1u << 26)) != 0;
+            features.SSE42 = (leaf1.Ecx & (1u << 20)) != 0;
+
+            bool osSavesYmm = false;
+            if ((leaf1.Ecx & (1u << 27)) != 0 && (leaf1.Ecx & (1u << 28)) != 0)
+                osSavesYmm = (ReadXcr0() & 0x6) == 0x6;     // XMM and YMM state.
+
+            if (maxLeaf >= 7 && osSavesYmm)
+                features.AVX2 = (Cpuid(7).Ebx & (1u << 5)) != 0;
+
+#elif defined(KITSUNE_ARCH_AARCH64) || defined(__ARM_NEON)
+            // Part of the base AArch64 ISA, 32-bit ARM only gets here if built for it.
+            features.NEON = true;
+#endif
+
+            return features;
+        }
+    }
+
+    const CpuFeatures& GetCpuFeatures()
+    {
+        static const CpuFeatures s_Features = DetectCpuFeatures();
+        return s_Features;
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+namespace Kitsune
+{
+    // Instruction set extensions the current CPU (and OS) can actually run, as opposed to the
+    // ones the compiler was told to target.
+    struct CpuFeatures
+    {
+        bool SSE2 = false;
+        bool SSE42 = false;
+        bool AVX2 = false;          // Only set if the OS saves the upper halves of YMM registers.
+
+        bool NEON = false;
+    };
+
+    // Detected once, on the first call.
+    [[nodiscard]] KITSUNE_API_ const CpuFeatures& GetCpuFeatures();
+}
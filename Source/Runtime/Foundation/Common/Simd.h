@@ -0,0 +1,157 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Predefined.h"
+
+// Intrinsics for the vector kernels, which pick what to run from GetCpuFeatures() at runtime
+// instead of relying on what the build targets.
+#if defined(KITSUNE_ARCH_X86)
+    #if defined(KITSUNE_COMPILER_MSVC)
+        #include <intrin.h>
+    #else
+        #include <immintrin.h>
+    #endif
+
+    #define KITSUNE_SIMD_X86 1
+#elif defined(KITSUNE_ARCH_AARCH64) || defined(__ARM_NEON)
+    #include <arm_neon.h>
+
+    #define KITSUNE_SIMD_NEON 1
+#endif
+
+// Lets a function use instructions the rest of the build doesn't assume are there, MSVC hands
+// out every intrinsic regardless.
+#if defined(KITSUNE_COMPILER_GCC) || defined(KITSUNE_COMPILER_CLANG)
+    #define KITSUNE_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define KITSUNE_TARGET(isa)
+#endif
+
+// For kernels that knowingly read past the end of a buffer, without leaving the page.
+#if defined(KITSUNE_COMPILER_GCC) || defined(KITSUNE_COMPILER_CLANG)
+    #define KITSUNE_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#elif defined(KITSUNE_COMPILER_MSVC)
+    #define KITSUNE_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+#else
+    #define KITSUNE_NO_SANITIZE_ADDRESS
+#endif
+
+namespace Kitsune::Internal
+{
+    // Lane-wise helpers for vectors of T, with T one of the character types. Comparisons turn
+    // into a mask with a bit per byte on x86 and a nibble per byte on NEON, a match in lane i
+    // sets every bit of that lane. Masking with the LaneBits<T> constants below leaves one bit
+    // per lane, for looping over all the matches.
+
+#if defined(KITSUNE_SIMD_X86)
+    template<typename T>
+    inline constexpr Uint32 s_X86LaneBits = (sizeof(T) == 1) ? 0xFFFFFFFFu :
+                                            (sizeof(T) == 2) ? 0x55555555u :
+                                                               0x11111111u;
+
+    template<typename T>
+    KITSUNE_TARGET("sse2") __m128i Sse2Broadcast(T ch)
+    {
+        if constexpr (sizeof(T) == 1)
+            return _mm_set1_epi8(static_cast<char>(ch));
+        else if constexpr (sizeof(T) == 2)
+            return _mm_set1_epi16(static_cast<short>(ch));
+        else
+            return _mm_set1_epi32(static_cast<int>(ch));
+    }
+
+    template<typename T>
+    KITSUNE_TARGET("sse2") __m128i Sse2Equal(__m128i x, __m128i y)
+    {
+        if constexpr (sizeof(T) == 1)
+            return _mm_cmpeq_epi8(x, y);
+        else if constexpr (sizeof(T) == 2)
+            return _mm_cmpeq_epi16(x, y);
+        else
+            return _mm_cmpeq_epi32(x, y);
+    }
+
+    template<typename T>
+    KITSUNE_TARGET("sse2") Uint32 Sse2EqualMask(__m128i x, __m128i y)
+    {
+        return static_cast<Uint32>(_mm_movemask_epi8(Sse2Equal<T>(x, y)));
+    }
+
+    template<typename T>
+    KITSUNE_TARGET("avx2") __m256i Avx2Broadcast(T ch)
+    {
+        if constexpr (sizeof(T) == 1)
+            return _mm256_set1_epi8(static_cast<char>(ch));
+        else if constexpr (sizeof(T) == 2)
+            return _mm256_set1_epi16(static_cast<short>(ch));
+        else
+            return _mm256_set1_epi32(static_cast<int>(ch));
+    }
+
+    template<typename T>
+    KITSUNE_TARGET("avx2") __m256i Avx2Equal(__m256i x, __m256i y)
+    {
+        if constexpr (sizeof(T) == 1)
+            return _mm256_cmpeq_epi8(x, y);
+        else if constexpr (sizeof(T) == 2)
+            return _mm256_cmpeq_epi16(x, y);
+        else
+            return _mm256_cmpeq_epi32(x, y);
+    }
+
+    template<typename T>
+    KITSUNE_TARGET("avx2") Uint32 Avx2EqualMask(__m256i x, __m256i y)
+    {
+        return static_cast<Uint32>(_mm256_movemask_epi8(Avx2Equal<T>(x, y)));
+    }
+#endif
+
+#if defined(KITSUNE_SIMD_NEON)
+    template<typename T>
+    inline constexpr Uint64 s_NeonLaneBits = (sizeof(T) == 1) ? 0x1111111111111111ull :
+                                             (sizeof(T) == 2) ? 0x0101010101010101ull :
+                                                                0x0001000100010001ull;
+
+    template<typename T>
+    uint8x16_t NeonBroadcast(T ch)
+    {
+        if constexpr (sizeof(T) == 1)
+            return vdupq_n_u8(static_cast<uint8_t>(ch));
+        else if constexpr (sizeof(T) == 2)
+            return vreinterpretq_u8_u16(vdupq_n_u16(static_cast<uint16_t>(ch)));
+        else
+            return vreinterpretq_u8_u32(vdupq_n_u32(static_cast<uint32_t>(ch)));
+    }
+
+    // NEON has no movemask, narrowing every 16-bit lane by 4 bits leaves a nibble per
+    // byte instead.
+    inline Uint64 NeonMask(uint8x16_t bytes)
+    {
+        uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(bytes), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+    }
+
+    template<typename T>
+    uint8x16_t NeonEqual(uint8x16_t x, uint8x16_t y)
+    {
+        if constexpr (sizeof(T) == 1)
+            return vceqq_u8(x, y);
+        else if constexpr (sizeof(T) == 2)
+            return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(x), vreinterpretq_u16_u8(y)));
+        else
+            return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(x), vreinterpretq_u32_u8(y)));
+    }
+
+    template<typename T>
+    Uint64 NeonEqualMask(uint8x16_t x, uint8x16_t y)
+    {
+        return NeonMask(NeonEqual<T>(x, y));
+    }
+
+    template<typename T>
+    uint8x16_t NeonLoad(const T* ptr)
+    {
+        return vld1q_u8(reinterpret_cast<const uint8_t*>(ptr));
+    }
+#endif
+}
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <type_traits>
 #include <initializer_list>
 
+#include "Foundation/Common/Macros.h"
+
 #include "Foundation/Memory/Allocator.h"
 #include "Foundation/Memory/GlobalAllocator.h"
 
 #include "Foundation/Templates/Exchange.h"
+#include "Foundation/Templates/IsTriviallyRelocatable.h"
 #include "Foundation/Iterators/Iterator.h"
 #include "Foundation/Iterators/ReverseIterator.h"
 #include "Foundation/Diagnostics/OutOfRangeException.h"
@@ -302,16 +306,33 @@ namespace Kitsune
             if ((begin < GetBegin()) || (begin >= GetEnd()) || (end < GetBegin()) || (end > GetEnd()))
                 throw OutOfRangeException();
 
-            Usize removedSize = static_cast<Usize>(Algorithms::Distance(begin, end));
             Algorithms::Destroy(begin, end);
 
-            for (auto it = end; it != GetEnd(); ++it, ++begin)
+            if constexpr (Algorithms::IsNothrowRelocatable<T>)
             {
-                Memory::ConstructAt(begin, Move(*it));
-                Memory::DestroyAt(it);
+                m_End = Algorithms::UninitializedRelocate(end, m_End, begin);
+            }
+            else
+            {
+                // The ranges overlap, so a throwing move leaves a gap. Drop whatever comes after it.
+                T* it = end;
+                try
+                {
+                    for (; it != m_End; ++it, ++begin)
+                    {
+                        Memory::ConstructAt(begin, Move(*it));
+                        Memory::DestroyAt(it);
+                    }
+                }
+                catch (...)
+                {
+                    Algorithms::Destroy(it, m_End);
+                    m_End = begin;
+                    throw;
+                }
+
+                m_End = begin;
             }
-
-            m_End -= removedSize;
         }
 
         inline void PushBack(const T& val) { EmplaceBack(val); }
@@ -370,10 +391,22 @@ namespace Kitsune
 
         inline void ReallocateGrowExact(Usize newCapacity)
         {
+            if (m_Begin != nullptr && TryReallocateInPlace(newCapacity))
+                return;
+
             T* ptr = static_cast<T*>(m_Allocator.Allocate(newCapacity * sizeof(T), alignof(T)));
-            T* end = Algorithms::UninitializedMove(m_Begin, m_End, ptr);
+            T* end;
+
+            try
+            {
+                end = Algorithms::UninitializedRelocate(m_Begin, m_End, ptr);
+            }
+            catch (...)
+            {
+                FreeAllocation(ptr);
+                throw;
+            }
 
-            Algorithms::Destroy(m_Begin, m_End);
             FreeAllocation(m_Begin);
 
             m_Begin = ptr;
@@ -381,6 +414,38 @@ namespace Kitsune
             m_StorageEnd = ptr + newCapacity;
         }
 
+        // Lets the allocator resize the block itself, saving a copy of every element when it
+        // can. Shrinking only goes through TryReallocate(), TryExpand() won't give memory back.
+        inline bool TryReallocateInPlace(Usize newCapacity)
+        {
+            if constexpr (ExpandableAllocator<Alloc>)
+            {
+                if (newCapacity > Capacity() && m_Allocator.TryExpand(m_Begin, newCapacity * sizeof(T)))
+                {
+                    m_StorageEnd = m_Begin + newCapacity;
+                    return true;
+                }
+            }
+
+            if constexpr (ReallocatableAllocator<Alloc> && IsTriviallyRelocatable<T>)
+            {
+                Usize size = Size();
+
+                T* ptr = static_cast<T*>(m_Allocator.TryReallocate(m_Begin, newCapacity * sizeof(T), alignof(T)));
+                if (ptr != nullptr)
+                {
+                    m_Begin = ptr;
+                    m_End = ptr + size;
+                    m_StorageEnd = ptr + newCapacity;
+
+                    return true;
+                }
+            }
+
+            KITSUNE_UNUSED(newCapacity);
+            return false;
+        }
+
     private:
         template<ForwardIterator It>
         void RangeAssign(It begin, It end)
@@ -401,20 +466,39 @@ namespace Kitsune
                 throw OutOfRangeException();
 
             Index index = from - GetBegin();
-            Index reverseIndex = (Size() - index - 1);
 
             Usize newSize = Size() + offset;
             if (Capacity() < newSize)
                 ReallocateGrow(newSize);
 
-            for (auto it = GetReverseBegin(); it <= GetReverseBegin() + reverseIndex; ++it)
+            Iterator adjustedFrom = GetBegin() + index;
+
+            if constexpr (Algorithms::IsNothrowRelocatable<T>)
+            {
+                Algorithms::UninitializedRelocateBackward(adjustedFrom, m_End, m_End + offset);
+            }
+            else
             {
-                Memory::ConstructAt(AddressOf(*(it - offset)), Move(*it));
-                Memory::DestroyAt(AddressOf(*it));
+                // Same as in Remove(), the elements that were already moved up get dropped.
+                T* it = m_End;
+                try
+                {
+                    for (; it != adjustedFrom; --it)
+                    {
+                        Memory::ConstructAt(it - 1 + offset, Move(*(it - 1)));
+                        Memory::DestroyAt(it - 1);
+                    }
+                }
+                catch (...)
+                {
+                    Algorithms::Destroy(it + offset, m_End + offset);
+                    m_End = it;
+                    throw;
+                }
             }
 
             m_End += offset;
-            return GetBegin() + index;
+            return adjustedFrom;
         }
 
     private:
@@ -425,6 +509,9 @@ namespace Kitsune
         KITSUNE_MAYBE_OVERLAPPING Alloc m_Allocator;
     };
 
+    template<typename T, Allocator Alloc>
+    inline constexpr bool IsTriviallyRelocatable<Array<T, Alloc>> = IsTriviallyRelocatable<Alloc>;
+
     template<typename T, Allocator TAlloc, typename U, Allocator UAlloc>
     bool operator==(const Array<T, TAlloc>& arr1, const Array<U, UAlloc>& arr2)
         requires requires (T val1, U val2) { val1 == val2; }
@@ -0,0 +1,590 @@
+#pragma once
+
+#include <initializer_list>
+
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Memory/Allocator.h"
+#include "Foundation/Memory/GlobalAllocator.h"
+
+#include "Foundation/Templates/Exchange.h"
+#include "Foundation/Templates/IsTriviallyRelocatable.h"
+#include "Foundation/Iterators/Iterator.h"
+#include "Foundation/Iterators/ReverseIterator.h"
+#include "Foundation/Diagnostics/OutOfRangeException.h"
+
+#include "Foundation/Algorithms/Swap.h"
+#include "Foundation/Algorithms/Equal.h"
+#include "Foundation/Algorithms/Destroy.h"
+
+#include "Foundation/Algorithms/Distance.h"
+#include "Foundation/Algorithms/Uninitialized.h"
+
+namespace Kitsune
+{
+    // Array keeping its first N elements inside of the object itself, the allocator only gets
+    // involved once there are more. Meant for the many collections that almost always stay
+    // tiny, like the sinks of a logger.
+    //
+    // Unlike Array, moving a SmallArray whose elements are still inline has to move every
+    // element, and iterators don't survive it.
+    template<typename T, Usize N, Allocator Alloc = GlobalAllocator>
+    class SmallArray
+    {
+    public:
+        static_assert(N > 0, "Use Array for arrays without inline storage.");
+
+        using ValueType = T;
+        using AllocatorType = Alloc;
+
+        using Iterator = T*;
+        using ConstIterator = const T*;
+
+        using ReverseIterator = Kitsune::ReverseIterator<Iterator>;
+        using ReverseConstIterator = Kitsune::ReverseIterator<ConstIterator>;
+
+    public:
+        inline SmallArray()
+            : m_Begin(GetInlineData()), m_End(m_Begin), m_StorageEnd(m_Begin + N)
+        {
+        }
+
+        inline explicit SmallArray(const Alloc& alloc)
+            : m_Begin(GetInlineData()), m_End(m_Begin), m_StorageEnd(m_Begin + N),
+              m_Allocator(alloc)
+        {
+        }
+
+        inline explicit SmallArray(Alloc&& alloc)
+            : m_Begin(GetInlineData()), m_End(m_Begin), m_StorageEnd(m_Begin + N),
+              m_Allocator(Move(alloc))
+        {
+        }
+
+        inline SmallArray(Usize cap, const Alloc& alloc)
+            : SmallArray(alloc)
+        {
+            Reserve(cap);
+        }
+
+        inline explicit SmallArray(Usize cap, Alloc&& alloc = Alloc())
+            : SmallArray(Move(alloc))
+        {
+            Reserve(cap);
+        }
+
+        inline SmallArray(Usize count, const T& value, const Alloc& alloc)
+            : SmallArray(count, alloc)
+        {
+            m_End = Algorithms::UninitializedFillN(m_Begin, count, value);
+        }
+
+        inline SmallArray(Usize count, const T& value, Alloc&& alloc = Alloc())
+            : SmallArray(count, Move(alloc))
+        {
+            m_End = Algorithms::UninitializedFillN(m_Begin, count, value);
+        }
+
+        template<ForwardIterator It>
+        inline SmallArray(It begin, It end, const Alloc& alloc)
+            : SmallArray(Algorithms::Distance(begin, end), alloc)
+        {
+            m_End = Algorithms::UninitializedCopy(begin, end, m_Begin);
+        }
+
+        template<ForwardIterator It>
+        inline SmallArray(It begin, It end, Alloc&& alloc = Alloc())
+            : SmallArray(Algorithms::Distance(begin, end), Move(alloc))
+        {
+            m_End = Algorithms::UninitializedCopy(begin, end, m_Begin);
+        }
+
+        inline SmallArray(std::initializer_list<T> ilist, const Alloc& alloc)
+            : SmallArray(ilist.begin(), ilist.end(), alloc)
+        {
+        }
+
+        inline SmallArray(std::initializer_list<T> ilist, Alloc&& alloc = Alloc())
+            : SmallArray(ilist.begin(), ilist.end(), Move(alloc))
+        {
+        }
+
+        inline SmallArray(const SmallArray& array)
+            : SmallArray(array.GetBegin(), array.GetEnd(), array.GetAllocator())
+        {
+        }
+
+        inline SmallArray(SmallArray&& array)
+            : SmallArray(Move(array.GetAllocator()))
+        {
+            TakeElements(array);
+        }
+
+        inline ~SmallArray() { Reset(); }
+
+    public:
+        inline SmallArray& operator=(const SmallArray& array)
+        {
+            if (this == &array) return *this;       // Ignore self-assigns.
+
+            if (m_Allocator != array.GetAllocator())
+                Reset();
+
+            m_Allocator = array.GetAllocator();
+            RangeAssign(array.GetBegin(), array.GetEnd());
+
+            return *this;
+        }
+
+        inline SmallArray& operator=(SmallArray&& array)
+        {
+            if (this == &array) return *this;       // Ignore self-assigns.
+
+            Reset();
+
+            m_Allocator = Move(array.GetAllocator());
+            TakeElements(array);
+
+            return *this;
+        }
+
+        inline SmallArray& operator=(std::initializer_list<T> ilist)
+        {
+            RangeAssign(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+    public:
+        inline T& operator[](Index index)
+        {
+            if (index >= Size())
+                throw OutOfRangeException();
+
+            return m_Begin[index];
+        }
+
+        inline const T& operator[](Index index) const
+        {
+            if (index >= Size())
+                throw OutOfRangeException();
+
+            return m_Begin[index];
+        }
+
+    public:
+        [[nodiscard]]
+        inline T& Front()
+        {
+            if (IsEmpty())
+                throw OutOfRangeException();
+
+            return *m_Begin;
+        }
+
+        [[nodiscard]]
+        inline const T& Front() const
+        {
+            if (IsEmpty())
+                throw OutOfRangeException();
+
+            return *m_Begin;
+        }
+
+        [[nodiscard]] inline T& Back()
+        {
+            if (IsEmpty())
+                throw OutOfRangeException();
+
+            return *(m_End - 1);
+        }
+
+        [[nodiscard]] inline const T& Back() const
+        {
+            if (IsEmpty())
+                throw OutOfRangeException();
+
+            return *(m_End - 1);
+        }
+
+        [[nodiscard]] inline T* Data()             { return m_Begin; }
+        [[nodiscard]] inline const T* Data() const { return m_Begin; }
+
+        [[nodiscard]] inline Alloc& GetAllocator()             { return m_Allocator; }
+        [[nodiscard]] inline const Alloc& GetAllocator() const { return m_Allocator; }
+
+    public:
+        [[nodiscard]] inline Usize Size() const
+        {
+            return static_cast<Usize>(m_End - m_Begin);
+        }
+
+        [[nodiscard]] inline Usize Capacity() const
+        {
+            return static_cast<Usize>(m_StorageEnd - m_Begin);
+        }
+
+        [[nodiscard]]
+        inline bool IsEmpty() const { return (m_Begin == m_End); }
+
+        // Whether the elements still live inside of the array itself.
+        [[nodiscard]]
+        inline bool IsInline() const { return (m_Begin == GetInlineData()); }
+
+    public:
+        [[nodiscard]] inline Iterator GetBegin()            { return m_Begin; }
+        [[nodiscard]] inline ConstIterator GetBegin() const { return m_Begin; }
+
+        [[nodiscard]] inline Iterator GetEnd()            { return m_End; }
+        [[nodiscard]] inline ConstIterator GetEnd() const { return m_End; }
+
+        [[nodiscard]] inline ReverseIterator GetReverseBegin()            { return ReverseIterator(m_End); }
+        [[nodiscard]] inline ReverseConstIterator GetReverseBegin() const { return ReverseIterator(m_End); }
+
+        [[nodiscard]] inline ReverseIterator GetReverseEnd()            { return ReverseIterator(m_Begin); }
+        [[nodiscard]] inline ReverseConstIterator GetReverseEnd() const { return ReverseIterator(m_Begin); }
+
+    public:
+        inline void Reserve(Usize newCapacity)
+        {
+            if (newCapacity <= Capacity()) return;
+            ReallocateGrowExact(newCapacity);
+        }
+
+        // Moves the elements back inline when they fit again.
+        inline void ShrinkToFit() { ReallocateGrowExact(Size()); }
+
+    public:
+        void Swap(SmallArray& array)
+        {
+            if (!IsInline() && !array.IsInline())
+            {
+                Algorithms::Swap(m_Begin, array.m_Begin);
+                Algorithms::Swap(m_End, array.m_End);
+                Algorithms::Swap(m_StorageEnd, array.m_StorageEnd);
+
+                Algorithms::Swap(m_Allocator, array.m_Allocator);
+                return;
+            }
+
+            SmallArray temp(Move(array));
+            array = Move(*this);
+            *this = Move(temp);
+        }
+
+    public:
+        // Keeps the capacity around for refilling, ShrinkToFit() gives it back.
+        inline void Clear()
+        {
+            Algorithms::Destroy(m_Begin, m_End);
+            m_End = m_Begin;
+        }
+
+        inline Iterator Insert(Iterator pos, const T& val) { return Emplace(pos, val); }
+        inline Iterator Insert(Iterator pos, T&& val)      { return Emplace(pos, Move(val)); }
+
+        inline Iterator Insert(Iterator pos, Usize count, const T& value)
+        {
+            Iterator adjustedPos = ShiftEnd(pos, count);
+            Algorithms::UninitializedFillN(adjustedPos, count, value);
+
+            return adjustedPos;
+        }
+
+        template<ForwardIterator It>
+        inline Iterator Insert(Iterator pos, It begin, It end)
+        {
+            Iterator adjustedPos = ShiftEnd(pos, Algorithms::Distance(begin, end));
+            Algorithms::UninitializedCopy(begin, end, adjustedPos);
+
+            return adjustedPos;
+        }
+
+        inline Iterator Insert(Iterator pos, std::initializer_list<T> ilist)
+        {
+            return Insert(pos, ilist.begin(), ilist.end());
+        }
+
+        template<typename... Args>
+        inline Iterator Emplace(Iterator pos, Args&&... args)
+        {
+            Iterator adjustedPos = ShiftEnd(pos, 1);
+            Memory::ConstructAt(adjustedPos, Forward<Args>(args)...);
+
+            return adjustedPos;
+        }
+
+        inline void Remove(Iterator pos) { return Remove(pos, pos + 1); }
+        inline void Remove(Iterator begin, Iterator end)
+        {
+            if ((begin < GetBegin()) || (begin >= GetEnd()) || (end < GetBegin()) || (end > GetEnd()))
+                throw OutOfRangeException();
+
+            Algorithms::Destroy(begin, end);
+
+            if constexpr (Algorithms::IsNothrowRelocatable<T>)
+            {
+                m_End = Algorithms::UninitializedRelocate(end, m_End, begin);
+            }
+            else
+            {
+                // The ranges overlap, so a throwing move leaves a gap. Drop whatever comes after it.
+                T* it = end;
+                try
+                {
+                    for (; it != m_End; ++it, ++begin)
+                    {
+                        Memory::ConstructAt(begin, Move(*it));
+                        Memory::DestroyAt(it);
+                    }
+                }
+                catch (...)
+                {
+                    Algorithms::Destroy(it, m_End);
+                    m_End = begin;
+                    throw;
+                }
+
+                m_End = begin;
+            }
+        }
+
+        inline void PushBack(const T& val) { EmplaceBack(val); }
+        inline void PushBack(T&& val)      { EmplaceBack(Move(val)); }
+
+        template<typename... Args>
+        inline T& EmplaceBack(Args&&... args)
+        {
+            Usize newSize = Size() + 1;
+            if (newSize > Capacity())
+                ReallocateGrow(newSize);
+
+            Memory::ConstructAt(m_End, Forward<Args>(args)...);
+            return *(m_End++);
+        }
+
+        inline void PopBack()
+        {
+            if (IsEmpty()) throw OutOfRangeException();
+            Memory::DestroyAt(--m_End);
+        }
+
+    public:
+        // Should not be called by engine/client code.
+        // Made public so that the compiler can generate code for range-based for loops.
+        inline Iterator begin() { return GetBegin(); }
+        inline ConstIterator begin() const { return GetBegin(); }
+
+        inline Iterator end() { return GetEnd(); }
+        inline ConstIterator end() const { return GetEnd(); }
+
+    public:
+        static constexpr Usize s_InlineCapacity = N;
+
+    private:
+        KITSUNE_FORCEINLINE T* GetInlineData()
+        {
+            return reinterpret_cast<T*>(m_Inline);
+        }
+
+        KITSUNE_FORCEINLINE const T* GetInlineData() const
+        {
+            return reinterpret_cast<const T*>(m_Inline);
+        }
+
+        KITSUNE_FORCEINLINE Usize GetAdjustedCapacity(Usize cap)
+        {
+            return static_cast<Usize>(static_cast<float>(cap) * s_AllocationFactor);
+        }
+
+        KITSUNE_FORCEINLINE void FreeAllocation(T* ptr)
+        {
+            m_Allocator.Free(ptr);
+        }
+
+        // Destroys every element and goes back to the inline storage.
+        inline void Reset()
+        {
+            Clear();
+
+            if (!IsInline())
+                FreeAllocation(m_Begin);
+
+            m_Begin = m_End = GetInlineData();
+            m_StorageEnd = m_Begin + N;
+        }
+
+        // Expects to be empty and inline, and the allocator to have been taken already.
+        inline void TakeElements(SmallArray& array)
+        {
+            if (array.IsInline())
+            {
+                m_End = Algorithms::UninitializedRelocate(array.m_Begin, array.m_End, m_Begin);
+                array.m_End = array.m_Begin;
+
+                return;
+            }
+
+            m_Begin = Exchange(array.m_Begin, array.GetInlineData());
+            m_End = Exchange(array.m_End, array.m_Begin);
+            m_StorageEnd = Exchange(array.m_StorageEnd, array.m_Begin + N);
+        }
+
+        inline void ReallocateGrow(Usize newCapacity)
+        {
+            ReallocateGrowExact(KITSUNE_MAX(GetAdjustedCapacity(newCapacity), newCapacity));
+        }
+
+        inline void ReallocateGrowExact(Usize newCapacity)
+        {
+            T* ptr;
+            if (newCapacity <= N)
+            {
+                if (IsInline())
+                    return;
+
+                ptr = GetInlineData();
+                newCapacity = N;
+            }
+            else
+            {
+                if (!IsInline() && TryReallocateInPlace(newCapacity))
+                    return;
+
+                ptr = static_cast<T*>(m_Allocator.Allocate(newCapacity * sizeof(T), alignof(T)));
+            }
+
+            T* end;
+
+            try
+            {
+                end = Algorithms::UninitializedRelocate(m_Begin, m_End, ptr);
+            }
+            catch (...)
+            {
+                if (ptr != GetInlineData())
+                    FreeAllocation(ptr);
+
+                throw;
+            }
+
+            if (!IsInline())
+                FreeAllocation(m_Begin);
+
+            m_Begin = ptr;
+            m_End = end;
+            m_StorageEnd = ptr + newCapacity;
+        }
+
+        // See Array::TryReallocateInPlace().
+        inline bool TryReallocateInPlace(Usize newCapacity)
+        {
+            if constexpr (ExpandableAllocator<Alloc>)
+            {
+                if (newCapacity > Capacity() && m_Allocator.TryExpand(m_Begin, newCapacity * sizeof(T)))
+                {
+                    m_StorageEnd = m_Begin + newCapacity;
+                    return true;
+                }
+            }
+
+            if constexpr (ReallocatableAllocator<Alloc> && IsTriviallyRelocatable<T>)
+            {
+                Usize size = Size();
+
+                T* ptr = static_cast<T*>(m_Allocator.TryReallocate(m_Begin, newCapacity * sizeof(T), alignof(T)));
+                if (ptr != nullptr)
+                {
+                    m_Begin = ptr;
+                    m_End = ptr + size;
+                    m_StorageEnd = ptr + newCapacity;
+
+                    return true;
+                }
+            }
+
+            KITSUNE_UNUSED(newCapacity);
+            return false;
+        }
+
+    private:
+        template<ForwardIterator It>
+        void RangeAssign(It begin, It end)
+        {
+            Usize size = static_cast<Usize>(Algorithms::Distance(begin, end));
+
+            Algorithms::Destroy(m_Begin, m_End);
+            m_End = m_Begin;
+
+            if (Capacity() < size)
+                ReallocateGrowExact(size);
+
+            m_End = Algorithms::UninitializedCopy(begin, end, m_Begin);
+        }
+
+        Iterator ShiftEnd(Iterator from, Usize offset)
+        {
+            if ((from < GetBegin()) || (from > GetEnd()))
+                throw OutOfRangeException();
+
+            Index index = from - GetBegin();
+
+            Usize newSize = Size() + offset;
+            if (Capacity() < newSize)
+                ReallocateGrow(newSize);
+
+            Iterator adjustedFrom = GetBegin() + index;
+
+            if constexpr (Algorithms::IsNothrowRelocatable<T>)
+            {
+                Algorithms::UninitializedRelocateBackward(adjustedFrom, m_End, m_End + offset);
+            }
+            else
+            {
+                // Same as in Remove(), the elements that were already moved up get dropped.
+                T* it = m_End;
+                try
+                {
+                    for (; it != adjustedFrom; --it)
+                    {
+                        Memory::ConstructAt(it - 1 + offset, Move(*(it - 1)));
+                        Memory::DestroyAt(it - 1);
+                    }
+                }
+                catch (...)
+                {
+                    Algorithms::Destroy(it + offset, m_End + offset);
+                    m_End = it;
+                    throw;
+                }
+            }
+
+            m_End += offset;
+            return adjustedFrom;
+        }
+
+    private:
+        static constexpr float s_AllocationFactor = 1.5f;
+
+    private:
+        T *m_Begin, *m_End, *m_StorageEnd;
+        KITSUNE_MAYBE_OVERLAPPING Alloc m_Allocator;
+
+        alignas(T) Uint8 m_Inline[N * sizeof(T)];
+    };
+
+    template<typename T, Usize TN, Allocator TAlloc, typename U, Usize UN, Allocator UAlloc>
+    bool operator==(const SmallArray<T, TN, TAlloc>& arr1, const SmallArray<U, UN, UAlloc>& arr2)
+        requires requires (T val1, U val2) { val1 == val2; }
+    {
+        return Algorithms::Equal(arr1.GetBegin(), arr1.GetEnd(), arr2.GetBegin(), arr2.GetEnd());
+    }
+
+    namespace Algorithms
+    {
+        template<typename T, Usize N, Allocator Alloc>
+        void Swap(SmallArray<T, N, Alloc>& arr1, SmallArray<T, N, Alloc>& arr2)
+        {
+            arr1.Swap(arr2);
+        }
+    }
+}
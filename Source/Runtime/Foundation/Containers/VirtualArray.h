@@ -0,0 +1,328 @@
+#pragma once
+
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Memory/Memory.h"
+#include "Foundation/Memory/VirtualMemory.h"
+#include "Foundation/Memory/BadAllocException.h"
+
+#include "Foundation/Templates/Move.h"
+#include "Foundation/Templates/Exchange.h"
+#include "Foundation/Templates/IsTriviallyRelocatable.h"
+#include "Foundation/Iterators/Iterator.h"
+#include "Foundation/Iterators/ReverseIterator.h"
+#include "Foundation/Diagnostics/OutOfRangeException.h"
+
+#include "Foundation/Algorithms/Swap.h"
+#include "Foundation/Algorithms/Destroy.h"
+
+namespace Kitsune
+{
+    // Growable array living in a range of address space reserved up front for `maxCapacity`
+    // elements. Pages only get committed as the array grows into them, so growing never moves
+    // or copies anything: element addresses stay valid until the element itself is removed.
+    //
+    // Meant for big append-only buffers. Going past the maximum capacity throws a
+    // BadAllocException, so be generous with it, unused address space is (almost) free.
+    template<typename T>
+    class VirtualArray
+    {
+    public:
+        using ValueType = T;
+
+        using Iterator = T*;
+        using ConstIterator = const T*;
+
+        using ReverseIterator = Kitsune::ReverseIterator<Iterator>;
+        using ReverseConstIterator = Kitsune::ReverseIterator<ConstIterator>;
+
+    public:
+        inline VirtualArray()
+            : m_Begin(nullptr), m_End(nullptr), m_StorageEnd(nullptr),
+              m_CommittedBytes(0), m_UsableBytes(0), m_CommitGranularity(0),
+              m_Reservation(nullptr), m_ReservedBytes(0)
+        {
+        }
+
+        // With `hugePages` set, the range is aligned to and committed in huge pages, and the
+        // OS is asked to back it with them. Worth it for arrays spanning many megabytes.
+        inline explicit VirtualArray(Usize maxCapacity, bool hugePages = false)
+            : VirtualArray()
+        {
+            if (maxCapacity == 0)
+                return;
+
+            if (maxCapacity > ~Usize(0) / sizeof(T) / 2)
+                throw BadAllocException();
+
+            Usize pageSize = VirtualMemory::GetPageSize();
+            Usize alignment = hugePages ? VirtualMemory::GetHugePageSize() : pageSize;
+
+            m_CommitGranularity = KITSUNE_MAX(alignment, s_MinCommitBytes);
+
+            // Pages are always plenty aligned for T, only huge pages need the slack.
+            m_UsableBytes = AlignUp(maxCapacity * sizeof(T), m_CommitGranularity);
+            m_ReservedBytes = m_UsableBytes + ((alignment > pageSize) ? alignment : 0);
+
+            m_Reservation = VirtualMemory::Reserve(m_ReservedBytes);
+            if (m_Reservation == nullptr)
+                throw BadAllocException();
+
+            Uint8* begin = reinterpret_cast<Uint8*>(AlignUp(reinterpret_cast<Uintptr>(m_Reservation), alignment));
+            if (hugePages)
+                VirtualMemory::AdviseHugePages(begin, m_UsableBytes);
+
+            m_Begin = m_End = m_StorageEnd = reinterpret_cast<T*>(begin);
+        }
+
+        inline VirtualArray(VirtualArray&& array)
+            : m_Begin(Exchange(array.m_Begin, nullptr)),
+              m_End(Exchange(array.m_End, nullptr)),
+              m_StorageEnd(Exchange(array.m_StorageEnd, nullptr)),
+              m_CommittedBytes(Exchange(array.m_CommittedBytes, Usize(0))),
+              m_UsableBytes(Exchange(array.m_UsableBytes, Usize(0))),
+              m_CommitGranularity(Exchange(array.m_CommitGranularity, Usize(0))),
+              m_Reservation(Exchange(array.m_Reservation, nullptr)),
+              m_ReservedBytes(Exchange(array.m_ReservedBytes, Usize(0)))
+        {
+        }
+
+        inline ~VirtualArray()
+        {
+            Clear();
+            VirtualMemory::Release(m_Reservation, m_ReservedBytes);
+        }
+
+    public:
+        VirtualArray(const VirtualArray&) = delete;
+        VirtualArray& operator=(const VirtualArray&) = delete;
+
+        inline VirtualArray& operator=(VirtualArray&& array)
+        {
+            VirtualArray(Move(array)).Swap(*this);
+            return *this;
+        }
+
+    public:
+        inline T& operator[](Index index)
+        {
+            if (index >= Size())
+                throw OutOfRangeException();
+
+            return m_Begin[index];
+        }
+
+        inline const T& operator[](Index index) const
+        {
+            if (index >= Size())
+                throw OutOfRangeException();
+
+            return m_Begin[index];
+        }
+
+    public:
+        [[nodiscard]]
+        inline T& Front()
+        {
+            if (IsEmpty())
+                throw OutOfRangeException();
+
+            return *m_Begin;
+        }
+
+        [[nodiscard]]
+        inline const T& Front() const
+        {
+            if (IsEmpty())
+                throw OutOfRangeException();
+
+            return *m_Begin;
+        }
+
+        [[nodiscard]] inline T& Back()
+        {
+            if (IsEmpty())
+                throw OutOfRangeException();
+
+            return *(m_End - 1);
+        }
+
+        [[nodiscard]] inline const T& Back() const
+        {
+            if (IsEmpty())
+                throw OutOfRangeException();
+
+            return *(m_End - 1);
+        }
+
+        [[nodiscard]] inline T* Data()             { return m_Begin; }
+        [[nodiscard]] inline const T* Data() const { return m_Begin; }
+
+    public:
+        [[nodiscard]] inline Usize Size() const
+        {
+            return static_cast<Usize>(m_End - m_Begin);
+        }
+
+        // Number of elements that fit in the pages committed so far.
+        [[nodiscard]] inline Usize Capacity() const
+        {
+            return static_cast<Usize>(m_StorageEnd - m_Begin);
+        }
+
+        [[nodiscard]] inline Usize MaxCapacity() const
+        {
+            return m_UsableBytes / sizeof(T);
+        }
+
+        [[nodiscard]]
+        inline bool IsEmpty() const { return (m_Begin == m_End); }
+
+    public:
+        [[nodiscard]] inline Iterator GetBegin()            { return m_Begin; }
+        [[nodiscard]] inline ConstIterator GetBegin() const { return m_Begin; }
+
+        [[nodiscard]] inline Iterator GetEnd()            { return m_End; }
+        [[nodiscard]] inline ConstIterator GetEnd() const { return m_End; }
+
+        [[nodiscard]] inline ReverseIterator GetReverseBegin()            { return ReverseIterator(m_End); }
+        [[nodiscard]] inline ReverseConstIterator GetReverseBegin() const { return ReverseIterator(m_End); }
+
+        [[nodiscard]] inline ReverseIterator GetReverseEnd()            { return ReverseIterator(m_Begin); }
+        [[nodiscard]] inline ReverseConstIterator GetReverseEnd() const { return ReverseIterator(m_Begin); }
+
+    public:
+        inline void Reserve(Usize newCapacity)
+        {
+            if (newCapacity <= Capacity()) return;
+            CommitExact(newCapacity);
+        }
+
+        // Gives the pages past the last element back to the OS, the address space stays ours.
+        inline void ShrinkToFit()
+        {
+            Usize used = AlignUp(Size() * sizeof(T), m_CommitGranularity);
+            if (used >= m_CommittedBytes)
+                return;
+
+            Uint8* begin = reinterpret_cast<Uint8*>(m_Begin);
+            VirtualMemory::Decommit(begin + used, m_CommittedBytes - used);
+
+            SetCommittedBytes(used);
+        }
+
+    public:
+        void Swap(VirtualArray& array)
+        {
+            Algorithms::Swap(m_Begin, array.m_Begin);
+            Algorithms::Swap(m_End, array.m_End);
+            Algorithms::Swap(m_StorageEnd, array.m_StorageEnd);
+
+            Algorithms::Swap(m_CommittedBytes, array.m_CommittedBytes);
+            Algorithms::Swap(m_UsableBytes, array.m_UsableBytes);
+            Algorithms::Swap(m_CommitGranularity, array.m_CommitGranularity);
+
+            Algorithms::Swap(m_Reservation, array.m_Reservation);
+            Algorithms::Swap(m_ReservedBytes, array.m_ReservedBytes);
+        }
+
+    public:
+        // Destroys every element, committed pages are kept around for reuse.
+        inline void Clear()
+        {
+            Algorithms::Destroy(m_Begin, m_End);
+            m_End = m_Begin;
+        }
+
+        inline void PushBack(const T& val) { EmplaceBack(val); }
+        inline void PushBack(T&& val)      { EmplaceBack(Move(val)); }
+
+        template<typename... Args>
+        inline T& EmplaceBack(Args&&... args)
+        {
+            if (m_End == m_StorageEnd)
+                CommitGrow(Size() + 1);
+
+            Memory::ConstructAt(m_End, Forward<Args>(args)...);
+            return *(m_End++);
+        }
+
+        inline void PopBack()
+        {
+            if (IsEmpty()) throw OutOfRangeException();
+            Memory::DestroyAt(--m_End);
+        }
+
+    public:
+        // Should not be called by engine/client code.
+        // Made public so that the compiler can generate code for range-based for loops.
+        inline Iterator begin() { return GetBegin(); }
+        inline ConstIterator begin() const { return GetBegin(); }
+
+        inline Iterator end() { return GetEnd(); }
+        inline ConstIterator end() const { return GetEnd(); }
+
+    public:
+        static constexpr Usize s_MinCommitBytes = 64 * 1024;
+
+    private:
+        KITSUNE_FORCEINLINE static Usize AlignUp(Usize value, Usize alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        KITSUNE_NOINLINE void CommitGrow(Usize newCapacity)
+        {
+            // Commit at least half again of what's there, to keep the number of calls into
+            // the OS logarithmic without committing far more than gets used.
+            if (newCapacity > MaxCapacity())
+                throw BadAllocException();
+
+            Usize grown = Capacity() + Capacity() / 2;
+            CommitExact(KITSUNE_MIN(KITSUNE_MAX(newCapacity, grown), MaxCapacity()));
+        }
+
+        void CommitExact(Usize newCapacity)
+        {
+            if (newCapacity > MaxCapacity())
+                throw BadAllocException();
+
+            Usize bytes = AlignUp(newCapacity * sizeof(T), m_CommitGranularity);
+
+            Uint8* begin = reinterpret_cast<Uint8*>(m_Begin);
+            if (!VirtualMemory::Commit(begin + m_CommittedBytes, bytes - m_CommittedBytes))
+                throw BadAllocException();
+
+            SetCommittedBytes(bytes);
+        }
+
+        inline void SetCommittedBytes(Usize bytes)
+        {
+            m_CommittedBytes = bytes;
+            m_StorageEnd = m_Begin + bytes / sizeof(T);
+        }
+
+    private:
+        T *m_Begin, *m_End, *m_StorageEnd;
+
+        Usize m_CommittedBytes;
+        Usize m_UsableBytes;
+        Usize m_CommitGranularity;
+
+        void* m_Reservation;
+        Usize m_ReservedBytes;
+    };
+
+    // Everything lives outside of the object, a moved VirtualArray is still the same array.
+    template<typename T>
+    inline constexpr bool IsTriviallyRelocatable<VirtualArray<T>> = true;
+
+    namespace Algorithms
+    {
+        template<typename T>
+        void Swap(VirtualArray<T>& arr1, VirtualArray<T>& arr2)
+        {
+            arr1.Swap(arr2);
+        }
+    }
+}
@@ -3,26 +3,24 @@
 #include <Windows.h>
 #include <CommCtrl.h>
 
-#include "Foundation/Windows/StringConversions.h"
+#include "Foundation/String/Unicode.h"
 
 namespace Kitsune
 {
     bool ShowMessageBox(const MessageBoxSpecs& specs, MessageBoxButtonId* pressed)
     {
-        using namespace Internal;
-
         TASKDIALOGCONFIG config;
         ::ZeroMemory(&config, sizeof(config));
 
-        WideString wideTitle = WindowsConvertToUtf16(specs.Title);
-        WideString wideDescription = WindowsConvertToUtf16(specs.Description);
+        WideString wideTitle = ConvertStringLossy<wchar_t>(specs.Title);
+        WideString wideDescription = ConvertStringLossy<wchar_t>(specs.Description);
 
         Array<WideString> buttonTexts(specs.Buttons.Size());
         Array<TASKDIALOG_BUTTON> buttons(specs.Buttons.Size());
 
         for (const MessageBoxButton& button : specs.Buttons)
         {
-            buttonTexts.PushBack(WindowsConvertToUtf16(button.Text));
+            buttonTexts.PushBack(ConvertStringLossy<wchar_t>(button.Text));
 
             TASKDIALOG_BUTTON nativeButton;
             nativeButton.nButtonID = button.Id;
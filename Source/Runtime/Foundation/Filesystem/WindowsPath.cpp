@@ -52,8 +52,7 @@ namespace Kitsune
     {
         if (m_String.IsEmpty()) return false;
 
-        WideString maybeRoot = m_String.Substring(0,
-            KITSUNE_MIN(m_String.Size(), 4));
+        WideStringView maybeRoot = m_String.Slice(0, 4);
 
         if (m_String[1] == L':')
         {
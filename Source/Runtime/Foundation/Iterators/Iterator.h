@@ -43,6 +43,16 @@ namespace Kitsune
             *(iterator++) = Forward<T>(val);
         };
 
+    // Output iterators that can take a whole run of values at once, like the ones appending
+    // to a string or a stream. Algorithms::Copy() hands them contiguous ranges in one call.
+    template<typename It, typename T>
+    concept BulkWritableIterator =
+        WritableIterator<It, T> &&
+        requires (It iterator, const T* data, Usize count)
+        {
+            iterator.Write(data, count);
+        };
+
     template<typename It>
     concept ReadableIterator =
         Iterator<It> &&
@@ -12,25 +12,28 @@ namespace Kitsune
             (message.Severity < LogSeverity::Error) ? m_StdoutStream :
                                                       m_StderrStream;
 
-        String header;
-        String locInfo;
+        // Both strings only live until the end of this call, so they're carved out of
+        // the scratch arena. Whatever the previous call left in there is dead by now.
+        m_ScratchArena.Reset();
+        LinearAllocator scratch(m_ScratchArena);
+
+        BasicString<char, LinearAllocator> header(scratch);
+        BasicString<char, LinearAllocator> locInfo(scratch);
 
         const SourceLocation& location = message.Location;
 
         if (!message.LoggerName.IsEmpty())
-            header = Format("[{0}]: ", message.LoggerName);
+            header = Format(scratch, "[{0}]: ", message.LoggerName);
 
         if (location != SourceLocation())
         {
-            locInfo = Format(" [In function {0}, {1}:{2}]",
+            locInfo = Format(scratch, " [In function {0}, {1}:{2}]",
                              location.FunctionName(), location.FileName(),
                              location.Line());
         }
 
-        StringView fmt = "{0}{1}{2}{3}\x1B[0m\n";
-        FormatTo(WriteStreamIterator<char>(stream), DefaultFormatScanner(fmt), fmt,
-                 PickAnsiColor(message.Severity), header, message.Message,
-                 locInfo);
+        FormatTo(WriteStreamIterator<char>(stream), "{0}{1}{2}{3}\x1B[0m\n",
+                 PickAnsiColor(message.Severity), header, message.Message, locInfo);
     }
 
     void AnsiColorSink::Flush()
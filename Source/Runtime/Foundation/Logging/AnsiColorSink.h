@@ -3,6 +3,8 @@
 #include "Foundation/Logging/ILogSink.h"
 #include "Foundation/Logging/ConsoleStream.h"
 
+#include "Foundation/Memory/LinearAllocator.h"
+
 #include "Foundation/Threading/Mutex.h"
 #include "Foundation/Threading/LockGuard.h"
 
@@ -13,7 +15,8 @@ namespace Kitsune
     public:
         inline AnsiColorSink(ConsoleOutputStream& outStream,
                              ConsoleOutputStream& errStream)
-            : m_StdoutStream(outStream), m_StderrStream(errStream)
+            : m_StdoutStream(outStream), m_StderrStream(errStream),
+              m_ScratchArena(s_ScratchBlockSize)
         {
         }
 
@@ -38,10 +41,13 @@ namespace Kitsune
             "\x1B[31m",     // Fatal
         };
 
+        static constexpr Usize s_ScratchBlockSize = 1024;
+
     private:
         ConsoleOutputStream& m_StdoutStream;
         ConsoleOutputStream& m_StderrStream;
 
         Mutex m_SinkLock;
+        LinearArena m_ScratchArena;
     };
 }
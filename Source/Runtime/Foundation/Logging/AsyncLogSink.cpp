@@ -0,0 +1,337 @@
+#include "Foundation/Logging/AsyncLogSink.h"
+
+#include <bit>
+#include <new>
+#include <cstring>
+#include <exception>
+
+#include "Foundation/Memory/Memory.h"
+#include "Foundation/String/Format.h"
+
+#include "Foundation/Algorithms/ForEach.h"
+#include "Foundation/Templates/Exchange.h"
+#include "Foundation/Threading/SpinLock.h"
+#include "Foundation/Threading/LockGuard.h"
+
+namespace Kitsune
+{
+    AsyncLogSink::AsyncLogSink(const SharedPtr<ILogSink>& sink, Usize capacity, LogOverflowPolicy policy)
+        : AsyncLogSink({ sink }, capacity, policy)
+    {
+    }
+
+    AsyncLogSink::AsyncLogSink(std::initializer_list<SharedPtr<ILogSink>> sinks, Usize capacity,
+                               LogOverflowPolicy policy)
+        : m_Capacity(std::bit_ceil(KITSUNE_MAX(capacity, Usize(2)))), m_Slots(MakeSlots(m_Capacity)),
+          m_Policy(policy), m_Sinks(sinks.begin(), sinks.end()),
+          m_Worker(&AsyncLogSink::RunWorker, this)
+    {
+    }
+
+    AsyncLogSink::~AsyncLogSink()
+    {
+        // The worker drains the queue and flushes the sinks before it returns.
+        Interlocked::Store(&m_Stopping, 1);
+        WakeWorker();
+
+        m_Worker.Join();
+    }
+
+    void AsyncLogSink::Log(const LogMessage& message)
+    {
+        Usize nameSize = message.LoggerName.Size();
+        Usize messageSize = message.Message.Size();
+
+        // Allocated before claiming a slot, the worker waits on claimed slots and one that
+        // never gets handed over would hold it up for good if this throws.
+        char* heapText = nullptr;
+        if (nameSize + messageSize > sizeof(Slot::Text))
+            heapText = static_cast<char*>(Memory::Allocate(nameSize + messageSize));
+
+        Int64 position;
+        while (!TryClaimSlot(position))
+        {
+            if (m_Policy != LogOverflowPolicy::Block)
+            {
+                if (m_Policy == LogOverflowPolicy::DropAndCount)
+                    Interlocked::Increment(&m_DroppedCount);
+
+                if (heapText != nullptr)
+                    Memory::Free(heapText);
+
+                return;
+            }
+
+            WaitForFreeSlot();
+        }
+
+        // Only the worker wakes up blocked producers, and only one at a time. Whoever got
+        // a slot passes it on while there's still room.
+        if (m_Policy == LogOverflowPolicy::Block && Interlocked::Load(&m_BlockedProducers) > 0 && HasFreeSlot())
+            m_SpaceEvent.Signal();
+
+        Slot& slot = m_Slots.Get()[position & static_cast<Int64>(m_Capacity - 1)];
+
+        slot.HeapText = heapText;
+        char* text = (heapText != nullptr) ? heapText : slot.Text;
+
+        if (nameSize != 0)
+            std::memcpy(text, message.LoggerName.Data(), nameSize);
+
+        if (messageSize != 0)
+            std::memcpy(text + nameSize, message.Message.Data(), messageSize);
+
+        slot.Location = message.Location;
+        slot.Severity = message.Severity;
+        slot.NameSize = static_cast<Uint32>(nameSize);
+        slot.MessageSize = messageSize;
+
+        // Hands the slot over to the worker.
+        Interlocked::Store(&slot.Sequence, position + 1);
+        WakeWorker();
+    }
+
+    void AsyncLogSink::Flush()
+    {
+        // One at a time, so that every signal from the worker has a single thread to go to.
+        LockGuard guard(m_FlushLock);
+
+        Int64 request = Interlocked::Increment(&m_FlushRequests);
+        WakeWorker();
+
+        while (Interlocked::Load(&m_FlushesDone) < request)
+            m_FlushedEvent.Wait();
+
+        std::exception_ptr error;
+        {
+            LockGuard errorGuard(m_SinkErrorLock);
+            error = Exchange(m_SinkError, nullptr);
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    ScopedPtr<AsyncLogSink::Slot, AsyncLogSink::SlotsDeleter> AsyncLogSink::MakeSlots(Usize capacity)
+    {
+        auto* slots = static_cast<Slot*>(Memory::Allocate(capacity * sizeof(Slot), alignof(Slot)));
+
+        for (Usize i = 0; i < capacity; ++i)
+        {
+            new (slots + i) Slot();
+            slots[i].Sequence = static_cast<Int64>(i);
+        }
+
+        return ScopedPtr<Slot, SlotsDeleter>(slots);
+    }
+
+    // Bounded queue after Dmitry Vyukov's: every slot has a sequence number that tells whose
+    // turn it is. It's the slot's position while it's free for that lap around the ring,
+    // and one past it once the message in it can be read.
+    bool AsyncLogSink::TryClaimSlot(Int64& position)
+    {
+        Int64 current = Interlocked::Load(&m_EnqueuePosition);
+
+        for (;;)
+        {
+            Slot& slot = m_Slots.Get()[current & static_cast<Int64>(m_Capacity - 1)];
+            Int64 difference = Interlocked::Load(&slot.Sequence) - current;
+
+            // Still holds a message from the previous lap, the queue is full.
+            if (difference < 0)
+                return false;
+
+            if (difference == 0)
+            {
+                Int64 previous = Interlocked::CompareExchange(&m_EnqueuePosition, current + 1, current);
+                if (previous == current)
+                {
+                    position = current;
+                    return true;
+                }
+
+                current = previous;
+            }
+            else
+            {
+                // Another producer got there first.
+                current = Interlocked::Load(&m_EnqueuePosition);
+            }
+        }
+    }
+
+    bool AsyncLogSink::HasFreeSlot() const
+    {
+        Int64 current = Interlocked::Load(&m_EnqueuePosition);
+        return (Interlocked::Load(&m_Slots.Get()[current & static_cast<Int64>(m_Capacity - 1)].Sequence) >= current);
+    }
+
+    void AsyncLogSink::WaitForFreeSlot()
+    {
+        // The worker looks for blocked producers after it frees slots. Looking at the queue
+        // again after being counted means its signal can't be missed.
+        Interlocked::Increment(&m_BlockedProducers);
+
+        if (!HasFreeSlot())
+            m_SpaceEvent.Wait();
+
+        Interlocked::Decrement(&m_BlockedProducers);
+    }
+
+    void AsyncLogSink::WakeWorker()
+    {
+        if (Interlocked::Load(&m_WorkerWaiting) != 0 && Interlocked::Exchange(&m_WorkerWaiting, 0) != 0)
+            m_WorkEvent.Signal();
+    }
+
+    void AsyncLogSink::RunWorker(void* userData)
+    {
+        static_cast<AsyncLogSink*>(userData)->WorkerLoop();
+    }
+
+    void AsyncLogSink::WorkerLoop()
+    {
+        for (;;)
+        {
+            Usize drained = Drain(Interlocked::Load(&m_EnqueuePosition), false);
+
+            Int64 flushRequests = Interlocked::Load(&m_FlushRequests);
+            bool isStopping = (Interlocked::Load(&m_Stopping) != 0);
+
+            if (flushRequests != Interlocked::Load(&m_FlushesDone) || isStopping)
+            {
+                // Everything that got a slot before now, messages still being copied in
+                // included.
+                Drain(Interlocked::Load(&m_EnqueuePosition), true);
+                ReportDropped();
+                FlushSinks();
+
+                Interlocked::Store(&m_FlushesDone, flushRequests);
+                m_FlushedEvent.Signal();
+
+                if (isStopping)
+                    return;
+
+                continue;
+            }
+
+            if (drained != 0)
+                continue;
+
+            // Nothing to do. Producers check the flag after handing over a message, so
+            // looking at the queue again after setting it means none of them get missed.
+            Interlocked::Store(&m_WorkerWaiting, 1);
+
+            Slot& next = m_Slots.Get()[m_DequeuePosition & static_cast<Int64>(m_Capacity - 1)];
+            bool isIdle = (Interlocked::Load(&next.Sequence) != m_DequeuePosition + 1) &&
+                          (Interlocked::Load(&m_FlushRequests) == flushRequests) &&
+                          (Interlocked::Load(&m_Stopping) == 0);
+
+            if (isIdle)
+                m_WorkEvent.Wait();
+
+            Interlocked::Store(&m_WorkerWaiting, 0);
+        }
+    }
+
+    Usize AsyncLogSink::Drain(Int64 target, bool waitForWriters)
+    {
+        Usize count = 0;
+
+        while (m_DequeuePosition < target)
+        {
+            Slot& slot = m_Slots.Get()[m_DequeuePosition & static_cast<Int64>(m_Capacity - 1)];
+
+            // Claimed, but the message is still being copied in. That never takes long, nothing
+            // between claiming the slot and handing it over can fail.
+            if (Interlocked::Load(&slot.Sequence) != m_DequeuePosition + 1)
+            {
+                if (waitForWriters)
+                {
+                    SpinLock::Pause();
+                    continue;
+                }
+
+                break;
+            }
+
+            const char* text = (slot.HeapText != nullptr) ? slot.HeapText : slot.Text;
+            LogMessage message(StringView(text + slot.NameSize, slot.MessageSize),
+                               StringView(text, slot.NameSize), slot.Location, slot.Severity);
+
+            LogToSinks(message);
+
+            if (slot.HeapText != nullptr)
+                Memory::Free(slot.HeapText);
+
+            Interlocked::Store(&slot.Sequence, m_DequeuePosition + static_cast<Int64>(m_Capacity));
+
+            ++m_DequeuePosition;
+            ++count;
+        }
+
+        if (count != 0)
+        {
+            ReportDropped();
+
+            if (Interlocked::Load(&m_BlockedProducers) > 0)
+                m_SpaceEvent.Signal();
+        }
+
+        return count;
+    }
+
+    void AsyncLogSink::ReportDropped()
+    {
+        Int64 dropped = Interlocked::Load(&m_DroppedCount);
+        if (dropped == m_ReportedDropped)
+            return;
+
+        char text[96];
+        char* end = FormatTo(text, "{0} log messages were dropped, the queue was full.", dropped - m_ReportedDropped);
+
+        m_ReportedDropped = dropped;
+
+        LogMessage message(StringView(text, end), StringView(), SourceLocation(), LogSeverity::Warning);
+        LogToSinks(message);
+    }
+
+    // Nothing a sink throws may leave the worker, the slot still has to be released and the
+    // flush marked as done.
+    void AsyncLogSink::LogToSinks(const LogMessage& message)
+    {
+        Algorithms::ForEach(m_Sinks.GetBegin(), m_Sinks.GetEnd(), [&](const auto& sink)
+        {
+            try
+            {
+                sink->Log(message);
+            }
+            catch (...)
+            {
+                KeepSinkError();
+            }
+        });
+    }
+
+    void AsyncLogSink::FlushSinks()
+    {
+        Algorithms::ForEach(m_Sinks.GetBegin(), m_Sinks.GetEnd(), [&](const auto& sink)
+        {
+            try
+            {
+                sink->Flush();
+            }
+            catch (...)
+            {
+                KeepSinkError();
+            }
+        });
+    }
+
+    void AsyncLogSink::KeepSinkError()
+    {
+        LockGuard guard(m_SinkErrorLock);
+        if (!m_SinkError)
+            m_SinkError = std::current_exception();
+    }
+}
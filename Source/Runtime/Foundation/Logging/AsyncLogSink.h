@@ -0,0 +1,155 @@
+#pragma once
+
+#include <exception>
+#include <initializer_list>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Logging/ILogSink.h"
+#include "Foundation/Logging/LogMessage.h"
+
+#include "Foundation/Memory/ScopedPtr.h"
+#include "Foundation/Memory/SharedPtr.h"
+#include "Foundation/Containers/SmallArray.h"
+
+#include "Foundation/Threading/Event.h"
+#include "Foundation/Threading/Mutex.h"
+#include "Foundation/Threading/Thread.h"
+#include "Foundation/Threading/SpinLock.h"
+#include "Foundation/Threading/Interlocked.h"
+
+namespace Kitsune
+{
+    // What AsyncLogSink::Log() does with a message when the queue is full.
+    enum class LogOverflowPolicy
+    {
+        Block,          // Wait for the worker to make room for it.
+        Drop,           // Throw it away.
+        DropAndCount    // Throw it away, the sinks get told how many were lost.
+    };
+
+    // Moves the sinks it wraps onto a worker thread of their own. Log() only copies the
+    // message into a lock-free queue shared by every thread that logs, the worker takes
+    // them out in batches and hands them to the sinks, so a slow terminal or file never
+    // holds up the threads that log.
+    //
+    // Flush() returns once everything logged before it reached the sinks and they were
+    // flushed, destroying the sink drains the queue the same way. The first exception a sink
+    // throws on the worker gets rethrown by the next Flush(), the ones after it until then
+    // are dropped.
+    class AsyncLogSink : public ILogSink
+    {
+    public:
+        using SinkArray = SmallArray<SharedPtr<ILogSink>, 2>;
+
+        // Messages the queue holds, rounded up to a power of two.
+        static constexpr Usize s_DefaultCapacity = 8192;
+
+    public:
+        KITSUNE_API_ AsyncLogSink(const SharedPtr<ILogSink>& sink, Usize capacity = s_DefaultCapacity,
+                                  LogOverflowPolicy policy = LogOverflowPolicy::Block);
+
+        KITSUNE_API_ AsyncLogSink(std::initializer_list<SharedPtr<ILogSink>> sinks,
+                                  Usize capacity = s_DefaultCapacity,
+                                  LogOverflowPolicy policy = LogOverflowPolicy::Block);
+
+        KITSUNE_API_ ~AsyncLogSink() override;
+
+    public:
+        AsyncLogSink(const AsyncLogSink&) = delete;
+        AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+    public:
+        KITSUNE_API_ void Log(const LogMessage& message) override;
+        KITSUNE_API_ void Flush() override;
+
+    public:
+        // Only ever read by the worker, they can't be changed once it's running.
+        [[nodiscard]] inline const SinkArray& GetSinks() const { return m_Sinks; }
+
+        [[nodiscard]] inline Usize GetCapacity() const { return m_Capacity; }
+        [[nodiscard]] inline LogOverflowPolicy GetOverflowPolicy() const { return m_Policy; }
+
+        // Messages thrown away so far, only counted with LogOverflowPolicy::DropAndCount.
+        [[nodiscard]] inline Int64 GetDroppedCount() const
+        {
+            return Interlocked::Load(&m_DroppedCount);
+        }
+
+    private:
+        // The logger name and the message get copied in one after the other, into `Text`
+        // if they fit and into a block of their own otherwise.
+        struct Slot
+        {
+            volatile Int64 Sequence;
+
+            SourceLocation Location;
+            LogSeverity Severity;
+
+            Uint32 NameSize;
+            Usize MessageSize;
+
+            char* HeapText;
+            char Text[192];
+        };
+
+        struct SlotsDeleter
+        {
+            using ValueType = Slot;
+            void operator()(Slot* slots) { Memory::Free(slots); }
+        };
+
+    private:
+        [[nodiscard]] static ScopedPtr<Slot, SlotsDeleter> MakeSlots(Usize capacity);
+
+        [[nodiscard]] bool TryClaimSlot(Int64& position);
+        [[nodiscard]] bool HasFreeSlot() const;
+        void WaitForFreeSlot();
+
+        void WakeWorker();
+
+    private:
+        static void RunWorker(void* userData);
+        void WorkerLoop();
+
+        Usize Drain(Int64 target, bool waitForWriters);
+        void ReportDropped();
+
+        void LogToSinks(const LogMessage& message);
+        void FlushSinks();
+        void KeepSinkError();
+
+    private:
+        volatile Int64 m_EnqueuePosition = 0;
+        [[maybe_unused]] char m_EnqueuePadding[64];     // Keeps the producers' counter on its own cache line.
+
+        Usize m_Capacity;
+        ScopedPtr<Slot, SlotsDeleter> m_Slots;     // Freed even if the worker fails to start.
+        LogOverflowPolicy m_Policy;
+
+        SinkArray m_Sinks;
+
+        Int64 m_DequeuePosition = 0;            // Worker only.
+        Int64 m_ReportedDropped = 0;            // Worker only.
+
+        volatile Int64 m_DroppedCount = 0;
+        volatile Int64 m_FlushRequests = 0;
+        volatile Int64 m_FlushesDone = 0;
+
+        volatile Int32 m_WorkerWaiting = 0;
+        volatile Int32 m_BlockedProducers = 0;
+        volatile Int32 m_Stopping = 0;
+
+        Event m_WorkEvent;
+        Event m_SpaceEvent;
+        Event m_FlushedEvent;
+        Mutex m_FlushLock;
+
+        SpinLock m_SinkErrorLock;
+        std::exception_ptr m_SinkError;
+
+        // Last, everything above has to be set up before the worker starts.
+        Thread m_Worker;
+    };
+}
@@ -3,16 +3,21 @@
 #include "Foundation/Logging/ILogSink.h"
 #include "Foundation/Logging/LogMessage.h"
 
-#include "Foundation/String/String.h"
+#include "Foundation/String/Name.h"
+#include "Foundation/String/Format.h"
 #include "Foundation/Memory/SharedPtr.h"
 
-#include "Foundation/Containers/Array.h"
+#include "Foundation/Containers/SmallArray.h"
 #include "Foundation/Algorithms/ForEach.h"
 
 namespace Kitsune
 {
     class Logger
     {
+    public:
+        // Most loggers only ever write to one or two sinks, no need to allocate for those.
+        using SinkArray = SmallArray<SharedPtr<ILogSink>, 2>;
+
     public:
         Logger() = default;
         inline Logger(const StringView name)
@@ -69,26 +74,28 @@ namespace Kitsune
         }
 
         template<typename... Args>
-        void LogFormat(LogSeverity severity, SourceLocation loc, const StringView fmt, Args&&... args)
+        void LogFormat(LogSeverity severity, SourceLocation loc, const FormatString<Args...>& fmt, Args&&... args)
         {
+            if (!IsLogged(severity)) return;
+
             String formatted = Format(fmt, Forward<Args>(args)...);
             Log(severity, Move(loc), formatted);
         }
 
         template<typename... Args>
-        KITSUNE_FORCEINLINE void LogFormat(LogSeverity severity, const StringView fmt, Args&&... args)
+        KITSUNE_FORCEINLINE void LogFormat(LogSeverity severity, const FormatString<Args...>& fmt, Args&&... args)
         {
-            LogFormat(severity, fmt, Forward<Args>(args)...);
+            LogFormat(severity, SourceLocation(), fmt, Forward<Args>(args)...);
         }
 
         template<typename... Args>
-        KITSUNE_FORCEINLINE void LogFormat(SourceLocation loc, const StringView fmt, Args&&... args)
+        KITSUNE_FORCEINLINE void LogFormat(SourceLocation loc, const FormatString<Args...>& fmt, Args&&... args)
         {
             LogFormat(m_MinSeverity, Move(loc), fmt, Forward<Args>(args)...);
         }
 
         template<typename... Args>
-        KITSUNE_FORCEINLINE void LogFormat(const StringView fmt, Args&&... args)
+        KITSUNE_FORCEINLINE void LogFormat(const FormatString<Args...>& fmt, Args&&... args)
         {
             LogFormat(m_MinSeverity, SourceLocation(), fmt, Forward<Args>(args)...);
         }
@@ -105,10 +112,10 @@ namespace Kitsune
         inline bool IsFlushed(LogSeverity severity) const { return (severity >= m_FlushSeverity); }
 
     public:
-        inline String GetName() const { return m_Name; }
+        inline Name GetName() const { return m_Name; }
 
-        inline Array<SharedPtr<ILogSink>>& GetSinks()             { return m_Sinks; }
-        inline const Array<SharedPtr<ILogSink>>& GetSinks() const { return m_Sinks; }
+        inline SinkArray& GetSinks()             { return m_Sinks; }
+        inline const SinkArray& GetSinks() const { return m_Sinks; }
 
         inline LogSeverity GetMinimumSeverity() const { return m_MinSeverity; }
         inline LogSeverity GetFlushSeverity() const { return m_FlushSeverity; }
@@ -124,8 +131,8 @@ namespace Kitsune
         }
 
     private:
-        String m_Name;
-        Array<SharedPtr<ILogSink>> m_Sinks;
+        Name m_Name;
+        SinkArray m_Sinks;
 
         LogSeverity m_MinSeverity = LogSeverity::Trace;
         LogSeverity m_FlushSeverity = LogSeverity::Warning;
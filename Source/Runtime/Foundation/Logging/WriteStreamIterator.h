@@ -25,6 +25,12 @@ namespace Kitsune
             return *this;
         }
 
+        // Whole runs go to the stream in one call, see BulkWritableIterator.
+        inline void Write(const T* data, Usize count)
+        {
+            m_Stream->Write(data, count);
+        }
+
     public:
         inline WriteStreamIterator& operator++()   { return *this; }
         inline WriteStreamIterator operator++(int) { return *this; }
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+#include "Foundation/Common/Predefined.h"
+
+#if defined(KITSUNE_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
+
+namespace Kitsune
+{
+    struct Product128
+    {
+        Uint64 High;
+        Uint64 Low;
+    };
+
+    // Schoolbook multiply on 32-bit halves, for targets without a wide multiply.
+    constexpr Product128 MultiplyWidePortable(Uint64 lhs, Uint64 rhs)
+    {
+        Uint64 lhsLow = lhs & 0xFFFF'FFFF;
+        Uint64 lhsHigh = lhs >> 32;
+        Uint64 rhsLow = rhs & 0xFFFF'FFFF;
+        Uint64 rhsHigh = rhs >> 32;
+
+        Uint64 lowLow = lhsLow * rhsLow;
+        Uint64 lowHigh = lhsLow * rhsHigh;
+        Uint64 highLow = lhsHigh * rhsLow;
+        Uint64 highHigh = lhsHigh * rhsHigh;
+
+        // Can't overflow, each term is at most 2^32 - 1.
+        Uint64 middle = (lowLow >> 32) + (lowHigh & 0xFFFF'FFFF) + (highLow & 0xFFFF'FFFF);
+
+        return { highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32),
+                 (middle << 32) | (lowLow & 0xFFFF'FFFF) };
+    }
+
+    // Full 128-bit product of two 64-bit integers.
+    KITSUNE_FORCEINLINE Product128 MultiplyWide(Uint64 lhs, Uint64 rhs)
+    {
+#if defined(__SIZEOF_INT128__)
+        using Uint128 = unsigned __int128;
+
+        Uint128 product = static_cast<Uint128>(lhs) * rhs;
+        return { static_cast<Uint64>(product >> 64), static_cast<Uint64>(product) };
+#elif defined(KITSUNE_COMPILER_MSVC) && defined(KITSUNE_ARCH_X86_64)
+        Uint64 high;
+        Uint64 low = _umul128(lhs, rhs, &high);
+
+        return { high, low };
+#elif defined(KITSUNE_COMPILER_MSVC) && defined(KITSUNE_ARCH_AARCH64)
+        return { __umulh(lhs, rhs), lhs * rhs };
+#else
+        return MultiplyWidePortable(lhs, rhs);
+#endif
+    }
+}
@@ -24,4 +24,22 @@ namespace Kitsune
             { alloc1 != alloc2 } -> std::convertible_to<bool>;
             { alloc2 != alloc1 } -> std::convertible_to<bool>;
         };
+
+    // Allocators that can try to resize a block without moving it.
+    template<typename T>
+    concept ExpandableAllocator =
+        Allocator<T> &&
+        requires (T& alloc, void* ptr, Usize size)
+        {
+            { alloc.TryExpand(ptr, size) } -> std::convertible_to<bool>;
+        };
+
+    // Allocators that can resize a block realloc()-style, moving its bytes if they have to.
+    template<typename T>
+    concept ReallocatableAllocator =
+        Allocator<T> &&
+        requires (T& alloc, void* ptr, Usize size, Usize align)
+        {
+            { alloc.TryReallocate(ptr, size, align) } -> std::convertible_to<void*>;
+        };
 }
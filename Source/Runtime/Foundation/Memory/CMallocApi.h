@@ -5,6 +5,10 @@
 
 #include "Foundation/Memory/IMemoryApi.h"
 
+#if defined(KITSUNE_OS_LINUX)
+    #include <malloc.h>
+#endif
+
 namespace Kitsune
 {
     class CMallocApi : public IMemoryApi
@@ -17,7 +21,8 @@ namespace Kitsune
     #if defined(KITSUNE_OS_WINDOWS)
             return ::_aligned_malloc(bytes, alignment);
     #else
-            return std::aligned_alloc(alignment, size);
+            // aligned_alloc() wants the size to be a multiple of the alignment.
+            return std::aligned_alloc(alignment, (bytes + alignment - 1) & ~(alignment - 1));
     #endif
         }
 
@@ -30,6 +35,33 @@ namespace Kitsune
 #endif
         }
 
+        inline bool TryExpand(void* ptr, Usize bytes) override
+        {
+            // Nothing can grow a block in place, but it might already be big enough.
+    #if defined(KITSUNE_OS_LINUX)
+            return (ptr != nullptr) && (::malloc_usable_size(ptr) >= bytes);
+    #else
+            KITSUNE_UNUSED(ptr);
+            KITSUNE_UNUSED(bytes);
+
+            return false;
+    #endif
+        }
+
+        inline void* TryReallocate(void* ptr, Usize bytes, Usize alignment) override
+        {
+            // realloc(ptr, 0) might free the block.
+            if (bytes == 0) return nullptr;
+
+    #if defined(KITSUNE_OS_WINDOWS)
+            return ::_aligned_realloc(ptr, bytes, alignment);
+    #else
+            // realloc() only keeps the fundamental alignment, but large blocks get mremap()'d
+            // instead of copied.
+            return (alignment <= s_DefaultAlignment) ? std::realloc(ptr, bytes) : nullptr;
+    #endif
+        }
+
         inline Usize GetDefaultAlignment() const override { return s_DefaultAlignment; }
 
     private:
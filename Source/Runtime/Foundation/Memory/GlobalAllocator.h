@@ -32,6 +32,16 @@ namespace Kitsune
         {
             Memory::Free(ptr);
         }
+
+        bool TryExpand(void* ptr, Usize bytes)
+        {
+            return Memory::TryExpand(ptr, bytes);
+        }
+
+        void* TryReallocate(void* ptr, Usize bytes, Usize align)
+        {
+            return Memory::TryReallocate(ptr, bytes, align);
+        }
     };
 
     inline bool operator==(const GlobalAllocator&, const GlobalAllocator&) { return true; }
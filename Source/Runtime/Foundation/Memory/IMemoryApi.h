@@ -15,6 +15,29 @@ namespace Kitsune
         virtual void* TryAllocate(Usize bytes, Usize alignment) = 0;
         virtual void Free(void* ptr) = 0;
 
+    public:
+        // Tries to resize a block without moving it. Backends which can't tell just say no,
+        // the caller then has to fall back to a new allocation.
+        virtual bool TryExpand(void* ptr, Usize bytes)
+        {
+            KITSUNE_UNUSED(ptr);
+            KITSUNE_UNUSED(bytes);
+
+            return false;
+        }
+
+        // Resizes a block the way realloc() does, its contents might get moved bitwise, so it's
+        // only fit for trivially copyable data. On failure, nullptr is returned and the block is
+        // left untouched; `alignment` has to be the one the block was allocated with.
+        virtual void* TryReallocate(void* ptr, Usize bytes, Usize alignment)
+        {
+            KITSUNE_UNUSED(ptr);
+            KITSUNE_UNUSED(bytes);
+            KITSUNE_UNUSED(alignment);
+
+            return nullptr;
+        }
+
     public:
         virtual Usize GetDefaultAlignment() const = 0;
 
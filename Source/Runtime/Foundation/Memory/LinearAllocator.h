@@ -0,0 +1,250 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Memory/Memory.h"
+#include "Foundation/Templates/Exchange.h"
+
+namespace Kitsune
+{
+    // Bump-pointer arena for short-lived allocations. Memory is only handed back in bulk,
+    // either up to a marker through Rewind() or everything at once through Reset().
+    //
+    // When the current block runs out a new one gets chained from Memory, the largest
+    // block given back is kept around so steady per-frame usage stops hitting the heap.
+    class LinearArena
+    {
+    public:
+        struct Marker
+        {
+            void* Block;
+            Uint8* Cursor;
+        };
+
+    public:
+        inline explicit LinearArena(Usize blockSize = s_DefaultBlockSize)
+            : m_Buffer(nullptr), m_BufferSize(0), m_BlockSize(blockSize),
+              m_Blocks(nullptr), m_Spare(nullptr),
+              m_Cursor(nullptr), m_End(nullptr), m_LastAllocation(nullptr)
+        {
+        }
+
+        // Serves allocations out of an external buffer (e.g. on the stack) until it's full.
+        inline LinearArena(void* buffer, Usize size, Usize blockSize = s_DefaultBlockSize)
+            : m_Buffer(static_cast<Uint8*>(buffer)), m_BufferSize(size), m_BlockSize(blockSize),
+              m_Blocks(nullptr), m_Spare(nullptr),
+              m_Cursor(m_Buffer), m_End(m_Buffer + size), m_LastAllocation(nullptr)
+        {
+        }
+
+        inline ~LinearArena()
+        {
+            Rewind({ nullptr, m_Buffer });
+            FreeBlock(m_Spare);
+        }
+
+    public:
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+    public:
+        [[nodiscard]]
+        inline void* Allocate(Usize bytes, Usize alignment = s_DefaultAlignment)
+        {
+            Uintptr end = reinterpret_cast<Uintptr>(m_End);
+            Uintptr aligned = AlignUp(reinterpret_cast<Uintptr>(m_Cursor), alignment);
+
+            Uint8* ptr = (m_Cursor == nullptr || aligned > end || bytes > end - aligned) ?
+                         AllocateFromNewBlock(bytes, alignment) :
+                         reinterpret_cast<Uint8*>(aligned);
+
+            m_Cursor = ptr + bytes;
+            m_LastAllocation = ptr;
+
+            return ptr;
+        }
+
+        // Only the most recent allocation can actually be given back, anything else
+        // stays in use until the next Rewind() or Reset().
+        inline void Free(void* ptr)
+        {
+            if (ptr != nullptr && ptr == m_LastAllocation)
+            {
+                m_Cursor = m_LastAllocation;
+                m_LastAllocation = nullptr;
+            }
+        }
+
+        // Only the most recent allocation can grow, and only as far as the current block goes.
+        inline bool TryExpand(void* ptr, Usize bytes)
+        {
+            if (ptr == nullptr || ptr != m_LastAllocation)
+                return false;
+
+            if (bytes > static_cast<Usize>(m_End - m_LastAllocation))
+                return false;
+
+            m_Cursor = m_LastAllocation + bytes;
+            return true;
+        }
+
+    public:
+        [[nodiscard]] inline Marker GetMarker() const { return { m_Blocks, m_Cursor }; }
+
+        // Markers have to be rewound to in the reverse order they were taken.
+        inline void Rewind(const Marker& marker)
+        {
+            while (m_Blocks != marker.Block)
+                RetireBlock(Exchange(m_Blocks, m_Blocks->Previous));
+
+            m_Cursor = marker.Cursor;
+            m_End = (m_Blocks != nullptr) ? reinterpret_cast<Uint8*>(m_Blocks) + m_Blocks->Size :
+                                            m_Buffer + m_BufferSize;
+
+            m_LastAllocation = nullptr;
+        }
+
+        inline void Reset()
+        {
+            // Took more than one block, make the next one big enough to hold all of it.
+            if (m_Blocks != nullptr && m_Blocks->Previous != nullptr)
+            {
+                Usize total = 0;
+                for (BlockHeader* block = m_Blocks; block; block = block->Previous)
+                    total += block->Size;
+
+                m_BlockSize = KITSUNE_MAX(m_BlockSize, total);
+            }
+
+            Rewind({ nullptr, m_Buffer });
+        }
+
+    public:
+        [[nodiscard]] inline Usize GetBlockSize() const { return m_BlockSize; }
+
+    public:
+        static constexpr Usize s_DefaultAlignment = alignof(std::max_align_t);
+        static constexpr Usize s_DefaultBlockSize = 64 * 1024;
+
+    private:
+        struct alignas(std::max_align_t) BlockHeader
+        {
+            BlockHeader* Previous;
+            Usize Size;
+        };
+
+    private:
+        KITSUNE_FORCEINLINE static Uintptr AlignUp(Uintptr value, Usize alignment)
+        {
+            return (value + alignment - 1) & ~Uintptr(alignment - 1);
+        }
+
+        KITSUNE_NOINLINE Uint8* AllocateFromNewBlock(Usize bytes, Usize alignment)
+        {
+            Usize required = sizeof(BlockHeader) + bytes + alignment;
+
+            BlockHeader* block = Exchange(m_Spare, nullptr);
+            if (block == nullptr || block->Size < required)
+            {
+                FreeBlock(block);
+
+                Usize size = KITSUNE_MAX(m_BlockSize, required);
+                block = static_cast<BlockHeader*>(Memory::Allocate(size, alignof(BlockHeader)));
+                block->Size = size;
+            }
+
+            block->Previous = m_Blocks;
+            m_Blocks = block;
+
+            m_End = reinterpret_cast<Uint8*>(block) + block->Size;
+            return reinterpret_cast<Uint8*>(AlignUp(reinterpret_cast<Uintptr>(block + 1), alignment));
+        }
+
+        inline void RetireBlock(BlockHeader* block)
+        {
+            if (m_Spare != nullptr && m_Spare->Size >= block->Size)
+                return FreeBlock(block);
+
+            FreeBlock(Exchange(m_Spare, block));
+        }
+
+        inline static void FreeBlock(BlockHeader* block)
+        {
+            if (block != nullptr)
+                Memory::Free(block);
+        }
+
+    private:
+        Uint8* m_Buffer;
+        Usize m_BufferSize;
+        Usize m_BlockSize;
+
+        BlockHeader* m_Blocks;
+        BlockHeader* m_Spare;
+
+        Uint8* m_Cursor;
+        Uint8* m_End;
+        Uint8* m_LastAllocation;
+    };
+
+    // Allocator handle to a LinearArena, copies share the same arena. A default
+    // constructed LinearAllocator isn't bound to any arena and forwards to Memory.
+    class LinearAllocator
+    {
+    public:
+        LinearAllocator() = default;
+        explicit LinearAllocator(LinearArena& arena) : m_Arena(&arena) { /* ... */ }
+
+        LinearAllocator(const LinearAllocator&) = default;
+        LinearAllocator(LinearAllocator&&) = default;
+        ~LinearAllocator() = default;
+
+    public:
+        LinearAllocator& operator=(const LinearAllocator&) = default;
+        LinearAllocator& operator=(LinearAllocator&&) = default;
+
+    public:
+        void* Allocate(Usize bytes)
+        {
+            return (m_Arena != nullptr) ? m_Arena->Allocate(bytes) : Memory::Allocate(bytes);
+        }
+
+        void* Allocate(Usize bytes, Usize align)
+        {
+            return (m_Arena != nullptr) ? m_Arena->Allocate(bytes, align) :
+                                          Memory::Allocate(bytes, align);
+        }
+
+        void Free(void* ptr)
+        {
+            if (m_Arena != nullptr)
+                m_Arena->Free(ptr);
+            else
+                Memory::Free(ptr);
+        }
+
+        bool TryExpand(void* ptr, Usize bytes)
+        {
+            return (m_Arena != nullptr) ? m_Arena->TryExpand(ptr, bytes) : Memory::TryExpand(ptr, bytes);
+        }
+
+    public:
+        [[nodiscard]] inline LinearArena* GetArena() const { return m_Arena; }
+
+    private:
+        LinearArena* m_Arena = nullptr;
+    };
+
+    inline bool operator==(const LinearAllocator& alloc1, const LinearAllocator& alloc2)
+    {
+        return (alloc1.GetArena() == alloc2.GetArena());
+    }
+
+    inline bool operator!=(const LinearAllocator& alloc1, const LinearAllocator& alloc2)
+    {
+        return (alloc1.GetArena() != alloc2.GetArena());
+    }
+}
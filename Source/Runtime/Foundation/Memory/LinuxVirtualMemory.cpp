@@ -0,0 +1,68 @@
+#include "Foundation/Memory/VirtualMemory.h"
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+namespace Kitsune
+{
+    namespace
+    {
+        inline Usize RoundToPageSize(Usize bytes)
+        {
+            Usize pageSize = VirtualMemory::GetPageSize();
+            return (bytes + pageSize - 1) & ~(pageSize - 1);
+        }
+    }
+
+    Usize VirtualMemory::GetPageSize()
+    {
+        static const Usize pageSize = static_cast<Usize>(::sysconf(_SC_PAGESIZE));
+        return pageSize;
+    }
+
+    Usize VirtualMemory::GetHugePageSize()
+    {
+#if defined(MADV_HUGEPAGE)
+        // Transparent huge pages are PMD sized, which is 2MiB on everything we run on.
+        return KITSUNE_MAX(GetPageSize(), Usize(2 * 1024 * 1024));
+#else
+        return GetPageSize();
+#endif
+    }
+
+    void* VirtualMemory::Reserve(Usize bytes)
+    {
+        void* address = ::mmap(nullptr, RoundToPageSize(bytes), PROT_NONE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+        return (address != MAP_FAILED) ? address : nullptr;
+    }
+
+    void VirtualMemory::Release(void* address, Usize bytes)
+    {
+        if (address != nullptr)
+            ::munmap(address, RoundToPageSize(bytes));
+    }
+
+    bool VirtualMemory::Commit(void* address, Usize bytes)
+    {
+        return (::mprotect(address, bytes, PROT_READ | PROT_WRITE) == 0);
+    }
+
+    void VirtualMemory::Decommit(void* address, Usize bytes)
+    {
+        // Mapping fresh PROT_NONE pages over the range drops both the backing memory and
+        // its commit charge, which madvise(MADV_DONTNEED) alone wouldn't.
+        ::mmap(address, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+    }
+
+    void VirtualMemory::AdviseHugePages(void* address, Usize bytes)
+    {
+#if defined(MADV_HUGEPAGE)
+        ::madvise(address, bytes, MADV_HUGEPAGE);
+#else
+        KITSUNE_UNUSED(address);
+        KITSUNE_UNUSED(bytes);
+#endif
+    }
+}
@@ -1,25 +1,62 @@
 #include "Foundation/Memory/Memory.h"
 
 #include "Foundation/Memory/CMallocApi.h"
+#include "Foundation/Memory/TrackingMemoryApi.h"
+#include "Foundation/Memory/ThreadCachingMemoryApi.h"
 #include "Foundation/Memory/BadAllocException.h"
 
 namespace Kitsune
 {
     IMemoryApi* Memory::s_MemoryApi = nullptr;
+    TrackingMemoryApi* Memory::s_Tracker = nullptr;
     bool Memory::s_Initialized = false;
 
-    void Memory::InitializeExplicit()
+    void Memory::InitializeExplicit(MemoryBackend backend, MemoryTracking tracking)
     {
         if (s_Initialized) return;          // Might be called more than once..
 
-        s_MemoryApi = new (std::nothrow) CMallocApi();
+        switch (backend)
+        {
+        case MemoryBackend::ThreadCaching:
+            s_MemoryApi = new (std::nothrow) ThreadCachingMemoryApi();
+            break;
+
+        case MemoryBackend::CMalloc:
+        default:
+            s_MemoryApi = new (std::nothrow) CMallocApi();
+            break;
+        }
+
         if (s_MemoryApi == nullptr) throw BadAllocException();
 
+        if (tracking != MemoryTracking::Disabled)
+        {
+            s_Tracker = new (std::nothrow) TrackingMemoryApi(s_MemoryApi,
+                                                             tracking == MemoryTracking::TagBreakdown);
+            if (s_Tracker == nullptr)
+            {
+                delete s_MemoryApi;
+                throw BadAllocException();
+            }
+
+            s_MemoryApi = s_Tracker;
+        }
+
         s_Initialized = true;
     }
 
     void Memory::Shutdown()
     {
+        if (s_Tracker != nullptr)
+        {
+            s_Tracker->ReportLeaks();
+            s_Tracker = nullptr;
+
+            // Every block it handed out starts after its header, so it has to keep serving the
+            // frees that still come in after this. Never deleted, it just passes them through.
+            return;
+        }
+
         delete s_MemoryApi;
         s_Initialized = false;
     }
@@ -58,4 +95,16 @@ namespace Kitsune
         if (!s_Initialized) Memory::InitializeExplicit();
         s_MemoryApi->Free(ptr);
     }
+
+    bool Memory::TryExpand(void* ptr, Usize bytes)
+    {
+        if (!s_Initialized) Memory::InitializeExplicit();
+        return s_MemoryApi->TryExpand(ptr, bytes);
+    }
+
+    void* Memory::TryReallocate(void* ptr, Usize bytes, Usize alignment)
+    {
+        if (!s_Initialized) Memory::InitializeExplicit();
+        return s_MemoryApi->TryReallocate(ptr, bytes, alignment);
+    }
 }
@@ -11,10 +11,32 @@
 
 namespace Kitsune
 {
+    enum class MemoryBackend
+    {
+        CMalloc,
+
+        // Its blocks are gone once Memory::Shutdown() returns, everything allocated through it
+        // has to be freed before then. With tracking enabled the tracker keeps it alive.
+        ThreadCaching
+    };
+
+    enum class MemoryTracking
+    {
+        Disabled,
+        Statistics,         // Counters and the size histogram only.
+        TagBreakdown        // Statistics, plus a breakdown per MemoryTagScope.
+    };
+
+    class TrackingMemoryApi;
+
     class Memory
     {
     public:
-        KITSUNE_API_ static void InitializeExplicit();
+        KITSUNE_API_ static void InitializeExplicit(MemoryBackend backend = MemoryBackend::CMalloc,
+                                                    MemoryTracking tracking = MemoryTracking::Disabled);
+
+        // Reports leaks when tracking is enabled. The tracker then stays in place for the rest
+        // of the program (GetTracker() returns null), memory can still be freed through it.
         KITSUNE_API_ static void Shutdown();
 
     public:
@@ -26,6 +48,10 @@ namespace Kitsune
 
         KITSUNE_API_ static void Free(void* ptr);
 
+    public:
+        [[nodiscard]] KITSUNE_API_ static bool TryExpand(void* ptr, Usize bytes);
+        [[nodiscard]] KITSUNE_API_ static void* TryReallocate(void* ptr, Usize bytes, Usize alignment);
+
     public:
         [[nodiscard]]
         static inline Usize GetDefaultAlignment()
@@ -33,6 +59,13 @@ namespace Kitsune
             return s_MemoryApi->GetDefaultAlignment();
         }
 
+        // Null unless the memory subsystem was initialized with tracking enabled.
+        [[nodiscard]]
+        static inline TrackingMemoryApi* GetTracker()
+        {
+            return s_Tracker;
+        }
+
     public:
         template<typename T, typename... Args>
             requires std::is_constructible_v<T, Args...>
@@ -66,5 +99,6 @@ namespace Kitsune
     private:
         static bool s_Initialized;
         KITSUNE_API_ static IMemoryApi* s_MemoryApi;
+        KITSUNE_API_ static TrackingMemoryApi* s_Tracker;
     };
 }
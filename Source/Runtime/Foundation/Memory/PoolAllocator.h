@@ -0,0 +1,243 @@
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <type_traits>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Memory/Memory.h"
+#include "Foundation/Memory/CMallocApi.h"
+#include "Foundation/Memory/BadAllocException.h"
+#include "Foundation/Templates/Exchange.h"
+
+#include "Foundation/Threading/SpinLock.h"
+#include "Foundation/Threading/LockGuard.h"
+#include "Foundation/Threading/ThreadSafety.h"
+
+#include "Foundation/Diagnostics/InvalidArgumentException.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        class NullLock
+        {
+        public:
+            constexpr NullLock() = default;
+
+        public:
+            KITSUNE_FORCEINLINE void Acquire() { /* ... */ }
+            KITSUNE_FORCEINLINE bool TryAcquire() { return true; }
+            KITSUNE_FORCEINLINE void Release() { /* ... */ }
+        };
+
+        template<ThreadSafety Mode>
+        using PoolLock = std::conditional_t<Mode == ThreadSafety::ThreadSafe, SpinLock, NullLock>;
+    }
+
+    // Hands out fixed-size blocks from chunks allocated through Memory. Freed blocks are
+    // threaded onto an intrusive free list, so both Allocate() and Free() are O(1) and the
+    // pool never fragments. Chunks are only given back when the pool itself is destroyed.
+    //
+    // Fresh chunks are carved lazily and every new chunk is twice the size of the previous
+    // one (up to s_MaxChunkBlocks), so small pools stay small and busy ones touch the heap
+    // less and less often.
+    template<Usize Size, Usize Align = alignof(std::max_align_t),
+             ThreadSafety Mode = ThreadSafety::NotThreadSafe>
+    class MemoryPool
+    {
+    public:
+        static_assert(Size > 0, "The block size must be greater than zero.");
+        static_assert((Align & (Align - 1)) == 0, "The alignment must be a power of two.");
+
+        static constexpr Usize s_BlockAlignment = KITSUNE_MAX(Align, alignof(void*));
+        static constexpr Usize s_BlockSize =
+            (KITSUNE_MAX(Size, sizeof(void*)) + s_BlockAlignment - 1) & ~(s_BlockAlignment - 1);
+
+        static constexpr Usize s_MinChunkBlocks = 16;
+        static constexpr Usize s_MaxChunkBlocks = KITSUNE_MAX(s_MinChunkBlocks, 64 * 1024 / s_BlockSize);
+
+    public:
+        inline explicit MemoryPool(Usize blocksPerChunk = s_MinChunkBlocks)
+            : MemoryPool(blocksPerChunk, /* System chunks: */ false)
+        {
+        }
+
+        inline ~MemoryPool()
+        {
+            while (m_Chunks != nullptr)
+                FreeChunk(Exchange(m_Chunks, m_Chunks->Next));
+        }
+
+    public:
+        MemoryPool(const MemoryPool&) = delete;
+        MemoryPool& operator=(const MemoryPool&) = delete;
+
+    public:
+        [[nodiscard]]
+        inline void* Allocate()
+        {
+            LockGuard guard(m_Lock);
+
+            if (m_FreeList != nullptr)
+                return Exchange(m_FreeList, m_FreeList->Next);
+
+            if (m_Cursor == m_End)
+                AllocateChunk();
+
+            return Exchange(m_Cursor, m_Cursor + s_BlockSize);
+        }
+
+        inline void Free(void* ptr)
+        {
+            if (ptr == nullptr)
+                return;
+
+            LockGuard guard(m_Lock);
+
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->Next = Exchange(m_FreeList, block);
+        }
+
+    public:
+        // Process-wide pool, shared by every PoolAllocator with the same block size. Only the
+        // thread-safe pools have one, unrelated users on different threads end up in it.
+        //
+        // It's never destroyed and takes its chunks straight from the C heap rather than from
+        // Memory, so blocks can still be allocated and freed after Memory::Shutdown().
+        static MemoryPool& GetShared()
+            requires (Mode == ThreadSafety::ThreadSafe)
+        {
+            alignas(MemoryPool) static Uint8 storage[sizeof(MemoryPool)];
+            static MemoryPool* pool = new (storage) MemoryPool(s_MinChunkBlocks, /* System chunks: */ true);
+
+            return *pool;
+        }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+        struct alignas(s_BlockAlignment) ChunkHeader
+        {
+            ChunkHeader* Next;
+        };
+
+    private:
+        inline MemoryPool(Usize blocksPerChunk, bool systemChunks)
+            : m_FreeList(nullptr), m_Chunks(nullptr), m_Cursor(nullptr), m_End(nullptr),
+              m_ChunkBlocks(KITSUNE_MAX(blocksPerChunk, Usize(1))), m_SystemChunks(systemChunks)
+        {
+        }
+
+    private:
+        KITSUNE_NOINLINE void AllocateChunk()
+        {
+            Usize bytes = sizeof(ChunkHeader) + m_ChunkBlocks * s_BlockSize;
+
+            ChunkHeader* chunk;
+            if (m_SystemChunks)
+            {
+                chunk = static_cast<ChunkHeader*>(CMallocApi().TryAllocate(bytes, alignof(ChunkHeader)));
+                if (chunk == nullptr) throw BadAllocException();
+            }
+            else
+            {
+                chunk = static_cast<ChunkHeader*>(Memory::Allocate(bytes, alignof(ChunkHeader)));
+            }
+
+            chunk->Next = Exchange(m_Chunks, chunk);
+
+            m_Cursor = reinterpret_cast<Uint8*>(chunk + 1);
+            m_End = m_Cursor + m_ChunkBlocks * s_BlockSize;
+
+            m_ChunkBlocks = KITSUNE_MAX(m_ChunkBlocks, KITSUNE_MIN(m_ChunkBlocks * 2, s_MaxChunkBlocks));
+        }
+
+        inline void FreeChunk(ChunkHeader* chunk)
+        {
+            if (m_SystemChunks)
+                CMallocApi().Free(chunk);
+            else
+                Memory::Free(chunk);
+        }
+
+    private:
+        KITSUNE_MAYBE_OVERLAPPING Internal::PoolLock<Mode> m_Lock;
+
+        FreeBlock* m_FreeList;
+        ChunkHeader* m_Chunks;
+
+        Uint8* m_Cursor;
+        Uint8* m_End;
+        Usize m_ChunkBlocks;
+        bool m_SystemChunks;
+    };
+
+    // Stateless allocator serving every request out of the shared MemoryPool for its block
+    // size, so it costs nothing to store inside containers and control blocks. Requests bigger
+    // or more aligned than the block throw an InvalidArgumentException.
+    //
+    // Every user in the process shares that pool, so it's always the thread-safe one. Own a
+    // NotThreadSafe MemoryPool instead to skip the lock for single-threaded use.
+    template<Usize Size, Usize Align = alignof(std::max_align_t)>
+    class PoolAllocator
+    {
+    public:
+        using PoolType = MemoryPool<Size, Align, ThreadSafety::ThreadSafe>;
+
+    public:
+        PoolAllocator() = default;
+        PoolAllocator(const PoolAllocator&) = default;
+        PoolAllocator(PoolAllocator&&) = default;
+        ~PoolAllocator() = default;
+
+    public:
+        PoolAllocator& operator=(const PoolAllocator&) = default;
+        PoolAllocator& operator=(PoolAllocator&&) = default;
+
+    public:
+        void* Allocate(Usize bytes)
+        {
+            if (bytes > Size)
+                throw InvalidArgumentException();
+
+            return PoolType::GetShared().Allocate();
+        }
+
+        void* Allocate(Usize bytes, Usize align)
+        {
+            if (bytes > Size || align > PoolType::s_BlockAlignment)
+                throw InvalidArgumentException();
+
+            return PoolType::GetShared().Allocate();
+        }
+
+        void Free(void* ptr)
+        {
+            PoolType::GetShared().Free(ptr);
+        }
+
+        // Every block is as big as it'll ever get.
+        bool TryExpand(void* ptr, Usize bytes)
+        {
+            return (ptr != nullptr) && (bytes <= Size);
+        }
+    };
+
+    template<Usize Size, Usize Align>
+    inline bool operator==(const PoolAllocator<Size, Align>&, const PoolAllocator<Size, Align>&)
+    {
+        return true;
+    }
+
+    template<Usize Size, Usize Align>
+    inline bool operator!=(const PoolAllocator<Size, Align>&, const PoolAllocator<Size, Align>&)
+    {
+        return false;
+    }
+}
@@ -10,6 +10,7 @@
 
 #include "Foundation/Algorithms/Swap.h"
 #include "Foundation/Templates/Exchange.h"
+#include "Foundation/Templates/IsTriviallyRelocatable.h"
 
 namespace Kitsune
 {
@@ -172,6 +173,9 @@ namespace Kitsune
         return (ptr1.Get() < ptr2.Get());
     }
 
+    template<typename T, Deleter Del>
+    inline constexpr bool IsTriviallyRelocatable<ScopedPtr<T, Del>> = IsTriviallyRelocatable<Del>;
+
     template<typename T, Deleter Del>
     inline bool operator==(std::nullptr_t, const ScopedPtr<T, Del>& ptr)
     {
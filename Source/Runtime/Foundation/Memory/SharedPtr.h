@@ -4,12 +4,15 @@
 #include "Foundation/Common/Macros.h"
 
 #include "Foundation/Memory/Deleter.h"
+#include "Foundation/Memory/AddressOf.h"
 #include "Foundation/Memory/Allocator.h"
 #include "Foundation/Memory/ScopedPtr.h"
+#include "Foundation/Memory/PoolAllocator.h"
 #include "Foundation/Memory/GlobalAllocator.h"
 
 #include "Foundation/Algorithms/Swap.h"
 #include "Foundation/Templates/Exchange.h"
+#include "Foundation/Templates/IsTriviallyRelocatable.h"
 
 #include "Foundation/Threading/Interlocked.h"
 #include "Foundation/Threading/ThreadSafety.h"
@@ -94,6 +97,11 @@ namespace Kitsune
             Int32 m_WeakCount;
         };
 
+        // Blocks are released by whichever thread drops the last reference, which the shared
+        // pools handle regardless of the SharedPtr's own mode.
+        static constexpr Usize s_ControlBlockSize = 32;
+        using ControlBlockAllocator = PoolAllocator<s_ControlBlockSize, alignof(void*)>;
+
         template<typename T, ThreadSafety Mode, Allocator Alloc, Deleter Del>
         class TypedReferenceCount : public ReferenceCountBase<Mode>
         {
@@ -127,6 +135,41 @@ namespace Kitsune
             KITSUNE_MAYBE_OVERLAPPING Del m_Deleter;
         };
 
+        // Control block used by MakeShared() and AllocateShared(), the value lives right
+        // after the reference counts so both end up in a single allocation.
+        template<typename T, ThreadSafety Mode, Allocator Alloc>
+        class InlineReferenceCount : public ReferenceCountBase<Mode>
+        {
+        public:
+            template<typename... Args>
+            inline InlineReferenceCount(const Alloc& alloc, Args&&... args)
+                : m_Allocator(alloc)
+            {
+                Memory::ConstructAt(AddressOf(m_Value), Forward<Args>(args)...);
+            }
+
+            inline ~InlineReferenceCount() { /* ... */ }
+
+        public:
+            inline T* GetPointer() { return AddressOf(m_Value); }
+
+        public:
+            inline void DeleteValue() { m_Value.~T(); }
+            inline void DeleteReferenceCount()
+            {
+                Alloc alloc = Move(m_Allocator);
+
+                this->~InlineReferenceCount();
+                alloc.Free(this);
+            }
+
+        private:
+            KITSUNE_MAYBE_OVERLAPPING Alloc m_Allocator;
+
+            // Lifetime is managed by hand, DeleteValue() may run long before the block dies.
+            union { T m_Value; };
+        };
+
         template<typename T>
         concept IsDeleterOrRef = Deleter<std::remove_reference_t<T>>;
 
@@ -155,7 +198,7 @@ namespace Kitsune
         inline explicit SharedPtr(U* ptr)
             : m_Pointer(ptr)
         {
-            AllocateInternalData(ptr, GlobalAllocator(), DefaultDeleter<U>());
+            AllocateDefaultInternalData(ptr, DefaultDeleter<U>());
         }
 
         template<typename U, Internal::IsDeleterOrRef Del>
@@ -163,7 +206,7 @@ namespace Kitsune
         inline SharedPtr(U* ptr, Del&& del)
             : m_Pointer(ptr)
         {
-            AllocateInternalData(ptr, GlobalAllocator(), Forward<Del>(del));
+            AllocateDefaultInternalData(ptr, Forward<Del>(del));
         }
 
         template<Internal::IsDeleterOrRef Del>
@@ -231,7 +274,7 @@ namespace Kitsune
         inline SharedPtr(ScopedPtr<U, Del>&& ptr)
             : m_Pointer(ptr.Get())
         {
-            AllocateInternalData(ptr.Release(), GlobalAllocator(), Move(ptr.GetDeleter()));
+            AllocateDefaultInternalData(ptr.Release(), Move(ptr.GetDeleter()));
         }
 
         inline ~SharedPtr()
@@ -307,6 +350,21 @@ namespace Kitsune
             return *this;
         }
 
+        // Control blocks for adopted pointers with a stateless deleter all have the same size,
+        // so they come out of a shared pool rather than the general purpose heap.
+        template<typename U, Internal::IsDeleterOrRef Del>
+        inline void AllocateDefaultInternalData(U* ptr, Del&& del)
+        {
+            using PureDel = std::remove_reference_t<Del>;
+            using PooledData = Internal::TypedReferenceCount<U, Mode, Internal::ControlBlockAllocator, PureDel>;
+
+            if constexpr (sizeof(PooledData) <= Internal::s_ControlBlockSize &&
+                          alignof(PooledData) <= alignof(void*))
+                AllocateInternalData(ptr, Internal::ControlBlockAllocator(), Forward<Del>(del));
+            else
+                AllocateInternalData(ptr, GlobalAllocator(), Forward<Del>(del));
+        }
+
         template<typename U, Internal::IsAllocatorOrRef Alloc, Internal::IsDeleterOrRef Del>
         inline void AllocateInternalData(U* ptr, Alloc&& alloc, Del&& del)
         {
@@ -327,19 +385,53 @@ namespace Kitsune
             }
         }
 
+    private:
+        // Adopts an already constructed control block, used by AllocateShared().
+        inline SharedPtr(T* ptr, Internal::ReferenceCountBase<Mode>* data)
+            : m_Pointer(ptr), m_Data(data)
+        {
+        }
+
     private:
         template<typename U, ThreadSafety UMode> friend class SharedPtr;
         template<typename U, ThreadSafety UMode> friend class WeakPtr;
 
+        template<typename U, Internal::IsAllocatorOrRef Alloc, typename... Args>
+        friend SharedPtr<U> AllocateShared(Alloc&& alloc, Args&&... args);
+
     private:
         T* m_Pointer;
         Internal::ReferenceCountBase<Mode>* m_Data;
     };
 
+    template<typename T, Internal::IsAllocatorOrRef Alloc, typename... Args>
+    [[nodiscard]] inline SharedPtr<T> AllocateShared(Alloc&& alloc, Args&&... args)
+    {
+        using PureAlloc = std::remove_cvref_t<Alloc>;
+        using InternalData = Internal::InlineReferenceCount<T, ThreadSafety::ThreadSafe, PureAlloc>;
+
+        // Keep our own copy around, the one inside the block is gone if T's constructor throws.
+        PureAlloc allocator(Forward<Alloc>(alloc));
+        void* memory = allocator.Allocate(sizeof(InternalData), alignof(InternalData));
+
+        try
+        {
+            InternalData* data = Memory::ConstructAt(static_cast<InternalData*>(memory),
+                                                     allocator, Forward<Args>(args)...);
+
+            return SharedPtr<T>(data->GetPointer(), data);
+        }
+        catch (...)
+        {
+            allocator.Free(memory);
+            throw;
+        }
+    }
+
     template<typename T, typename... Args>
     [[nodiscard]] inline SharedPtr<T> MakeShared(Args&&... args)
     {
-        return SharedPtr<T>(Memory::New<T>(Forward<Args>(args)...));
+        return AllocateShared<T>(GlobalAllocator(), Forward<Args>(args)...);
     }
 
     namespace Algorithms
@@ -573,6 +665,13 @@ namespace Kitsune
         Internal::ReferenceCountBase<Mode>* m_Data;
     };
 
+    // Both are just a pair of pointers, the control block never points back at them.
+    template<typename T, ThreadSafety Mode>
+    inline constexpr bool IsTriviallyRelocatable<SharedPtr<T, Mode>> = true;
+
+    template<typename T, ThreadSafety Mode>
+    inline constexpr bool IsTriviallyRelocatable<WeakPtr<T, Mode>> = true;
+
     namespace Algorithms
     {
         template<typename T, ThreadSafety Mode>
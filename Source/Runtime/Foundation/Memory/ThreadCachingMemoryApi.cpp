@@ -0,0 +1,487 @@
+#include "Foundation/Memory/ThreadCachingMemoryApi.h"
+
+#include <cstring>
+
+#include "Foundation/Memory/Memory.h"
+#include "Foundation/Threading/LockGuard.h"
+#include "Foundation/Threading/Interlocked.h"
+
+namespace Kitsune
+{
+    namespace
+    {
+        using Api = ThreadCachingMemoryApi;
+
+        constexpr Uint32 s_ClassSizes[Api::s_SizeClassCount] = {
+            16,   32,   48,   64,   80,   96,   112,  128,
+            160,  192,  224,  256,  320,  384,  448,  512,
+            640,  768,  896,  1024, 1280, 1536, 1792, 2048,
+            2560, 3072, 3584, 4096, 5120, 6144, 7168, 8192
+        };
+
+        struct SizeClassTable
+        {
+            Uint8 Classes[Api::s_MaxSmallSize / 16 + 1];
+            Uint32 BatchSizes[Api::s_SizeClassCount];
+        };
+
+        constexpr SizeClassTable MakeSizeClassTable()
+        {
+            SizeClassTable table = {};
+
+            Uint8 sizeClass = 0;
+            for (Usize i = 0; i < sizeof(table.Classes); ++i)
+            {
+                while (s_ClassSizes[sizeClass] < i * 16)
+                    ++sizeClass;
+
+                table.Classes[i] = sizeClass;
+            }
+
+            // Move roughly 8KiB worth of blocks between the thread and the central lists.
+            for (Usize i = 0; i < Api::s_SizeClassCount; ++i)
+                table.BatchSizes[i] = KITSUNE_MIN(KITSUNE_MAX(8192 / s_ClassSizes[i], 2u), 64u);
+
+            return table;
+        }
+
+        constexpr SizeClassTable s_SizeClassTable = MakeSizeClassTable();
+
+        // Every slab starts with one of these, blocks are laid out right after it.
+        struct SlabHeader
+        {
+            Uint32 SizeClass;
+            void* NextArena;            // Only used by the first slab of an arena.
+        };
+
+        constexpr Usize s_SlabHeaderSize = 64;
+        static_assert(sizeof(SlabHeader) <= s_SlabHeaderSize);
+
+        constexpr Usize s_ArenaShift = 22;
+        static_assert((Usize(1) << s_ArenaShift) == Api::s_ArenaSize);
+
+        constexpr Usize s_PageMapLeafSize = (Usize(1) << 13) / 64;
+
+        KITSUNE_FORCEINLINE void*& NextOf(void* block)
+        {
+            return *static_cast<void**>(block);
+        }
+
+        KITSUNE_FORCEINLINE SlabHeader* GetSlabHeader(void* ptr)
+        {
+            return reinterpret_cast<SlabHeader*>(reinterpret_cast<Uintptr>(ptr) & ~Uintptr(Api::s_SlabSize - 1));
+        }
+
+        KITSUNE_FORCEINLINE Uint32 GetSizeClass(Usize bytes, Usize alignment)
+        {
+            if (alignment > Api::s_DefaultAlignment)
+                bytes = (bytes + alignment - 1) & ~(alignment - 1);
+
+            Uint32 sizeClass = s_SizeClassTable.Classes[(bytes + 15) >> 4];
+            while (s_ClassSizes[sizeClass] % alignment != 0)
+                ++sizeClass;
+
+            return sizeClass;
+        }
+    }
+
+    namespace Internal
+    {
+        struct ThreadCacheFreeList
+        {
+            void* Head;
+            Uint32 Count;
+        };
+
+        struct ThreadCache
+        {
+            ThreadCacheFreeList Lists[Api::s_SizeClassCount];
+
+            ThreadCache* NextCache;
+            ThreadCache* NextFree;
+        };
+
+        // A thread may talk to more than one memory API (mostly in tests), so every thread
+        // keeps a handful of caches keyed by the instance's ID. IDs are never reused, which
+        // means a stale slot can't ever be mistaken for one belonging to a live instance.
+        struct ThreadCacheTable
+        {
+        public:
+            struct Slot
+            {
+                Int64 OwnerId;
+                ThreadCache* Cache;
+            };
+
+        public:
+            ~ThreadCacheTable();
+
+        public:
+            static void Release(const Slot& slot)
+            {
+                if (slot.Cache == nullptr) return;
+
+                // The registry lock stays held while the cache is handed back, so the
+                // owner can't get destroyed under us.
+                LockGuard guard(Api::s_RegistryLock);
+                for (Api* instance = Api::s_Instances; instance; instance = instance->m_NextInstance)
+                {
+                    if (instance->m_InstanceId == slot.OwnerId)
+                    {
+                        instance->ReleaseThreadCache(slot.Cache);
+                        break;
+                    }
+                }
+            }
+
+        public:
+            Slot Slots[4];
+        };
+    }
+
+    namespace
+    {
+        thread_local Internal::ThreadCacheTable t_ThreadCaches;
+
+        // Other thread_local destructors can still allocate and free after the table is gone,
+        // those go around the thread caches. Trivially destructible, so it outlives the table.
+        thread_local bool t_ThreadCachesDestroyed = false;
+    }
+
+    Internal::ThreadCacheTable::~ThreadCacheTable()
+    {
+        t_ThreadCachesDestroyed = true;
+
+        for (Slot& slot : Slots)
+        {
+            Release(slot);
+            slot = { 0, nullptr };
+        }
+    }
+
+    SpinLock ThreadCachingMemoryApi::s_RegistryLock;
+    ThreadCachingMemoryApi* ThreadCachingMemoryApi::s_Instances = nullptr;
+    Int64 ThreadCachingMemoryApi::s_NextInstanceId = 0;
+
+    ThreadCachingMemoryApi::ThreadCachingMemoryApi()
+        : m_ArenaCursor(nullptr), m_ArenaEnd(nullptr), m_Arenas(nullptr),
+          m_PageMap(), m_AllCaches(nullptr), m_FreeCaches(nullptr)
+    {
+        LockGuard guard(s_RegistryLock);
+
+        m_InstanceId = ++s_NextInstanceId;
+        m_NextInstance = s_Instances;
+        s_Instances = this;
+    }
+
+    ThreadCachingMemoryApi::~ThreadCachingMemoryApi()
+    {
+        {
+            LockGuard guard(s_RegistryLock);
+
+            ThreadCachingMemoryApi** link = &s_Instances;
+            while (*link != this)
+                link = &(*link)->m_NextInstance;
+
+            *link = m_NextInstance;
+        }
+
+        while (m_AllCaches != nullptr)
+        {
+            Internal::ThreadCache* next = m_AllCaches->NextCache;
+            m_SystemApi.Free(m_AllCaches);
+            m_AllCaches = next;
+        }
+
+        while (m_Arenas != nullptr)
+        {
+            void* next = static_cast<SlabHeader*>(m_Arenas)->NextArena;
+            m_SystemApi.Free(m_Arenas);
+            m_Arenas = next;
+        }
+
+        for (Usize i = 0; i < s_PageMapRootSize; ++i)
+            m_SystemApi.Free(reinterpret_cast<void*>(m_PageMap[i]));
+    }
+
+    void* ThreadCachingMemoryApi::TryAllocate(Usize bytes, Usize alignment)
+    {
+        if (bytes > s_MaxSmallSize || alignment > s_MaxSmallAlignment)
+            return m_SystemApi.TryAllocate(bytes, KITSUNE_MAX(alignment, s_DefaultAlignment));
+
+        Internal::ThreadCache* cache = GetThreadCache();
+        if (cache == nullptr)
+            return m_SystemApi.TryAllocate(bytes, KITSUNE_MAX(alignment, s_DefaultAlignment));
+
+        Uint32 sizeClass = GetSizeClass(bytes, alignment);
+        Internal::ThreadCacheFreeList& list = cache->Lists[sizeClass];
+
+        if (list.Head == nullptr && !FetchFromCentral(list, sizeClass))
+            return nullptr;
+
+        void* block = list.Head;
+        list.Head = NextOf(block);
+        --list.Count;
+
+        return block;
+    }
+
+    void ThreadCachingMemoryApi::Free(void* ptr)
+    {
+        if (ptr == nullptr) return;
+        if (!IsArenaPointer(ptr))
+            return m_SystemApi.Free(ptr);
+
+        Uint32 sizeClass = GetSlabHeader(ptr)->SizeClass;
+        Internal::ThreadCache* cache = GetThreadCache();
+
+        if (cache == nullptr)
+        {
+            Internal::ThreadCacheFreeList list = { ptr, 1 };
+
+            NextOf(ptr) = nullptr;
+            return ReleaseToCentral(list, sizeClass, 1);
+        }
+
+        Internal::ThreadCacheFreeList& list = cache->Lists[sizeClass];
+
+        NextOf(ptr) = list.Head;
+        list.Head = ptr;
+
+        // Keep a batch around for the next allocations, hand the rest back.
+        Uint32 batchSize = s_SizeClassTable.BatchSizes[sizeClass];
+        if (++list.Count > batchSize * 2)
+            ReleaseToCentral(list, sizeClass, batchSize);
+    }
+
+    bool ThreadCachingMemoryApi::TryExpand(void* ptr, Usize bytes)
+    {
+        if (ptr == nullptr) return false;
+        if (!IsArenaPointer(ptr))
+            return (bytes > s_MaxSmallSize) && m_SystemApi.TryExpand(ptr, bytes);
+
+        // Blocks can't move between size classes, it only works if the current one is big enough.
+        return (bytes <= s_ClassSizes[GetSlabHeader(ptr)->SizeClass]);
+    }
+
+    void* ThreadCachingMemoryApi::TryReallocate(void* ptr, Usize bytes, Usize alignment)
+    {
+        if (ptr == nullptr) return nullptr;
+        if (!IsArenaPointer(ptr))
+        {
+            // Anything that would now fit into a size class goes through a new allocation.
+            if (bytes <= s_MaxSmallSize && alignment <= s_MaxSmallAlignment)
+                return nullptr;
+
+            return m_SystemApi.TryReallocate(ptr, bytes, KITSUNE_MAX(alignment, s_DefaultAlignment));
+        }
+
+        return TryExpand(ptr, bytes) ? ptr : nullptr;
+    }
+
+    Internal::ThreadCache* ThreadCachingMemoryApi::GetThreadCache()
+    {
+        if (t_ThreadCachesDestroyed)
+            return nullptr;
+
+        for (const Internal::ThreadCacheTable::Slot& slot : t_ThreadCaches.Slots)
+        {
+            if (slot.OwnerId == m_InstanceId)
+                return slot.Cache;
+        }
+
+        return AttachThreadCache();
+    }
+
+    Internal::ThreadCache* ThreadCachingMemoryApi::AttachThreadCache()
+    {
+        Internal::ThreadCache* cache = AcquireThreadCache();
+        if (cache == nullptr) return nullptr;
+
+        // Most recently attached first, the oldest one gets evicted.
+        Internal::ThreadCacheTable::Slot* slots = t_ThreadCaches.Slots;
+        constexpr Usize slotCount = sizeof(t_ThreadCaches.Slots) / sizeof(slots[0]);
+
+        Internal::ThreadCacheTable::Slot evicted = slots[slotCount - 1];
+        for (Usize i = slotCount - 1; i > 0; --i)
+            slots[i] = slots[i - 1];
+
+        slots[0] = { m_InstanceId, cache };
+
+        Internal::ThreadCacheTable::Release(evicted);
+        return cache;
+    }
+
+    Internal::ThreadCache* ThreadCachingMemoryApi::AcquireThreadCache()
+    {
+        LockGuard guard(m_CacheLock);
+
+        Internal::ThreadCache* cache = m_FreeCaches;
+        if (cache != nullptr)
+        {
+            m_FreeCaches = cache->NextFree;
+            return cache;
+        }
+
+        void* memory = m_SystemApi.TryAllocate(sizeof(Internal::ThreadCache),
+                                               alignof(Internal::ThreadCache));
+        if (memory == nullptr) return nullptr;
+
+        cache = Memory::ConstructAt(static_cast<Internal::ThreadCache*>(memory));
+        cache->NextCache = m_AllCaches;
+        m_AllCaches = cache;
+
+        return cache;
+    }
+
+    void ThreadCachingMemoryApi::ReleaseThreadCache(Internal::ThreadCache* cache)
+    {
+        for (Uint32 i = 0; i < s_SizeClassCount; ++i)
+        {
+            if (cache->Lists[i].Count != 0)
+                ReleaseToCentral(cache->Lists[i], i, cache->Lists[i].Count);
+        }
+
+        LockGuard guard(m_CacheLock);
+
+        cache->NextFree = m_FreeCaches;
+        m_FreeCaches = cache;
+    }
+
+    bool ThreadCachingMemoryApi::FetchFromCentral(Internal::ThreadCacheFreeList& list,
+                                                  Uint32 sizeClass)
+    {
+        CentralFreeList& central = m_CentralLists[sizeClass];
+
+        Uint32 size = s_ClassSizes[sizeClass];
+        Uint32 batchSize = s_SizeClassTable.BatchSizes[sizeClass];
+        Uint32 count = 0;
+
+        LockGuard guard(central.Lock);
+
+        // Recycled blocks first, only carve out new ones when those run out.
+        while (count < batchSize && central.Head != nullptr)
+        {
+            void* block = central.Head;
+            central.Head = NextOf(block);
+
+            NextOf(block) = list.Head;
+            list.Head = block;
+            ++count;
+        }
+
+        while (count < batchSize)
+        {
+            if (central.Cursor == central.End)
+            {
+                Uint8* slab = AllocateSlab();
+                if (slab == nullptr) break;
+
+                reinterpret_cast<SlabHeader*>(slab)->SizeClass = sizeClass;
+
+                central.Cursor = slab + s_SlabHeaderSize;
+                central.End = central.Cursor + ((s_SlabSize - s_SlabHeaderSize) / size) * size;
+            }
+
+            void* block = central.Cursor;
+            central.Cursor += size;
+
+            NextOf(block) = list.Head;
+            list.Head = block;
+            ++count;
+        }
+
+        list.Count += count;
+        return (count != 0);
+    }
+
+    void ThreadCachingMemoryApi::ReleaseToCentral(Internal::ThreadCacheFreeList& list,
+                                                  Uint32 sizeClass, Uint32 count)
+    {
+        void* head = list.Head;
+        void* tail = head;
+
+        for (Uint32 i = 1; i < count; ++i)
+            tail = NextOf(tail);
+
+        list.Head = NextOf(tail);
+        list.Count -= count;
+
+        CentralFreeList& central = m_CentralLists[sizeClass];
+        LockGuard guard(central.Lock);
+
+        NextOf(tail) = central.Head;
+        central.Head = head;
+    }
+
+    Uint8* ThreadCachingMemoryApi::AllocateSlab()
+    {
+        LockGuard guard(m_PageHeapLock);
+
+        if (m_ArenaCursor == m_ArenaEnd)
+        {
+            Uint8* arena = static_cast<Uint8*>(m_SystemApi.TryAllocate(s_ArenaSize, s_ArenaSize));
+            if (arena == nullptr) return nullptr;
+
+            if (!RegisterArena(arena))
+            {
+                m_SystemApi.Free(arena);
+                return nullptr;
+            }
+
+            reinterpret_cast<SlabHeader*>(arena)->NextArena = m_Arenas;
+            m_Arenas = arena;
+
+            m_ArenaCursor = arena;
+            m_ArenaEnd = arena + s_ArenaSize;
+        }
+
+        Uint8* slab = m_ArenaCursor;
+        m_ArenaCursor += s_SlabSize;
+
+        return slab;
+    }
+
+    bool ThreadCachingMemoryApi::RegisterArena(void* arena)
+    {
+        Uintptr index = reinterpret_cast<Uintptr>(arena) >> s_ArenaShift;
+        Uintptr root = index >> s_PageMapLeafBits;
+
+        if (root >= s_PageMapRootSize) return false;
+
+        volatile Int64* leaf = reinterpret_cast<volatile Int64*>(Interlocked::Load(&m_PageMap[root]));
+        if (leaf == nullptr)
+        {
+            void* memory = m_SystemApi.TryAllocate(s_PageMapLeafSize * sizeof(Int64), 64);
+            if (memory == nullptr) return false;
+
+            std::memset(memory, 0, s_PageMapLeafSize * sizeof(Int64));
+
+            leaf = static_cast<volatile Int64*>(memory);
+            Interlocked::Store(&m_PageMap[root], reinterpret_cast<Int64>(memory));
+        }
+
+        Uintptr bit = index & ((Uintptr(1) << s_PageMapLeafBits) - 1);
+        Interlocked::Or(&leaf[bit / 64], static_cast<Int64>(Uint64(1) << (bit % 64)));
+
+        return true;
+    }
+
+    bool ThreadCachingMemoryApi::IsArenaPointer(const void* ptr) const
+    {
+        Uintptr index = reinterpret_cast<Uintptr>(ptr) >> s_ArenaShift;
+        Uintptr root = index >> s_PageMapLeafBits;
+
+        if (root >= s_PageMapRootSize) return false;
+
+        const volatile Int64* leaf =
+            reinterpret_cast<const volatile Int64*>(Interlocked::Load(&m_PageMap[root]));
+
+        if (leaf == nullptr) return false;
+
+        Uintptr bit = index & ((Uintptr(1) << s_PageMapLeafBits) - 1);
+        Uint64 word = static_cast<Uint64>(Interlocked::Load(&leaf[bit / 64]));
+
+        return ((word >> (bit % 64)) & 1) != 0;
+    }
+}
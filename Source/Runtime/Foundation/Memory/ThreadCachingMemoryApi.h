@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Memory/IMemoryApi.h"
+#include "Foundation/Memory/CMallocApi.h"
+
+#include "Foundation/Threading/SpinLock.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        struct ThreadCache;
+        struct ThreadCacheFreeList;
+        struct ThreadCacheTable;
+    }
+
+    // Size-segregated allocator for the many small allocations the engine makes.
+    //
+    // Small requests are served from per-thread free lists, which refill (and drain) in
+    // batches from a central free list per size class. The central lists carve their blocks
+    // out of 64KiB slabs, handed out by a page heap that grabs 4MiB arenas from the system.
+    // Anything too big or too aligned for a size class goes straight to CMallocApi.
+    //
+    // Slabs are kept around until the memory API is destroyed, freed blocks only go back
+    // into the free lists.
+    class ThreadCachingMemoryApi : public IMemoryApi
+    {
+    public:
+        KITSUNE_API_ ThreadCachingMemoryApi();
+        KITSUNE_API_ ~ThreadCachingMemoryApi() override;
+
+    public:
+        ThreadCachingMemoryApi(const ThreadCachingMemoryApi&) = delete;
+        ThreadCachingMemoryApi& operator=(const ThreadCachingMemoryApi&) = delete;
+
+    public:
+        KITSUNE_API_ void* TryAllocate(Usize bytes, Usize alignment) override;
+        KITSUNE_API_ void Free(void* ptr) override;
+
+        KITSUNE_API_ bool TryExpand(void* ptr, Usize bytes) override;
+        KITSUNE_API_ void* TryReallocate(void* ptr, Usize bytes, Usize alignment) override;
+
+        inline Usize GetDefaultAlignment() const override { return s_DefaultAlignment; }
+
+    public:
+        static constexpr Usize s_DefaultAlignment = 16;
+
+        static constexpr Usize s_MaxSmallSize = 8192;
+        static constexpr Usize s_MaxSmallAlignment = 64;
+        static constexpr Usize s_SizeClassCount = 32;
+
+        static constexpr Usize s_SlabSize = Usize(1) << 16;
+        static constexpr Usize s_ArenaSize = Usize(1) << 22;
+
+    private:
+        struct alignas(64) CentralFreeList
+        {
+            SpinLock Lock;
+
+            void* Head = nullptr;
+            Uint8* Cursor = nullptr;
+            Uint8* End = nullptr;
+        };
+
+    private:
+        Internal::ThreadCache* GetThreadCache();
+        KITSUNE_NOINLINE Internal::ThreadCache* AttachThreadCache();
+
+        Internal::ThreadCache* AcquireThreadCache();
+        void ReleaseThreadCache(Internal::ThreadCache* cache);
+
+        bool FetchFromCentral(Internal::ThreadCacheFreeList& list, Uint32 sizeClass);
+        void ReleaseToCentral(Internal::ThreadCacheFreeList& list, Uint32 sizeClass, Uint32 count);
+
+        Uint8* AllocateSlab();
+
+        bool RegisterArena(void* arena);
+        bool IsArenaPointer(const void* ptr) const;
+
+    private:
+        friend struct Internal::ThreadCacheTable;
+
+        // Covers 48-bit addresses in arena granularity: 2^13 leaves of 2^13 bits each.
+        static constexpr Usize s_PageMapLeafBits = 13;
+        static constexpr Usize s_PageMapRootSize = Usize(1) << 13;
+
+        static SpinLock s_RegistryLock;
+        static ThreadCachingMemoryApi* s_Instances;
+        static Int64 s_NextInstanceId;
+
+    private:
+        Int64 m_InstanceId;
+        ThreadCachingMemoryApi* m_NextInstance;
+
+        CMallocApi m_SystemApi;
+        CentralFreeList m_CentralLists[s_SizeClassCount];
+
+        SpinLock m_PageHeapLock;
+        Uint8* m_ArenaCursor;
+        Uint8* m_ArenaEnd;
+        void* m_Arenas;
+
+        volatile Int64 m_PageMap[s_PageMapRootSize];
+
+        SpinLock m_CacheLock;
+        Internal::ThreadCache* m_AllCaches;
+        Internal::ThreadCache* m_FreeCaches;
+    };
+}
@@ -0,0 +1,367 @@
+#include "Foundation/Memory/TrackingMemoryApi.h"
+
+#include <bit>
+#include <new>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+
+#include "Foundation/Templates/Exchange.h"
+#include "Foundation/Threading/Interlocked.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        struct MemoryTagEntry
+        {
+            const char* Tag;
+            SourceLocation Site;
+
+            MemoryTagEntry* Next;
+            MemoryTagEntry* NextInBucket;
+
+            volatile Int64 AllocatedBytes;
+            volatile Int64 FreedBytes;
+            volatile Int64 Allocations;
+            volatile Int64 Frees;
+        };
+    }
+
+    namespace
+    {
+        using Api = TrackingMemoryApi;
+
+        // Sits right in front of every allocation handed out.
+        struct AllocationHeader
+        {
+            Internal::MemoryTagEntry* Entry;
+            Usize Size;
+            Usize Offset;            // From the start of the backend's block to the user's.
+        };
+
+        KITSUNE_FORCEINLINE Usize AlignUp(Usize value, Usize alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        KITSUNE_FORCEINLINE Usize GetHistogramBucket(Usize bytes)
+        {
+            if (bytes <= 16)
+                return 0;
+
+            Usize bucket = static_cast<Usize>(std::bit_width(bytes - 1)) - 4;
+            return KITSUNE_MIN(bucket, MemoryStatistics::s_HistogramBucketCount - 1);
+        }
+
+        KITSUNE_FORCEINLINE AllocationHeader* GetHeader(void* ptr)
+        {
+            return static_cast<AllocationHeader*>(ptr) - 1;
+        }
+
+        Usize GetCurrentShard()
+        {
+            static volatile Int32 s_NextShard = 0;
+            thread_local Usize t_Shard = static_cast<Usize>(Interlocked::Increment(&s_NextShard));
+
+            return t_Shard % Api::s_ShardCount;
+        }
+
+        Internal::MemoryTagEntry* CreateEntry(IMemoryApi* backend, const char* tag, const SourceLocation& site)
+        {
+            void* memory = backend->TryAllocate(sizeof(Internal::MemoryTagEntry),
+                                                alignof(Internal::MemoryTagEntry));
+            if (memory == nullptr)
+                return nullptr;
+
+            return new (memory) Internal::MemoryTagEntry{ tag, site, nullptr, nullptr, 0, 0, 0, 0 };
+        }
+
+        thread_local MemoryTagScope* t_CurrentTagScope = nullptr;
+    }
+
+    MemoryTagScope::MemoryTagScope(const char* tag, SourceLocation site)
+        : m_Tag(tag), m_Site(site), m_Previous(t_CurrentTagScope),
+          m_CachedTrackerId(0), m_CachedEntry(nullptr)
+    {
+        t_CurrentTagScope = this;
+    }
+
+    MemoryTagScope::~MemoryTagScope()
+    {
+        t_CurrentTagScope = m_Previous;
+    }
+
+    volatile Int64 TrackingMemoryApi::s_NextTrackerId = 0;
+
+    TrackingMemoryApi::TrackingMemoryApi(IMemoryApi* backend, bool tagBreakdown)
+        : m_Backend(backend), m_TrackerId(Interlocked::Increment(&s_NextTrackerId)),
+          m_TagBreakdown(tagBreakdown), m_Shards(), m_PeakBytes(0),
+          m_Entries(nullptr), m_EntryBuckets(), m_UntaggedEntry(nullptr)
+    {
+        if (m_TagBreakdown)
+        {
+            m_UntaggedEntry = CreateEntry(m_Backend, "<untagged>", SourceLocation());
+            if (m_UntaggedEntry == nullptr)
+            {
+                delete m_Backend;
+                throw BadAllocException();
+            }
+
+            m_Entries = m_UntaggedEntry;
+        }
+    }
+
+    TrackingMemoryApi::~TrackingMemoryApi()
+    {
+        while (m_Entries != nullptr)
+            m_Backend->Free(Exchange(m_Entries, m_Entries->Next));
+
+        delete m_Backend;
+    }
+
+    void* TrackingMemoryApi::TryAllocate(Usize bytes, Usize alignment)
+    {
+        alignment = KITSUNE_MAX(alignment, alignof(AllocationHeader));
+        Usize offset = AlignUp(sizeof(AllocationHeader), alignment);
+
+        Uint8* block = static_cast<Uint8*>(m_Backend->TryAllocate(bytes + offset, alignment));
+        if (block == nullptr)
+            return nullptr;
+
+        Internal::MemoryTagEntry* entry = GetTagEntry();
+        AllocationHeader* header = GetHeader(block + offset);
+
+        header->Entry = entry;
+        header->Size = bytes;
+        header->Offset = offset;
+
+        CounterShard& shard = m_Shards[GetCurrentShard()];
+
+        Interlocked::Add(&shard.AllocatedBytes, static_cast<Int64>(bytes));
+        Interlocked::Increment(&shard.Allocations);
+        Interlocked::Increment(&shard.SizeHistogram[GetHistogramBucket(bytes)]);
+
+        if (entry != nullptr)
+        {
+            Interlocked::Add(&entry->AllocatedBytes, static_cast<Int64>(bytes));
+            Interlocked::Increment(&entry->Allocations);
+        }
+
+        Int64 unsampled = Interlocked::Add(&shard.UnsampledBytes, static_cast<Int64>(bytes)) +
+                          static_cast<Int64>(bytes);
+
+        if (unsampled >= static_cast<Int64>(s_PeakSampleBytes))
+        {
+            Interlocked::Store(&shard.UnsampledBytes, 0);
+            SampleLiveBytes();
+        }
+
+        return block + offset;
+    }
+
+    void TrackingMemoryApi::Free(void* ptr)
+    {
+        if (ptr == nullptr)
+            return;
+
+        AllocationHeader* header = GetHeader(ptr);
+        CounterShard& shard = m_Shards[GetCurrentShard()];
+
+        Interlocked::Add(&shard.FreedBytes, static_cast<Int64>(header->Size));
+        Interlocked::Increment(&shard.Frees);
+
+        if (header->Entry != nullptr)
+        {
+            Interlocked::Add(&header->Entry->FreedBytes, static_cast<Int64>(header->Size));
+            Interlocked::Increment(&header->Entry->Frees);
+        }
+
+        m_Backend->Free(static_cast<Uint8*>(ptr) - header->Offset);
+    }
+
+    bool TrackingMemoryApi::TryExpand(void* ptr, Usize bytes)
+    {
+        if (ptr == nullptr) return false;
+
+        AllocationHeader* header = GetHeader(ptr);
+        if (!m_Backend->TryExpand(static_cast<Uint8*>(ptr) - header->Offset, bytes + header->Offset))
+            return false;
+
+        RecordResize(header->Entry, Exchange(header->Size, bytes), bytes);
+        return true;
+    }
+
+    void* TrackingMemoryApi::TryReallocate(void* ptr, Usize bytes, Usize alignment)
+    {
+        if (ptr == nullptr) return nullptr;
+
+        alignment = KITSUNE_MAX(alignment, alignof(AllocationHeader));
+        Usize offset = GetHeader(ptr)->Offset;
+
+        Uint8* block = static_cast<Uint8*>(
+            m_Backend->TryReallocate(static_cast<Uint8*>(ptr) - offset, bytes + offset, alignment));
+
+        if (block == nullptr)
+            return nullptr;
+
+        AllocationHeader* header = GetHeader(block + offset);
+        RecordResize(header->Entry, Exchange(header->Size, bytes), bytes);
+
+        return block + offset;
+    }
+
+    MemoryStatistics TrackingMemoryApi::GetStatistics()
+    {
+        MemoryStatistics stats = {};
+        Int64 allocatedBytes = 0;
+        Int64 freedBytes = 0;
+
+        for (const CounterShard& shard : m_Shards)
+        {
+            allocatedBytes += Interlocked::Load(&shard.AllocatedBytes);
+            freedBytes += Interlocked::Load(&shard.FreedBytes);
+
+            stats.TotalAllocations += static_cast<Usize>(Interlocked::Load(&shard.Allocations));
+            stats.TotalFrees += static_cast<Usize>(Interlocked::Load(&shard.Frees));
+
+            for (Usize i = 0; i < MemoryStatistics::s_HistogramBucketCount; ++i)
+                stats.SizeHistogram[i] += static_cast<Usize>(Interlocked::Load(&shard.SizeHistogram[i]));
+        }
+
+        stats.TotalBytesAllocated = static_cast<Usize>(allocatedBytes);
+        stats.LiveBytes = static_cast<Usize>(KITSUNE_MAX(allocatedBytes - freedBytes, Int64(0)));
+        stats.LiveAllocations = stats.TotalAllocations - KITSUNE_MIN(stats.TotalFrees, stats.TotalAllocations);
+
+        stats.PeakBytes = KITSUNE_MAX(SampleLiveBytes(), stats.LiveBytes);
+        return stats;
+    }
+
+    bool TrackingMemoryApi::ReportLeaks()
+    {
+        MemoryStatistics stats = GetStatistics();
+        if (stats.LiveAllocations == 0)
+            return false;
+
+        std::printf("Memory leak report: %zu allocation(s), %zu byte(s) still live. "
+                    "(Peak: %zu byte(s))\n",
+                    stats.LiveAllocations, stats.LiveBytes, stats.PeakBytes);
+
+        ForEachTag([](const MemoryTagStatistics& tag)
+        {
+            if (tag.LiveAllocations == 0)
+                return;
+
+            std::printf("    %s: %zu allocation(s), %zu byte(s) [In function %s, file %s:%u]\n",
+                        tag.Tag, tag.LiveAllocations, tag.LiveBytes,
+                        tag.Site.FunctionName(), tag.Site.FileName(), (unsigned)tag.Site.Line());
+        });
+
+        return true;
+    }
+
+    Internal::MemoryTagEntry* TrackingMemoryApi::GetTagEntry()
+    {
+        if (!m_TagBreakdown)
+            return nullptr;
+
+        MemoryTagScope* scope = t_CurrentTagScope;
+        if (scope == nullptr)
+            return m_UntaggedEntry;
+
+        if (scope->m_CachedTrackerId == m_TrackerId)
+            return scope->m_CachedEntry;
+
+        return ResolveTagEntry(scope);
+    }
+
+    Internal::MemoryTagEntry* TrackingMemoryApi::ResolveTagEntry(MemoryTagScope* scope)
+    {
+        Usize hash = std::hash<const char*>()(scope->m_Site.FileName()) ^ scope->m_Site.Line();
+        Internal::MemoryTagEntry** bucket = &m_EntryBuckets[hash % s_EntryBucketCount];
+
+        LockGuard guard(m_EntryLock);
+
+        Internal::MemoryTagEntry* entry = *bucket;
+        while (entry != nullptr &&
+               (std::strcmp(entry->Tag, scope->m_Tag) != 0 || !(entry->Site == scope->m_Site)))
+        {
+            entry = entry->NextInBucket;
+        }
+
+        if (entry == nullptr)
+        {
+            // Not worth failing the allocation over, count it as untagged instead.
+            entry = CreateEntry(m_Backend, scope->m_Tag, scope->m_Site);
+            if (entry == nullptr)
+                return m_UntaggedEntry;
+
+            entry->Next = Exchange(m_Entries, entry);
+            entry->NextInBucket = Exchange(*bucket, entry);
+        }
+
+        scope->m_CachedTrackerId = m_TrackerId;
+        scope->m_CachedEntry = entry;
+
+        return entry;
+    }
+
+    void TrackingMemoryApi::RecordResize(Internal::MemoryTagEntry* entry, Usize oldBytes, Usize newBytes)
+    {
+        // Still the same allocation, only the byte counters move.
+        CounterShard& shard = m_Shards[GetCurrentShard()];
+
+        Interlocked::Add(&shard.FreedBytes, static_cast<Int64>(oldBytes));
+        Interlocked::Add(&shard.AllocatedBytes, static_cast<Int64>(newBytes));
+
+        if (entry != nullptr)
+        {
+            Interlocked::Add(&entry->FreedBytes, static_cast<Int64>(oldBytes));
+            Interlocked::Add(&entry->AllocatedBytes, static_cast<Int64>(newBytes));
+        }
+
+        if (newBytes > oldBytes)
+            SampleLiveBytes();
+    }
+
+    Usize TrackingMemoryApi::SampleLiveBytes()
+    {
+        Int64 live = 0;
+        for (const CounterShard& shard : m_Shards)
+            live += Interlocked::Load(&shard.AllocatedBytes) - Interlocked::Load(&shard.FreedBytes);
+
+        Int64 peak = Interlocked::Load(&m_PeakBytes);
+        while (live > peak)
+        {
+            Int64 initial = Interlocked::CompareExchange(&m_PeakBytes, live, peak);
+            if (initial == peak)
+                break;
+
+            peak = initial;
+        }
+
+        return static_cast<Usize>(KITSUNE_MAX(live, peak));
+    }
+
+    Internal::MemoryTagEntry* TrackingMemoryApi::GetNextEntry(const Internal::MemoryTagEntry* entry)
+    {
+        return entry->Next;
+    }
+
+    MemoryTagStatistics TrackingMemoryApi::GetTagStatistics(const Internal::MemoryTagEntry* entry)
+    {
+        Int64 allocatedBytes = Interlocked::Load(&entry->AllocatedBytes);
+        Int64 allocations = Interlocked::Load(&entry->Allocations);
+
+        MemoryTagStatistics stats;
+        stats.Tag = entry->Tag;
+        stats.Site = entry->Site;
+
+        stats.LiveBytes = static_cast<Usize>(allocatedBytes - Interlocked::Load(&entry->FreedBytes));
+        stats.LiveAllocations = static_cast<Usize>(allocations - Interlocked::Load(&entry->Frees));
+        stats.TotalAllocations = static_cast<Usize>(allocations);
+        stats.TotalBytesAllocated = static_cast<Usize>(allocatedBytes);
+
+        return stats;
+    }
+}
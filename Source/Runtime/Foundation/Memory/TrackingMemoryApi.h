@@ -0,0 +1,184 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Memory/IMemoryApi.h"
+#include "Foundation/Diagnostics/SourceLocation.h"
+
+#include "Foundation/Threading/SpinLock.h"
+#include "Foundation/Threading/LockGuard.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        struct MemoryTagEntry;
+    }
+
+    struct MemoryStatistics
+    {
+        // Bucket 0 holds sizes up to 16 bytes, every following bucket doubles the upper
+        // bound. The last one holds everything that didn't fit anywhere else.
+        static constexpr Usize s_HistogramBucketCount = 24;
+
+        Usize LiveBytes;
+        Usize PeakBytes;
+        Usize LiveAllocations;
+
+        Usize TotalAllocations;
+        Usize TotalBytesAllocated;
+        Usize TotalFrees;
+
+        Usize SizeHistogram[s_HistogramBucketCount];
+    };
+
+    struct MemoryTagStatistics
+    {
+        const char* Tag;
+        SourceLocation Site;
+
+        Usize LiveBytes;
+        Usize LiveAllocations;
+
+        Usize TotalAllocations;
+        Usize TotalBytesAllocated;
+    };
+
+    // Attributes every allocation made on this thread to a tag and the location the scope was
+    // opened at, until the scope ends. Scopes nest, the innermost one wins. They're only
+    // looked at when the tracker was created with a per-tag breakdown.
+    class MemoryTagScope
+    {
+    public:
+        KITSUNE_API_ explicit MemoryTagScope(const char* tag, SourceLocation site = SourceLocation::Current());
+        KITSUNE_API_ ~MemoryTagScope();
+
+    public:
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    public:
+        [[nodiscard]] inline const char* GetTag() const { return m_Tag; }
+        [[nodiscard]] inline const SourceLocation& GetSite() const { return m_Site; }
+
+    private:
+        friend class TrackingMemoryApi;
+
+        const char* m_Tag;
+        SourceLocation m_Site;
+
+        MemoryTagScope* m_Previous;
+
+        Int64 m_CachedTrackerId;
+        Internal::MemoryTagEntry* m_CachedEntry;
+    };
+
+    // Decorator recording what goes through another memory API: live and peak bytes,
+    // allocation counts, a size histogram and, optionally, a breakdown per MemoryTagScope.
+    //
+    // Counters are striped over cache line sized shards picked per thread and only summed
+    // up when queried, so threads don't fight over a single cache line. The peak is sampled
+    // from those every s_PeakSampleBytes allocated by a thread (and on every query), so it
+    // can miss short spikes smaller than that.
+    //
+    // Each allocation carries a small header in front of it, so memory handed out by the
+    // tracker must be freed by it and nothing else.
+    class TrackingMemoryApi : public IMemoryApi
+    {
+    public:
+        // Takes ownership of the backend, which must have been created with `new`.
+        KITSUNE_API_ explicit TrackingMemoryApi(IMemoryApi* backend, bool tagBreakdown = false);
+        KITSUNE_API_ ~TrackingMemoryApi() override;
+
+    public:
+        TrackingMemoryApi(const TrackingMemoryApi&) = delete;
+        TrackingMemoryApi& operator=(const TrackingMemoryApi&) = delete;
+
+    public:
+        KITSUNE_API_ void* TryAllocate(Usize bytes, Usize alignment) override;
+        KITSUNE_API_ void Free(void* ptr) override;
+
+        KITSUNE_API_ bool TryExpand(void* ptr, Usize bytes) override;
+        KITSUNE_API_ void* TryReallocate(void* ptr, Usize bytes, Usize alignment) override;
+
+        inline Usize GetDefaultAlignment() const override { return m_Backend->GetDefaultAlignment(); }
+
+        [[noreturn]]
+        inline void OutOfMemory(Usize bytes, Usize alignment) override
+        {
+            m_Backend->OutOfMemory(bytes, alignment);
+            KITSUNE_UNREACHABLE();
+        }
+
+    public:
+        [[nodiscard]] KITSUNE_API_ MemoryStatistics GetStatistics();
+
+        // Calls `function` with the MemoryTagStatistics of every tag seen so far. Allocating
+        // from inside of it is fine, new tags might just not show up.
+        template<typename Function>
+        void ForEachTag(Function&& function) const
+        {
+            Internal::MemoryTagEntry* entries;
+            {
+                LockGuard guard(m_EntryLock);
+                entries = m_Entries;
+            }
+
+            for (; entries != nullptr; entries = GetNextEntry(entries))
+                function(GetTagStatistics(entries));
+        }
+
+        // Prints whatever is still allocated to stdout, the logger is usually gone by the
+        // time this gets called from Memory::Shutdown(). Returns whether anything leaked.
+        KITSUNE_API_ bool ReportLeaks();
+
+    public:
+        [[nodiscard]] inline IMemoryApi* GetBackend() const { return m_Backend; }
+        [[nodiscard]] inline bool HasTagBreakdown() const { return m_TagBreakdown; }
+
+    public:
+        static constexpr Usize s_ShardCount = 64;
+        static constexpr Usize s_PeakSampleBytes = 256 * 1024;
+
+    private:
+        struct alignas(64) CounterShard
+        {
+            volatile Int64 AllocatedBytes;
+            volatile Int64 FreedBytes;
+            volatile Int64 Allocations;
+            volatile Int64 Frees;
+            volatile Int64 UnsampledBytes;
+
+            volatile Int64 SizeHistogram[MemoryStatistics::s_HistogramBucketCount];
+        };
+
+    private:
+        Internal::MemoryTagEntry* GetTagEntry();
+        KITSUNE_NOINLINE Internal::MemoryTagEntry* ResolveTagEntry(MemoryTagScope* scope);
+
+        void RecordResize(Internal::MemoryTagEntry* entry, Usize oldBytes, Usize newBytes);
+        Usize SampleLiveBytes();
+
+        KITSUNE_API_ static Internal::MemoryTagEntry* GetNextEntry(const Internal::MemoryTagEntry* entry);
+        KITSUNE_API_ static MemoryTagStatistics GetTagStatistics(const Internal::MemoryTagEntry* entry);
+
+    private:
+        static constexpr Usize s_EntryBucketCount = 256;
+
+        static volatile Int64 s_NextTrackerId;
+
+    private:
+        IMemoryApi* m_Backend;
+        Int64 m_TrackerId;
+        bool m_TagBreakdown;
+
+        CounterShard m_Shards[s_ShardCount];
+        volatile Int64 m_PeakBytes;
+
+        mutable SpinLock m_EntryLock;
+        Internal::MemoryTagEntry* m_Entries;
+        Internal::MemoryTagEntry* m_EntryBuckets[s_EntryBucketCount];
+        Internal::MemoryTagEntry* m_UntaggedEntry;
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+namespace Kitsune
+{
+    // Thin layer over the OS virtual memory functions. Address ranges get reserved up front
+    // without any backing memory, pages inside of them only cost something once committed.
+    //
+    // Every address and size passed in has to be a multiple of GetPageSize(), except for the
+    // size given to Reserve() and Release(), which get rounded up.
+    class VirtualMemory
+    {
+    public:
+        [[nodiscard]] KITSUNE_API_ static Usize GetPageSize();
+
+        // Large page size used by AdviseHugePages(), or the regular page size if there is none.
+        [[nodiscard]] KITSUNE_API_ static Usize GetHugePageSize();
+
+    public:
+        // Returns nullptr if the address space couldn't be reserved.
+        [[nodiscard]] KITSUNE_API_ static void* Reserve(Usize bytes);
+        KITSUNE_API_ static void Release(void* address, Usize bytes);
+
+        // Makes pages of a reserved range readable and writable. Freshly committed pages are
+        // always zeroed. Returns whether the OS could back them.
+        [[nodiscard]] KITSUNE_API_ static bool Commit(void* address, Usize bytes);
+
+        // Hands the backing memory of the pages back to the OS, the range stays reserved.
+        KITSUNE_API_ static void Decommit(void* address, Usize bytes);
+
+        // Hints that the range should be backed by huge pages. Does nothing where the OS
+        // can't do that for memory that was reserved without them.
+        KITSUNE_API_ static void AdviseHugePages(void* address, Usize bytes);
+    };
+}
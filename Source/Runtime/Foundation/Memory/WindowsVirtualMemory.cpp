@@ -0,0 +1,54 @@
+#include "Foundation/Memory/VirtualMemory.h"
+#include <Windows.h>
+
+namespace Kitsune
+{
+    Usize VirtualMemory::GetPageSize()
+    {
+        static const Usize pageSize = []()
+        {
+            SYSTEM_INFO info;
+            ::GetSystemInfo(&info);
+
+            return static_cast<Usize>(info.dwPageSize);
+        }();
+
+        return pageSize;
+    }
+
+    Usize VirtualMemory::GetHugePageSize()
+    {
+        // Large pages have to be requested when reserving and need a privilege most users
+        // don't have, so there's nothing AdviseHugePages() could do with them.
+        return GetPageSize();
+    }
+
+    void* VirtualMemory::Reserve(Usize bytes)
+    {
+        return ::VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+    }
+
+    void VirtualMemory::Release(void* address, Usize bytes)
+    {
+        KITSUNE_UNUSED(bytes);
+
+        if (address != nullptr)
+            ::VirtualFree(address, 0, MEM_RELEASE);
+    }
+
+    bool VirtualMemory::Commit(void* address, Usize bytes)
+    {
+        return (::VirtualAlloc(address, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr);
+    }
+
+    void VirtualMemory::Decommit(void* address, Usize bytes)
+    {
+        ::VirtualFree(address, bytes, MEM_DECOMMIT);
+    }
+
+    void VirtualMemory::AdviseHugePages(void* address, Usize bytes)
+    {
+        KITSUNE_UNUSED(address);
+        KITSUNE_UNUSED(bytes);
+    }
+}
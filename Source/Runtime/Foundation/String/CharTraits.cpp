@@ -0,0 +1,478 @@
+#include "Foundation/String/CharTraits.h"
+
+#include <bit>
+
+#include "Foundation/Common/Simd.h"
+#include "Foundation/Common/CpuFeatures.h"
+
+#include "Foundation/Threading/Interlocked.h"
+
+namespace Kitsune::Internal
+{
+    namespace
+    {
+        template<typename T>
+        struct CharKernelsOf
+        {
+            Usize (*Length)(const T*);
+            int (*Compare)(const T*, const T*, Usize);
+            const T* (*Find)(const T*, Usize, T);
+        };
+
+        struct CharKernels
+        {
+            CharKernelSet Set;
+
+            CharKernelsOf<char8_t> Utf8;
+            CharKernelsOf<char16_t> Utf16;
+            CharKernelsOf<char32_t> Utf32;
+        };
+
+        template<typename T>
+        int CompareChars(T ch1, T ch2)
+        {
+            // Not ch1 - ch2, that overflows an int for large char32_t values.
+            return (ch1 < ch2) ? -1 : 1;
+        }
+
+        template<typename T>
+        Usize ScalarLength(const T* str)
+        {
+            const T* it = str;
+            for (; *it != T(); ++it);
+
+            return static_cast<Usize>(it - str);
+        }
+
+        template<typename T>
+        int ScalarCompare(const T* str1, const T* str2, Usize count)
+        {
+            for (Usize i = 0; i < count; ++i)
+            {
+                if (str1[i] != str2[i])
+                    return CompareChars(str1[i], str2[i]);
+            }
+
+            return 0;
+        }
+
+        template<typename T>
+        const T* ScalarFind(const T* haystack, Usize count, T needle)
+        {
+            for (Usize i = 0; i < count; ++i)
+            {
+                if (haystack[i] == needle)
+                    return haystack + i;
+            }
+
+            return nullptr;
+        }
+
+        // All the vector kernels below follow the same pattern:
+        //
+        //  - Length only ever does aligned loads, which can't cross into the next page, so it
+        //    is free to read a bit before the string and past its terminator. Misaligned
+        //    strings (odd addresses for char16_t, ...) are left to the scalar loop.
+        //  - Compare and Find handle the tail with one last block that overlaps the previous
+        //    one instead of a scalar loop, so only inputs shorter than a block go scalar.
+
+#if defined(KITSUNE_SIMD_X86)
+        template<typename T>
+        KITSUNE_TARGET("sse2") KITSUNE_NO_SANITIZE_ADDRESS
+        Usize Sse2Length(const T* str)
+        {
+            Uintptr address = reinterpret_cast<Uintptr>(str);
+            if (address % sizeof(T) != 0)
+                return ScalarLength(str);
+
+            Uintptr offset = address % sizeof(__m128i);
+            const __m128i* block = reinterpret_cast<const __m128i*>(address - offset);
+
+            const __m128i zero = _mm_setzero_si128();
+            Uint32 mask = Sse2EqualMask<T>(_mm_load_si128(block), zero) >> offset;
+            if (mask != 0)
+                return static_cast<Usize>(std::countr_zero(mask)) / sizeof(T);
+
+            do
+            {
+                mask = Sse2EqualMask<T>(_mm_load_si128(++block), zero);
+            }
+            while (mask == 0);
+
+            Uintptr bytes = reinterpret_cast<Uintptr>(block) - address;
+            return static_cast<Usize>(bytes + static_cast<Uintptr>(std::countr_zero(mask))) / sizeof(T);
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("sse2") int Sse2Compare(const T* str1, const T* str2, Usize count)
+        {
+            constexpr Usize lanes = sizeof(__m128i) / sizeof(T);
+            if (count < lanes)
+                return ScalarCompare(str1, str2, count);
+
+            Usize last = count - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+            {
+                __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str1 + i));
+                __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str2 + i));
+
+                Uint32 mismatch = Sse2EqualMask<T>(block1, block2) ^ 0xFFFFu;
+                if (mismatch != 0)
+                {
+                    Usize at = i + static_cast<Usize>(std::countr_zero(mismatch)) / sizeof(T);
+                    return CompareChars(str1[at], str2[at]);
+                }
+
+                if (i == last)
+                    return 0;
+            }
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("sse2") const T* Sse2Find(const T* haystack, Usize count, T needle)
+        {
+            constexpr Usize lanes = sizeof(__m128i) / sizeof(T);
+            if (count < lanes)
+                return ScalarFind(haystack, count, needle);
+
+            const __m128i needles = Sse2Broadcast(needle);
+
+            Usize last = count - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+
+                Uint32 mask = Sse2EqualMask<T>(block, needles);
+                if (mask != 0)
+                    return haystack + i + static_cast<Usize>(std::countr_zero(mask)) / sizeof(T);
+
+                if (i == last)
+                    return nullptr;
+            }
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("avx2") KITSUNE_NO_SANITIZE_ADDRESS
+        Usize Avx2Length(const T* str)
+        {
+            Uintptr address = reinterpret_cast<Uintptr>(str);
+            if (address % sizeof(T) != 0)
+                return ScalarLength(str);
+
+            Uintptr offset = address % sizeof(__m256i);
+            const __m256i* block = reinterpret_cast<const __m256i*>(address - offset);
+
+            const __m256i zero = _mm256_setzero_si256();
+            Uint32 mask = Avx2EqualMask<T>(_mm256_load_si256(block), zero) >> offset;
+            if (mask != 0)
+                return static_cast<Usize>(std::countr_zero(mask)) / sizeof(T);
+
+            // Both blocks of the loop below have to sit on the same page, so line them up on
+            // 64 bytes first.
+            if ((reinterpret_cast<Uintptr>(++block) % (2 * sizeof(__m256i))) != 0)
+            {
+                mask = Avx2EqualMask<T>(_mm256_load_si256(block), zero);
+                if (mask != 0)
+                    return static_cast<Usize>(reinterpret_cast<Uintptr>(block) - address +
+                                              static_cast<Uintptr>(std::countr_zero(mask))) / sizeof(T);
+
+                ++block;
+            }
+
+            // Two blocks per iteration, the unsigned minimum of both has a zero lane wherever
+            // either of them does.
+            for (;; block += 2)
+            {
+                __m256i block1 = _mm256_load_si256(block);
+                __m256i block2 = _mm256_load_si256(block + 1);
+
+                __m256i minimum;
+                if constexpr (sizeof(T) == 1)
+                    minimum = _mm256_min_epu8(block1, block2);
+                else if constexpr (sizeof(T) == 2)
+                    minimum = _mm256_min_epu16(block1, block2);
+                else
+                    minimum = _mm256_min_epu32(block1, block2);
+
+                if (Avx2EqualMask<T>(minimum, zero) == 0)
+                    continue;
+
+                mask = Avx2EqualMask<T>(block1, zero);
+                if (mask == 0)
+                {
+                    mask = Avx2EqualMask<T>(block2, zero);
+                    ++block;
+                }
+
+                break;
+            }
+
+            Uintptr bytes = reinterpret_cast<Uintptr>(block) - address;
+            return static_cast<Usize>(bytes + static_cast<Uintptr>(std::countr_zero(mask))) / sizeof(T);
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("avx2") int Avx2Compare(const T* str1, const T* str2, Usize count)
+        {
+            constexpr Usize lanes = sizeof(__m256i) / sizeof(T);
+            if (count < lanes)
+                return Sse2Compare(str1, str2, count);
+
+            Usize last = count - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+            {
+                __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str1 + i));
+                __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str2 + i));
+
+                Uint32 mismatch = ~Avx2EqualMask<T>(block1, block2);
+                if (mismatch != 0)
+                {
+                    Usize at = i + static_cast<Usize>(std::countr_zero(mismatch)) / sizeof(T);
+                    return CompareChars(str1[at], str2[at]);
+                }
+
+                if (i == last)
+                    return 0;
+            }
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("avx2") const T* Avx2Find(const T* haystack, Usize count, T needle)
+        {
+            constexpr Usize lanes = sizeof(__m256i) / sizeof(T);
+            if (count < lanes)
+                return Sse2Find(haystack, count, needle);
+
+            const __m256i needles = Avx2Broadcast(needle);
+
+            Usize last = count - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+
+                Uint32 mask = Avx2EqualMask<T>(block, needles);
+                if (mask != 0)
+                    return haystack + i + static_cast<Usize>(std::countr_zero(mask)) / sizeof(T);
+
+                if (i == last)
+                    return nullptr;
+            }
+        }
+#endif
+
+#if defined(KITSUNE_SIMD_NEON)
+        template<typename T>
+        KITSUNE_NO_SANITIZE_ADDRESS
+        Usize NeonLength(const T* str)
+        {
+            Uintptr address = reinterpret_cast<Uintptr>(str);
+            if (address % sizeof(T) != 0)
+                return ScalarLength(str);
+
+            Uintptr offset = address % 16;
+            const Uint8* block = reinterpret_cast<const Uint8*>(address - offset);
+
+            const uint8x16_t zero = vdupq_n_u8(0);
+            Uint64 mask = NeonEqualMask<T>(NeonLoad(block), zero) >> (offset * 4);
+            if (mask != 0)
+                return static_cast<Usize>(std::countr_zero(mask) / 4) / sizeof(T);
+
+            do
+            {
+                block += 16;
+                mask = NeonEqualMask<T>(NeonLoad(block), zero);
+            }
+            while (mask == 0);
+
+            Uintptr bytes = reinterpret_cast<Uintptr>(block) - address;
+            return static_cast<Usize>(bytes + static_cast<Uintptr>(std::countr_zero(mask) / 4)) / sizeof(T);
+        }
+
+        template<typename T>
+        int NeonCompare(const T* str1, const T* str2, Usize count)
+        {
+            constexpr Usize lanes = 16 / sizeof(T);
+            if (count < lanes)
+                return ScalarCompare(str1, str2, count);
+
+            Usize last = count - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+            {
+                Uint64 mismatch = ~NeonEqualMask<T>(NeonLoad(str1 + i), NeonLoad(str2 + i));
+                if (mismatch != 0)
+                {
+                    Usize at = i + static_cast<Usize>(std::countr_zero(mismatch) / 4) / sizeof(T);
+                    return CompareChars(str1[at], str2[at]);
+                }
+
+                if (i == last)
+                    return 0;
+            }
+        }
+
+        template<typename T>
+        const T* NeonFind(const T* haystack, Usize count, T needle)
+        {
+            constexpr Usize lanes = 16 / sizeof(T);
+            if (count < lanes)
+                return ScalarFind(haystack, count, needle);
+
+            const uint8x16_t needles = NeonBroadcast(needle);
+
+            Usize last = count - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+            {
+                Uint64 mask = NeonEqualMask<T>(NeonLoad(haystack + i), needles);
+                if (mask != 0)
+                    return haystack + i + static_cast<Usize>(std::countr_zero(mask) / 4) / sizeof(T);
+
+                if (i == last)
+                    return nullptr;
+            }
+        }
+#endif
+
+        constexpr CharKernels s_ScalarKernels =
+        {
+            CharKernelSet::Scalar,
+            { ScalarLength<char8_t>,  ScalarCompare<char8_t>,  ScalarFind<char8_t>  },
+            { ScalarLength<char16_t>, ScalarCompare<char16_t>, ScalarFind<char16_t> },
+            { ScalarLength<char32_t>, ScalarCompare<char32_t>, ScalarFind<char32_t> }
+        };
+
+#if defined(KITSUNE_SIMD_X86)
+        constexpr CharKernels s_Sse2Kernels =
+        {
+            CharKernelSet::SSE2,
+            { Sse2Length<char8_t>,  Sse2Compare<char8_t>,  Sse2Find<char8_t>  },
+            { Sse2Length<char16_t>, Sse2Compare<char16_t>, Sse2Find<char16_t> },
+            { Sse2Length<char32_t>, Sse2Compare<char32_t>, Sse2Find<char32_t> }
+        };
+
+        constexpr CharKernels s_Avx2Kernels =
+        {
+            CharKernelSet::AVX2,
+            { Avx2Length<char8_t>,  Avx2Compare<char8_t>,  Avx2Find<char8_t>  },
+            { Avx2Length<char16_t>, Avx2Compare<char16_t>, Avx2Find<char16_t> },
+            { Avx2Length<char32_t>, Avx2Compare<char32_t>, Avx2Find<char32_t> }
+        };
+#endif
+
+#if defined(KITSUNE_SIMD_NEON)
+        constexpr CharKernels s_NeonKernels =
+        {
+            CharKernelSet::NEON,
+            { NeonLength<char8_t>,  NeonCompare<char8_t>,  NeonFind<char8_t>  },
+            { NeonLength<char16_t>, NeonCompare<char16_t>, NeonFind<char16_t> },
+            { NeonLength<char32_t>, NeonCompare<char32_t>, NeonFind<char32_t> }
+        };
+#endif
+
+        // nullptr if the kernels aren't built in or the CPU can't run them.
+        const CharKernels* FindCharKernels(CharKernelSet set)
+        {
+            const CpuFeatures& features = GetCpuFeatures();
+            KITSUNE_UNUSED(features);
+
+            switch (set)
+            {
+            case CharKernelSet::Scalar:
+                return &s_ScalarKernels;
+#if defined(KITSUNE_SIMD_X86)
+            case CharKernelSet::SSE2:
+                return features.SSE2 ? &s_Sse2Kernels : nullptr;
+            case CharKernelSet::AVX2:
+                return features.AVX2 ? &s_Avx2Kernels : nullptr;
+#endif
+#if defined(KITSUNE_SIMD_NEON)
+            case CharKernelSet::NEON:
+                return features.NEON ? &s_NeonKernels : nullptr;
+#endif
+            default:
+                return nullptr;
+            }
+        }
+
+        const CharKernels* SelectCharKernels()
+        {
+            constexpr CharKernelSet preferred[] =
+            {
+                CharKernelSet::AVX2, CharKernelSet::SSE2, CharKernelSet::NEON
+            };
+
+            for (CharKernelSet set : preferred)
+            {
+                if (const CharKernels* kernels = FindCharKernels(set))
+                    return kernels;
+            }
+
+            return &s_ScalarKernels;
+        }
+
+        // Picked lazily rather than during static initialisation, strings might be used
+        // before this translation unit gets initialised. Racing threads all store the same
+        // pointer.
+        const CharKernels* volatile s_CharKernels = nullptr;
+
+        KITSUNE_FORCEINLINE const CharKernels& GetCharKernels()
+        {
+            const CharKernels* kernels = Interlocked::Load(&s_CharKernels);
+            if (kernels == nullptr)
+            {
+                kernels = SelectCharKernels();
+                Interlocked::Store(&s_CharKernels, kernels);
+            }
+
+            return *kernels;
+        }
+    }
+
+    Usize CharLength(const char8_t* str)  { return GetCharKernels().Utf8.Length(str); }
+    Usize CharLength(const char16_t* str) { return GetCharKernels().Utf16.Length(str); }
+    Usize CharLength(const char32_t* str) { return GetCharKernels().Utf32.Length(str); }
+
+    int CharCompare(const char8_t* str1, const char8_t* str2, Usize count)
+    {
+        return GetCharKernels().Utf8.Compare(str1, str2, count);
+    }
+
+    int CharCompare(const char16_t* str1, const char16_t* str2, Usize count)
+    {
+        return GetCharKernels().Utf16.Compare(str1, str2, count);
+    }
+
+    int CharCompare(const char32_t* str1, const char32_t* str2, Usize count)
+    {
+        return GetCharKernels().Utf32.Compare(str1, str2, count);
+    }
+
+    const char8_t* CharFind(const char8_t* haystack, Usize count, char8_t needle)
+    {
+        return GetCharKernels().Utf8.Find(haystack, count, needle);
+    }
+
+    const char16_t* CharFind(const char16_t* haystack, Usize count, char16_t needle)
+    {
+        return GetCharKernels().Utf16.Find(haystack, count, needle);
+    }
+
+    const char32_t* CharFind(const char32_t* haystack, Usize count, char32_t needle)
+    {
+        return GetCharKernels().Utf32.Find(haystack, count, needle);
+    }
+
+    CharKernelSet GetCharKernelSet()
+    {
+        return GetCharKernels().Set;
+    }
+
+    bool SetCharKernelSet(CharKernelSet set)
+    {
+        const CharKernels* kernels = FindCharKernels(set);
+        if (kernels == nullptr)
+            return false;
+
+        Interlocked::Store(&s_CharKernels, kernels);
+        return true;
+    }
+}
@@ -9,16 +9,45 @@
 
 namespace Kitsune
 {
+    namespace Internal
+    {
+        // SIMD kernels behind the generic CharTraits, there's no libc equivalent for these
+        // character types. The instruction set gets picked from the CPU on first use (see
+        // CharTraits.cpp), with a scalar version as the fallback and reference.
+        [[nodiscard]] KITSUNE_API_ Usize CharLength(const char8_t* str);
+        [[nodiscard]] KITSUNE_API_ Usize CharLength(const char16_t* str);
+        [[nodiscard]] KITSUNE_API_ Usize CharLength(const char32_t* str);
+
+        [[nodiscard]] KITSUNE_API_ int CharCompare(const char8_t* str1, const char8_t* str2, Usize count);
+        [[nodiscard]] KITSUNE_API_ int CharCompare(const char16_t* str1, const char16_t* str2, Usize count);
+        [[nodiscard]] KITSUNE_API_ int CharCompare(const char32_t* str1, const char32_t* str2, Usize count);
+
+        [[nodiscard]] KITSUNE_API_ const char8_t* CharFind(const char8_t* haystack, Usize count, char8_t needle);
+        [[nodiscard]] KITSUNE_API_ const char16_t* CharFind(const char16_t* haystack, Usize count, char16_t needle);
+        [[nodiscard]] KITSUNE_API_ const char32_t* CharFind(const char32_t* haystack, Usize count, char32_t needle);
+
+        enum class CharKernelSet
+        {
+            Scalar,
+            SSE2,
+            AVX2,
+            NEON
+        };
+
+        [[nodiscard]] KITSUNE_API_ CharKernelSet GetCharKernelSet();
+
+        // Overrides the automatic choice, for tests and benchmarks. Returns false (and keeps
+        // the current kernels) if the set isn't built in or the CPU can't run it.
+        KITSUNE_API_ bool SetCharKernelSet(CharKernelSet set);
+    }
+
     template<Character T>
     struct CharTraits
     {
         [[nodiscard]]
-        static inline Usize Length(const T* str)
+        KITSUNE_FORCEINLINE static Usize Length(const T* str)
         {
-            Usize len = 0;
-            for (; *str != T(); ++str, ++len);
-
-            return len;
+            return Internal::CharLength(str);
         }
 
         static inline T* Copy(T* dest, const T* source, Usize count)
@@ -40,27 +69,15 @@ namespace Kitsune
         }
 
         [[nodiscard]]
-        static inline int Compare(const T* str1, const T* str2, Usize count)
+        KITSUNE_FORCEINLINE static int Compare(const T* str1, const T* str2, Usize count)
         {
-            for (; count > 0; --count, ++str1, ++str2)
-            {
-                if (*str1 != *str2)
-                    return static_cast<int>(*str1 - *str2);
-            }
-
-            return 0;
+            return Internal::CharCompare(str1, str2, count);
         }
 
         [[nodiscard]]
-        static inline const T* Find(const T* haystack, Usize count, T needle)
+        KITSUNE_FORCEINLINE static const T* Find(const T* haystack, Usize count, T needle)
         {
-            for (; count > 0; --count, ++haystack)
-            {
-                if (*haystack == needle)
-                    return haystack;
-            }
-
-            return nullptr;
+            return Internal::CharFind(haystack, count, needle);
         }
     };
 
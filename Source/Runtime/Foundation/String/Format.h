@@ -1,35 +1,45 @@
 #pragma once
 
+#include <cstring>
+#include <type_traits>
+
 #include "Foundation/String/String.h"
 #include "Foundation/Containers/Array.h"
 
 #include "Foundation/String/Formatter.h"
 #include "Foundation/String/FormatScanner.h"
+#include "Foundation/String/FormatString.h"
 
 namespace Kitsune
 {
     namespace Internal
     {
+        template<typename StringType = String>
         class StringFormatIterator
         {
         public:
-            using ValueType = char;
-            using DifferenceType = IteratorTraits<String::Iterator>::DifferenceType;
+            using ValueType = typename StringType::ValueType;
+            using DifferenceType = typename IteratorTraits<typename StringType::Iterator>::DifferenceType;
 
         public:
             StringFormatIterator() = default;
-            explicit StringFormatIterator(String& string)
+            explicit StringFormatIterator(StringType& string)
                 : m_String(&string)
             {
             }
 
         public:
-            StringFormatIterator& operator=(char value)
+            StringFormatIterator& operator=(ValueType value)
             {
                 m_String->PushBack(value);
                 return *this;
             }
 
+            inline void Write(const ValueType* data, Usize count)
+            {
+                m_String->Append(data, count);
+            }
+
         public:
             StringFormatIterator& operator*() { return *this; }
 
@@ -37,14 +47,200 @@ namespace Kitsune
             StringFormatIterator operator++(int) { return *this; }
 
         private:
-            String* m_String = nullptr;
+            StringType* m_String = nullptr;
+        };
+
+        // Throws away everything written to it, only keeps count.
+        class CountingFormatIterator
+        {
+        public:
+            using ValueType = char;
+            using DifferenceType = Ptrdiff;
+
+        public:
+            CountingFormatIterator() = default;
+
+        public:
+            CountingFormatIterator& operator=(char /* value */)
+            {
+                ++m_Count;
+                return *this;
+            }
+
+            inline void Write(const char* /* data */, Usize count)
+            {
+                m_Count += count;
+            }
+
+        public:
+            CountingFormatIterator& operator*() { return *this; }
+
+            CountingFormatIterator& operator++()   { return *this; }
+            CountingFormatIterator operator++(int) { return *this; }
+
+        public:
+            [[nodiscard]] inline Usize GetCount() const { return m_Count; }
+
+        private:
+            Usize m_Count = 0;
+        };
+
+        template<WritableIterator<char> OutIt>
+        struct TruncatedOutput
+        {
+            OutIt Out;
+            Usize Limit;
+            Usize Count;
+        };
+
+        // Passes the first `Limit` characters on to the output and counts the rest. Only points
+        // to its state, so that it stays as cheap to pass around as a pointer.
+        template<WritableIterator<char> OutIt>
+        class TruncatingFormatIterator
+        {
+        public:
+            using ValueType = char;
+            using DifferenceType = Ptrdiff;
+
+        public:
+            TruncatingFormatIterator() = default;
+            explicit TruncatingFormatIterator(TruncatedOutput<OutIt>& output)
+                : m_Output(&output)
+            {
+            }
+
+        public:
+            TruncatingFormatIterator& operator=(char value)
+            {
+                if (m_Output->Count++ < m_Output->Limit)
+                    *m_Output->Out++ = value;
+
+                return *this;
+            }
+
+            inline void Write(const char* data, Usize count)
+            {
+                TruncatedOutput<OutIt>& output = *m_Output;
+
+                if (output.Count < output.Limit)
+                {
+                    Usize room = output.Limit - output.Count;
+                    output.Out = Algorithms::CopyN(data, KITSUNE_MIN(count, room), output.Out);
+                }
+
+                output.Count += count;
+            }
+
+        public:
+            TruncatingFormatIterator& operator*() { return *this; }
+
+            TruncatingFormatIterator& operator++()   { return *this; }
+            TruncatingFormatIterator operator++(int) { return *this; }
+
+        private:
+            TruncatedOutput<OutIt>* m_Output = nullptr;
+        };
+
+        template<typename StringType>
+        struct BufferedStringOutput
+        {
+            static constexpr Usize s_BufferSize = 512;
+
+            StringType* String;
+            Usize Size;
+            bool Spilled;
+
+            char Buffer[s_BufferSize];
+        };
+
+        // Collects the output on the stack and only moves over to the string once it stops
+        // fitting, so short results get allocated exactly once and nothing is formatted twice.
+        template<typename StringType>
+        class BufferedStringFormatIterator
+        {
+        public:
+            using ValueType = char;
+            using DifferenceType = Ptrdiff;
+
+        public:
+            BufferedStringFormatIterator() = default;
+            explicit BufferedStringFormatIterator(BufferedStringOutput<StringType>& output)
+                : m_Output(&output)
+            {
+            }
+
+        public:
+            BufferedStringFormatIterator& operator=(char value)
+            {
+                Write(&value, 1);
+                return *this;
+            }
+
+            inline void Write(const char* data, Usize count)
+            {
+                BufferedStringOutput<StringType>& output = *m_Output;
+
+                if (!output.Spilled)
+                {
+                    if (count <= output.s_BufferSize - output.Size)
+                    {
+                        std::memcpy(output.Buffer + output.Size, data, count);
+                        output.Size += count;
+
+                        return;
+                    }
+
+                    // Everything written so far moves into the string, the rest goes straight in.
+                    output.String->Reserve(output.Size + KITSUNE_MAX(count, output.s_BufferSize));
+                    output.String->Append(output.Buffer, output.Size);
+                    output.Spilled = true;
+                }
+
+                output.String->Append(data, count);
+            }
+
+        public:
+            BufferedStringFormatIterator& operator*() { return *this; }
+
+            BufferedStringFormatIterator& operator++()   { return *this; }
+            BufferedStringFormatIterator operator++(int) { return *this; }
+
+        private:
+            BufferedStringOutput<StringType>* m_Output = nullptr;
         };
+
+        // Writes a literal that still has its braces doubled, the FormatString checked that
+        // every brace in it is one of a pair.
+        template<WritableIterator<char> OutIt>
+        OutIt CopyEscapedLiteral(const char* begin, const char* end, OutIt out)
+        {
+            const char* run = begin;
+            for (const char* it = begin; it != end; ++it)
+            {
+                if (*it == '{' || *it == '}')
+                {
+                    out = Algorithms::Copy(run, ++it, out);
+                    run = it + 1;
+                }
+            }
+
+            return Algorithms::Copy(run, end, out);
+        }
     }
 
+    template<WritableIterator<char> OutIt>
+    struct FormatToNResult
+    {
+        OutIt Out;      // Past the last character written.
+        Usize Size;     // Size of the whole output, truncated or not.
+    };
+
     template<WritableIterator<char> OutIt, FormatScanner<OutIt> Scanner, typename... Args>
-    void FormatTo(OutIt&& out, Scanner&& scanner, const StringView fmt, Args&&... args)
+    OutIt FormatTo(OutIt out, Scanner&& scanner, const StringView fmt, Args&&... args)
     {
-        FormatArgumentPack<OutIt> argumentPack = MakeFormatArgumentPack<OutIt>(Forward<Args>(args)...);
+        // The pack only points into the store, keep the store alive for the whole call.
+        auto argumentStore = MakeFormatArgumentPack<OutIt>(Forward<Args>(args)...);
+        FormatArgumentPack<OutIt> argumentPack = argumentStore;
         StringView formatSpecs;
 
         StringView::Iterator pointer = fmt.GetBegin();
@@ -62,17 +258,103 @@ namespace Kitsune
             out = Scanner::ParseFormatSpecs(out, formatSpecs, argumentPack);
             pointer = formatSpecs.GetEnd();
         }
+
+        return out;
     }
 
+    // Only copies the literals split out by the FormatString and calls the formatter of each
+    // replacement field's argument, nothing gets scanned unless it's a RuntimeFormat().
+    template<WritableIterator<char> OutIt, typename... Args>
+    OutIt FormatTo(OutIt out, const FormatString<Args...>& fmt, Args&&... args)
+    {
+        using namespace Internal;
+
+        if (fmt.IsRuntime())
+            return FormatTo(out, DefaultFormatScanner(fmt.Get()), fmt.Get(), Forward<Args>(args)...);
+
+        using FormatFunction = OutIt (*)(OutIt, const StringView, const void*);
+
+        // One entry per argument, plus one so the arrays are never empty.
+        static constexpr FormatFunction formatters[] = { &FormatErasedArgument<OutIt, Args>..., nullptr };
+        const void* const pointers[] = { AddressOf(args)..., nullptr };
+
+        const char* format = fmt.Get().Data();
+        const FormatSegment* segments = fmt.GetSegments();
+
+        for (Usize i = 0; i < fmt.GetSegmentCount(); ++i)
+        {
+            const FormatSegment& segment = segments[i];
+
+            const char* literal = format + segment.LiteralBegin;
+            if (!segment.Escaped)
+                out = Algorithms::Copy(literal, literal + segment.LiteralSize, out);
+            else
+                out = CopyEscapedLiteral(literal, literal + segment.LiteralSize, out);
+
+            if (segment.Argument >= 0)
+            {
+                StringView specs(format + segment.SpecsBegin, segment.SpecsSize);
+                out = formatters[segment.Argument](out, specs, pointers[segment.Argument]);
+            }
+        }
+
+        return out;
+    }
+
+    // Writes at most `n` characters, the returned size tells how many the whole output needs.
+    template<WritableIterator<char> OutIt, typename... Args>
+    FormatToNResult<OutIt> FormatToN(OutIt out, Usize n, const FormatString<Args...>& fmt, Args&&... args)
+    {
+        using namespace Internal;
+
+        TruncatedOutput<OutIt> output = { out, n, 0 };
+        FormatTo(TruncatingFormatIterator<OutIt>(output), fmt, Forward<Args>(args)...);
+
+        return { output.Out, output.Count };
+    }
+
+    // Number of characters Format() would produce, without writing them anywhere.
     template<typename... Args>
-    [[nodiscard]] String Format(const StringView fmt, Args&&... args)
+    [[nodiscard]] Usize FormattedSize(const FormatString<Args...>& fmt, Args&&... args)
     {
         using namespace Internal;
+        return FormatTo(CountingFormatIterator(), fmt, Forward<Args>(args)...).GetCount();
+    }
 
-        String string(fmt.Size());
-        FormatTo(StringFormatIterator(string), DefaultFormatScanner(fmt), fmt,
-                 Forward<Args>(args)...);
+    namespace Internal
+    {
+        template<typename StringType, typename... Args>
+        StringType FormatIntoString(StringType&& string, const FormatString<Args...>& fmt, Args&&... args)
+        {
+            using Output = BufferedStringOutput<std::remove_reference_t<StringType>>;
+
+            Output output;
+            output.String = AddressOf(string);
+            output.Size = 0;
+            output.Spilled = false;
+
+            FormatTo(BufferedStringFormatIterator(output), fmt, Forward<Args>(args)...);
+
+            if (!output.Spilled)
+            {
+                string.Reserve(output.Size);
+                string.Append(output.Buffer, output.Size);
+            }
 
-        return string;
+            return Move(string);
+        }
+    }
+
+    template<typename... Args>
+    [[nodiscard]] String Format(const FormatString<Args...>& fmt, Args&&... args)
+    {
+        return Internal::FormatIntoString(String(), fmt, Forward<Args>(args)...);
+    }
+
+    template<Allocator Alloc, typename... Args>
+    [[nodiscard]] BasicString<char, Alloc> Format(const Alloc& alloc, const FormatString<Args...>& fmt,
+                                                  Args&&... args)
+    {
+        return Internal::FormatIntoString(BasicString<char, Alloc>(alloc), fmt, Forward<Args>(args)...);
     }
 }
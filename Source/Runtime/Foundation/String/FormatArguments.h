@@ -14,12 +14,43 @@ namespace Kitsune
         Boolean,
         Char,
         UnsignedInteger, SignedInteger,
-        FloatingPoint,
+        Float, Double,
         Pointer,
         String,
         Custom
     };
 
+    namespace Internal
+    {
+        template<typename T>
+        [[nodiscard]] constexpr FormatType GetFormatType()
+        {
+            using Pure = std::remove_cvref_t<T>;
+
+            if constexpr (std::is_same_v<Pure, bool>)
+                return FormatType::Boolean;
+            else if constexpr (std::is_same_v<Pure, char>)
+                return FormatType::Char;
+            else if constexpr (std::is_signed_v<Pure> && std::is_integral_v<Pure>)
+                return FormatType::SignedInteger;
+            else if constexpr (std::is_unsigned_v<Pure> && std::is_integral_v<Pure>)
+                return FormatType::UnsignedInteger;
+            else if constexpr (std::is_same_v<Pure, float>)
+                return FormatType::Float;
+            else if constexpr (std::is_floating_point_v<Pure>)
+                return FormatType::Double;
+
+            // Important! Check for string should be done before pointer
+            // check, b.c. const char* will fail.
+            else if constexpr (std::is_convertible_v<Pure, StringView>)
+                return FormatType::String;
+            else if constexpr (std::is_pointer_v<T>)
+                return FormatType::Pointer;
+            else
+                return FormatType::Custom;
+        }
+    }
+
     template<WritableIterator<char> OutIt>
     class CustomTypeHandle
     {
@@ -76,8 +107,10 @@ namespace Kitsune
                 m_SharedData.SignedInteger = value;
             else if constexpr (std::is_unsigned_v<Pure> && std::is_integral_v<Pure>)
                 m_SharedData.UnsignedInteger = value;
+            else if constexpr (std::is_same_v<Pure, float>)
+                m_SharedData.Float = value;
             else if constexpr (std::is_floating_point_v<Pure>)
-                m_SharedData.FloatingPoint = value;
+                m_SharedData.Double = static_cast<double>(value);
 
             // Important! Check for string should be done before pointer
             // check, b.c. const char* will fail.
@@ -99,7 +132,8 @@ namespace Kitsune
             case FormatType::Char:            Forward<Fn>(visitor)(m_SharedData.Char);            break;
             case FormatType::SignedInteger:   Forward<Fn>(visitor)(m_SharedData.SignedInteger);   break;
             case FormatType::UnsignedInteger: Forward<Fn>(visitor)(m_SharedData.UnsignedInteger); break;
-            case FormatType::FloatingPoint:   Forward<Fn>(visitor)(m_SharedData.FloatingPoint);   break;
+            case FormatType::Float:           Forward<Fn>(visitor)(m_SharedData.Float);           break;
+            case FormatType::Double:          Forward<Fn>(visitor)(m_SharedData.Double);          break;
             case FormatType::Pointer:         Forward<Fn>(visitor)(m_SharedData.Pointer);         break;
             case FormatType::String:          Forward<Fn>(visitor)(m_SharedData.String);          break;
             default:
@@ -111,27 +145,7 @@ namespace Kitsune
         template<typename T>
         [[nodiscard]] static inline FormatType GetFormatType()
         {
-            using Pure = std::remove_cvref_t<T>;
-
-            if constexpr (std::is_same_v<Pure, bool>)
-                return FormatType::Boolean;
-            else if constexpr (std::is_same_v<Pure, char>)
-                return FormatType::Char;
-            else if constexpr (std::is_signed_v<Pure> && std::is_integral_v<Pure>)
-                return FormatType::SignedInteger;
-            else if constexpr (std::is_unsigned_v<Pure> && std::is_integral_v<Pure>)
-                return FormatType::UnsignedInteger;
-            else if constexpr (std::is_floating_point_v<Pure>)
-                return FormatType::FloatingPoint;
-
-            // Important! Check for string should be done before pointer
-            // check, b.c. const char* will fail.
-            else if constexpr (std::is_convertible_v<Pure, StringView>)
-                return FormatType::String;
-            else if constexpr (std::is_pointer_v<T>)
-                return FormatType::Pointer;
-            else
-                return FormatType::Custom;
+            return Internal::GetFormatType<T>();
         }
 
     private:
@@ -142,7 +156,8 @@ namespace Kitsune
             char Char;
             Uint64 UnsignedInteger;
             Int64 SignedInteger;
-            long double FloatingPoint;
+            float Float;
+            double Double;
             void* Pointer;
             StringView String;
             CustomTypeHandle<OutIt> Custom;
@@ -1,13 +1,14 @@
 #pragma once
 
-#include <cstdlib>
 #include <concepts>
 
 #include "Foundation/String/String.h"
+#include "Foundation/String/FromChars.h"
 #include "Foundation/String/FormatArguments.h"
 
 #include "Foundation/Algorithms/Find.h"
 #include "Foundation/String/FormatException.h"
+#include "Foundation/Diagnostics/OutOfRangeException.h"
 
 #include "Foundation/String/Formatter.h"
 
@@ -77,7 +78,7 @@ namespace Kitsune
             }
             else if (formatSpecs.Size() > 2)
             {
-                Index index;
+                Index index = 0;
                 StringView contents(formatSpecs.GetBegin() + 1, formatSpecs.GetEnd() - 1);
 
                 auto colon = Algorithms::FindIf(contents.GetBegin(), contents.GetEnd(), IsNotDigit);
@@ -86,9 +87,15 @@ namespace Kitsune
                 if ((colon != contents.GetEnd()) && !isColon)
                     ThrowInvalidFormatSpecs();
 
-                // Get index from contents.
-                String indexStr = { contents.GetBegin(), colon };
-                index = static_cast<Index>(std::atoll(indexStr.Raw()));
+                // Get index from contents, no index at all means the first argument.
+                if (colon != contents.GetBegin())
+                {
+                    auto parsedIndex = ParseInt<Index>(StringView(contents.GetBegin(), colon));
+                    if (!parsedIndex)
+                        throw OutOfRangeException();
+
+                    index = parsedIndex.Value;
+                }
 
                 // Pass the rest of the arguments over to the formatter.
                 argumentPack[index].Visit([&](const auto& value)
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Iterators/Iterator.h"
+#include "Foundation/Algorithms/Copy.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        // Standard specifiers shared by the numeric formatters:
+        //
+        //     [[fill]align][sign][0][width][.precision][type]
+        //
+        // where align is one of '<', '>' or '^', sign one of '+', '-' or ' ', and type a single
+        // character left for the formatter to make sense of. A leading '0' pads with zeros
+        // after the sign, unless an alignment was given.
+        struct FormatSpecs
+        {
+            char Fill = ' ';
+            char Align = '\0';
+            char Sign = '-';
+            bool ZeroPad = false;
+
+            Uint16 Width = 0;
+            Int32 Precision = -1;   // -1 when not given.
+
+            char Type = '\0';
+        };
+
+        struct FormatPadding
+        {
+            Usize Before;
+            Usize Zeros;            // Goes between the sign and the rest.
+            Usize After;
+        };
+
+        [[nodiscard]] constexpr bool IsFormatAlign(char ch)
+        {
+            return (ch == '<') || (ch == '>') || (ch == '^');
+        }
+
+        [[nodiscard]] constexpr bool ParseFormatNumber(const char*& begin, const char* end, Uint32& number)
+        {
+            for (; begin != end && *begin >= '0' && *begin <= '9'; ++begin)
+            {
+                number = number * 10 + static_cast<Uint32>(*begin - '0');
+                if (number > 0xFFFF)
+                    return false;
+            }
+
+            return true;
+        }
+
+        // constexpr so that FormatString can run it at compile time, returns false if the
+        // specifiers are malformed rather than throwing.
+        [[nodiscard]] constexpr bool ParseFormatSpecs(const char* begin, const char* end, FormatSpecs& specs)
+        {
+            if ((end - begin) >= 2 && IsFormatAlign(begin[1]))
+            {
+                specs.Fill = begin[0];
+                specs.Align = begin[1];
+                begin += 2;
+            }
+            else if (begin != end && IsFormatAlign(*begin))
+            {
+                specs.Align = *begin++;
+            }
+
+            if (begin != end && (*begin == '+' || *begin == '-' || *begin == ' '))
+                specs.Sign = *begin++;
+
+            if (begin != end && *begin == '0')
+            {
+                specs.ZeroPad = true;
+                ++begin;
+            }
+
+            Uint32 width = 0;
+            if (!ParseFormatNumber(begin, end, width))
+                return false;
+
+            specs.Width = static_cast<Uint16>(width);
+
+            if (begin != end && *begin == '.')
+            {
+                Uint32 precision = 0;
+
+                const char* digits = ++begin;
+                if (!ParseFormatNumber(begin, end, precision) || begin == digits)
+                    return false;
+
+                specs.Precision = static_cast<Int32>(precision);
+            }
+
+            if (begin != end)
+                specs.Type = *begin++;
+
+            return (begin == end);
+        }
+
+        template<WritableIterator<char> Iter>
+        Iter WriteFill(Iter out, char fill, Usize count)
+        {
+            if constexpr (BulkWritableIterator<Iter, char>)
+            {
+                char chunk[32];
+                for (char& ch : chunk)
+                    ch = fill;
+
+                for (; count > sizeof(chunk); count -= sizeof(chunk))
+                    out.Write(chunk, sizeof(chunk));
+
+                return Algorithms::CopyN(chunk, count, out);
+            }
+            else
+            {
+                for (; count > 0; --count)
+                    *out++ = fill;
+
+                return out;
+            }
+        }
+
+        // Splits the room left by `size` characters in a field of the width of `specs`, values
+        // are right aligned unless asked otherwise.
+        [[nodiscard]] constexpr FormatPadding GetFormatPadding(const FormatSpecs& specs, Usize size)
+        {
+            Usize padding = (specs.Width > size) ? (specs.Width - size) : 0;
+
+            if (specs.ZeroPad && specs.Align == '\0')
+                return { 0, padding, 0 };
+
+            Usize before = (specs.Align == '<') ? 0 :
+                           (specs.Align == '^') ? padding / 2 :
+                                                  padding;
+
+            return { before, 0, padding - before };
+        }
+
+        // Writes [begin, end) padded up to the width of `specs`. The first `prefixSize`
+        // characters (the sign) stay in front of any zero padding.
+        template<WritableIterator<char> Iter>
+        Iter WritePadded(Iter out, const char* begin, const char* end,
+                         const FormatSpecs& specs, Usize prefixSize = 0)
+        {
+            FormatPadding padding = GetFormatPadding(specs, static_cast<Usize>(end - begin));
+            out = WriteFill(out, specs.Fill, padding.Before);
+
+            if (padding.Zeros > 0)
+            {
+                out = Algorithms::CopyN(begin, prefixSize, out);
+                out = WriteFill(out, '0', padding.Zeros);
+
+                begin += prefixSize;
+            }
+
+            out = Algorithms::Copy(begin, end, out);
+            return WriteFill(out, specs.Fill, padding.After);
+        }
+    }
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <type_traits>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/String/StringView.h"
+#include "Foundation/String/Formatter.h"
+#include "Foundation/String/FormatArguments.h"
+
+#include "Foundation/Memory/AddressOf.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        // Not constexpr on purpose: reaching one of these while checking a format string at
+        // compile time fails the build, and the message shows up in the diagnostic.
+        inline void InvalidFormatString(const char* /* reason */) { /* ... */ }
+
+        // A literal followed by an optional replacement field, as split up by FormatString.
+        struct FormatSegment
+        {
+            Uint16 LiteralBegin = 0;
+            Uint16 LiteralSize = 0;
+
+            Uint16 SpecsBegin = 0;      // Everything after the colon of the field.
+            Uint16 SpecsSize = 0;
+
+            Int16 Argument = -1;        // -1 when there's no field after the literal.
+            bool Escaped = false;       // The literal still contains doubled braces.
+        };
+
+        template<typename T>
+        using FormatStorageType =
+            std::conditional_t<GetFormatType<T>() == FormatType::Boolean,         bool,
+            std::conditional_t<GetFormatType<T>() == FormatType::Char,            char,
+            std::conditional_t<GetFormatType<T>() == FormatType::SignedInteger,   Int64,
+            std::conditional_t<GetFormatType<T>() == FormatType::UnsignedInteger, Uint64,
+            std::conditional_t<GetFormatType<T>() == FormatType::Float,           float,
+            std::conditional_t<GetFormatType<T>() == FormatType::Double,          double,
+            std::conditional_t<GetFormatType<T>() == FormatType::String,          StringView,
+            std::conditional_t<GetFormatType<T>() == FormatType::Pointer,         const void*,
+                                                                                   std::remove_cvref_t<T>>>>>>>>>;
+
+        template<typename T>
+        concept Formattable = requires (Formatter<FormatStorageType<T>> formatter, const ParseContext& context)
+        {
+            formatter.Parse(context);
+        };
+
+        // Arguments are formatted the same way FormatArgument would store them, so an `int`
+        // and an `Int64` go through the same Formatter<Int64> either way.
+        template<WritableIterator<char> OutIt, typename T>
+        OutIt FormatErasedArgument(OutIt out, const StringView specs, const void* pointer)
+        {
+            using Stored = FormatStorageType<T>;
+            const std::remove_reference_t<T>& value = *static_cast<const std::remove_reference_t<T>*>(pointer);
+
+            Formatter<Stored> formatter;
+            formatter.Parse(ParseContext(specs));
+
+            if constexpr (std::is_same_v<Stored, std::remove_cvref_t<T>>)
+                return formatter.Format(FormatContext<Stored, OutIt>(out, value));
+            else
+            {
+                const Stored stored = static_cast<Stored>(value);
+                return formatter.Format(FormatContext<Stored, OutIt>(out, stored));
+            }
+        }
+    }
+
+    // Format string only known at runtime, see RuntimeFormat().
+    struct RuntimeFormatString
+    {
+        StringView Format;
+    };
+
+    // Opts out of the compile-time checks, the string gets scanned on every call instead.
+    [[nodiscard]] inline RuntimeFormatString RuntimeFormat(const StringView fmt)
+    {
+        return { fmt };
+    }
+
+    // Format string split into literals and replacement fields at compile time. Indices are
+    // checked against the argument count and the specifiers of built-in types against what
+    // their formatter accepts, so most mistakes turn into build errors instead of exceptions.
+    //
+    // Only constructible from a constant expression, anything else has to go through
+    // RuntimeFormat().
+    template<typename... Args>
+    class BasicFormatString
+    {
+    public:
+        // Strings with more fields than this (repeating arguments) are still checked, but get
+        // formatted as if they were a RuntimeFormat().
+        static constexpr Usize s_SegmentCapacity = 2 * sizeof...(Args) + 2;
+
+    public:
+        template<typename S>
+            requires std::is_convertible_v<const S&, const char*>
+        consteval BasicFormatString(const S& fmt)
+            : m_Format(fmt), m_Size(0), m_SegmentCount(0), m_Segments()
+        {
+            // Checked here rather than on the class, overload resolution instantiates it
+            // with all kinds of argument lists that never get used.
+            static_assert((Internal::Formattable<Args> && ...), "Every argument needs a Formatter<T>.");
+
+            while (m_Format[m_Size] != '\0')
+                ++m_Size;
+
+            if (m_Size > 0xFFFF)
+                Internal::InvalidFormatString("Compile-time format strings are limited to 65535 characters.");
+
+            Parse();
+        }
+
+        inline BasicFormatString(RuntimeFormatString fmt)
+            : m_Format(fmt.Format.Data()), m_Size(fmt.Format.Size()),
+              m_SegmentCount(s_RuntimeSegmentCount), m_Segments()
+        {
+        }
+
+    public:
+        [[nodiscard]] inline StringView Get() const { return StringView(m_Format, m_Size); }
+        [[nodiscard]] inline bool IsRuntime() const { return (m_SegmentCount == s_RuntimeSegmentCount); }
+
+        [[nodiscard]] inline Usize GetSegmentCount() const { return m_SegmentCount; }
+        [[nodiscard]] inline const Internal::FormatSegment* GetSegments() const { return m_Segments; }
+
+    private:
+        static constexpr Usize s_RuntimeSegmentCount = ~Usize(0);
+
+    private:
+        consteval void Parse()
+        {
+            constexpr FormatType types[] = { Internal::GetFormatType<Args>()..., FormatType::Custom };
+
+            Usize literalBegin = 0;
+            Usize pos = 0;
+            bool escaped = false;
+
+            while (pos < m_Size)
+            {
+                char ch = m_Format[pos];
+
+                if ((ch == '{' && m_Format[pos + 1] == '{') || (ch == '}' && m_Format[pos + 1] == '}'))
+                {
+                    // Stays part of the literal, the second brace is skipped when it's written.
+                    escaped = true;
+                    pos += 2;
+                }
+                else if (ch == '}')
+                {
+                    Internal::InvalidFormatString("Format string contains an unmatched '}'.");
+                }
+                else if (ch == '{')
+                {
+                    Usize close = pos + 1;
+                    while (close < m_Size && m_Format[close] != '}')
+                        ++close;
+
+                    if (close == m_Size)
+                        Internal::InvalidFormatString("Format string contains an unmatched '{'.");
+
+                    Usize digit = pos + 1;
+                    Usize index = 0;
+
+                    for (; digit < close && m_Format[digit] >= '0' && m_Format[digit] <= '9'; ++digit)
+                        index = index * 10 + static_cast<Usize>(m_Format[digit] - '0');
+
+                    if (digit == pos + 1)
+                        Internal::InvalidFormatString("Replacement fields need an argument index.");
+
+                    if (digit != close && m_Format[digit] != ':')
+                        Internal::InvalidFormatString("Expected ':' or '}' after the argument index.");
+
+                    if (index >= sizeof...(Args))
+                        Internal::InvalidFormatString("Argument index is out of range.");
+
+                    Usize specsBegin = (digit == close) ? close : digit + 1;
+                    Usize specsSize = close - specsBegin;
+
+                    // Mirrors the checks done by the Parse() of the built-in formatters.
+                    FormatType type = types[index];
+                    bool isInteger = (type == FormatType::SignedInteger) ||
+                                     (type == FormatType::UnsignedInteger);
+
+                    if (type == FormatType::Boolean && specsSize > 1)
+                        Internal::InvalidFormatString("Invalid format specifier for this argument type.");
+
+                    bool isFloat = (type == FormatType::Float) || (type == FormatType::Double);
+
+                    const char* specsFirst = m_Format + specsBegin;
+                    const char* specsLast = m_Format + close;
+
+                    Internal::FormatSpecs specs;
+                    if ((isInteger && !Internal::ParseIntegerSpecs(specsFirst, specsLast, specs)) ||
+                        (isFloat && !Internal::ParseFloatSpecs(specsFirst, specsLast, specs)))
+                    {
+                        Internal::InvalidFormatString("Invalid format specifier for this argument type.");
+                    }
+
+                    AddSegment(literalBegin, pos, specsBegin, specsSize, static_cast<Int16>(index), escaped);
+                    literalBegin = pos = close + 1;
+                    escaped = false;
+                }
+                else
+                {
+                    ++pos;
+                }
+            }
+
+            if (literalBegin < m_Size)
+                AddSegment(literalBegin, m_Size, 0, 0, -1, escaped);
+        }
+
+        consteval void AddSegment(Usize literalBegin, Usize literalEnd, Usize specsBegin,
+                                  Usize specsSize, Int16 argument, bool escaped)
+        {
+            if (m_SegmentCount == s_RuntimeSegmentCount)
+                return;
+
+            if (m_SegmentCount == s_SegmentCapacity)
+            {
+                m_SegmentCount = s_RuntimeSegmentCount;
+                return;
+            }
+
+            m_Segments[m_SegmentCount++] = {
+                static_cast<Uint16>(literalBegin), static_cast<Uint16>(literalEnd - literalBegin),
+                static_cast<Uint16>(specsBegin), static_cast<Uint16>(specsSize),
+                argument, escaped
+            };
+        }
+
+    private:
+        const char* m_Format;
+        Usize m_Size;
+
+        Usize m_SegmentCount;
+        Internal::FormatSegment m_Segments[s_SegmentCapacity];
+    };
+
+    // Keeps the arguments from taking part in deduction, they're deduced from the call.
+    template<typename... Args>
+    using FormatString = BasicFormatString<std::type_identity_t<Args>...>;
+}
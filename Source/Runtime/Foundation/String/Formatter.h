@@ -1,12 +1,13 @@
 #pragma once
 
-#include <cstdio>
+#include <cmath>
 
 #include "Foundation/String/String.h"
 #include "Foundation/String/FormatException.h"
+#include "Foundation/String/FormatSpecs.h"
+#include "Foundation/String/ToChars.h"
 
 #include "Foundation/Algorithms/Copy.h"
-#include "Foundation/Algorithms/Reverse.h"
 
 namespace Kitsune
 {
@@ -130,85 +131,236 @@ namespace Kitsune
     };
 
 
+    namespace Internal
+    {
+        // Integers take the standard specifiers, followed by one of b, o, d or x for the
+        // base (case insensitive, hex digits are always uppercase).
+        [[nodiscard]] constexpr bool ParseIntegerSpecs(const char* begin, const char* end, FormatSpecs& specs)
+        {
+            if (!ParseFormatSpecs(begin, end, specs) || specs.Precision >= 0)
+                return false;
+
+            switch (specs.Type)
+            {
+            case '\0':
+            case 'b': case 'B':
+            case 'o': case 'O':
+            case 'd': case 'D':
+            case 'x': case 'X':
+                return true;
+
+            default:
+                return false;
+            }
+        }
+    }
+
     template<std::integral T>
     class Formatter<T>
     {
     public:
         void Parse(const ParseContext& context)
         {
-            if (context.GetSpecifierLength() > 1)
+            const char* begin = context.GetBegin();
+            const char* end = begin + context.GetSpecifierLength();
+
+            if (!Internal::ParseIntegerSpecs(begin, end, m_Specs))
                 Internal::ThrowTypeInvalidSpecifier();
 
-            auto it = context.GetBegin();
-            m_Base = ((*it == 'b') || (*it == 'B')) ? 2 :
-                     ((*it == 'o') || (*it == 'O')) ? 8 :
-                     ((*it == 'd') || (*it == 'D')) ? 10 :
-                     ((*it == 'x') || (*it == 'X')  ? 16 :
-                                                      10);
+            char type = m_Specs.Type;
+            m_Base = ((type == 'b') || (type == 'B')) ? 2 :
+                     ((type == 'o') || (type == 'O')) ? 8 :
+                     ((type == 'x') || (type == 'X')) ? 16 :
+                                                        10;
         }
 
         template<WritableIterator<char> Iter>
         Iter Format(const FormatContext<T, Iter>& context)
         {
-            using UnsignedType = std::make_unsigned_t<T>;
-            String str;
-
-            UnsignedType remainder;
-            UnsignedType value;
+            // One more for a '+' or ' ' in front of positive numbers.
+            char buffer[MaxIntegerChars<T> + 1];
+            char* begin = buffer + 1;
 
-            bool isNegative = (context.GetValue() < 0);
+            char* end = IntegerToChars(begin, context.GetValue(), m_Base);
+            Usize signSize = (*begin == '-') ? 1 : 0;
 
-            if ((m_Base != 10) || !isNegative)
-                std::memcpy(&value, &context.GetValue(), sizeof(T));
-            else
+            if (signSize == 0 && m_Base == 10 && m_Specs.Sign != '-')
             {
-                value = static_cast<UnsignedType>(~context.GetValue()) + 1;
+                *--begin = m_Specs.Sign;
+                signSize = 1;
             }
 
-            do
-            {
-                remainder = value % m_Base;
-                str += s_DigitsRep[remainder];
-
-                value /= m_Base;
-            } while (value != 0);
+            if (m_Specs.Width == 0)
+                return Algorithms::Copy(begin, end, context.GetOutput());
 
-            if (isNegative && (m_Base == 10))
-                str += '-';
-
-            Algorithms::Reverse(str.GetBegin(), str.GetEnd());
-            return Algorithms::Copy(str.GetBegin(), str.GetEnd(),
-                                    context.GetOutput());
+            return Internal::WritePadded(context.GetOutput(), begin, end, m_Specs, signSize);
         }
 
     private:
-        constexpr static char s_DigitsRep[] = "0123456789ABCDEF";
-        T m_Base;
+        Internal::FormatSpecs m_Specs;
+        Uint32 m_Base = 10;
     };
 
+    namespace Internal
+    {
+        // Floating point numbers take the standard specifiers, with one of e, f or g as the
+        // type. Without a type or a precision, they get the shortest round-trip representation.
+        [[nodiscard]] constexpr bool ParseFloatSpecs(const char* begin, const char* end, FormatSpecs& specs)
+        {
+            if (!ParseFormatSpecs(begin, end, specs))
+                return false;
+
+            switch (specs.Type)
+            {
+            case '\0':
+            case 'e': case 'E':
+            case 'f': case 'F':
+            case 'g': case 'G':
+                return true;
+
+            default:
+                return false;
+            }
+        }
+    }
+
     template<std::floating_point T>
     class Formatter<T>
     {
     public:
-        void Parse(const ParseContext& /* context */)
+        void Parse(const ParseContext& context)
         {
+            const char* begin = context.GetBegin();
+            const char* end = begin + context.GetSpecifierLength();
+
+            if (!Internal::ParseFloatSpecs(begin, end, m_Specs))
+                Internal::ThrowTypeInvalidSpecifier();
         }
 
         template<WritableIterator<char> Iter>
         Iter Format(const FormatContext<T, Iter>& context)
         {
-            long double value = static_cast<long double>(context.GetValue());
-            Usize count = static_cast<Usize>(std::snprintf(nullptr, 0, "%Lf", value) - 1);
+            // Long doubles go through double, there's no shortest representation for them.
+            using ValueType = std::conditional_t<std::is_same_v<T, float>, float, double>;
+            ValueType value = static_cast<ValueType>(context.GetValue());
+
+            char type = m_Specs.Type;
+            bool uppercase = (type == 'E') || (type == 'F') || (type == 'G');
+
+            char sign = std::signbit(value) ? '-' : ((m_Specs.Sign != '-') ? m_Specs.Sign : '\0');
+
+            if (!std::isfinite(value))
+                return FormatNonFinite(context.GetOutput(), std::isnan(value), uppercase, sign);
+
+            if (type == '\0' && m_Specs.Precision < 0)
+            {
+                char digits[MaxIntegerChars<Uint64>];
+
+                Internal::DecimalFloat decimal = Internal::ShortestDecimal(value);
+                Usize count = static_cast<Usize>(IntegerToChars(digits, decimal.Significand) - digits);
+
+                Int32 exponent = decimal.Exponent + static_cast<Int32>(count) - 1;
+                return WriteLayout(context.GetOutput(), Internal::GetShortestLayout(digits, count, exponent, sign));
+            }
+
+            char digits[Internal::s_MaxExactDigits];
+            Int32 exponent;
+
+            Int32 precision = (m_Specs.Precision < 0) ? 6 : m_Specs.Precision;
+            Internal::FloatLayout layout = { digits, 0, 0, 0, false, uppercase, sign };
+
+            if (type == 'e' || type == 'E')
+            {
+                layout.Count = Internal::ExactDecimalDigits(value, precision + 1, false, digits, exponent);
+                layout.Scientific = true;
+                layout.Decimals = static_cast<Usize>(precision);
+            }
+            else if (type == 'f' || type == 'F')
+            {
+                layout.Count = Internal::ExactDecimalDigits(value, precision, true, digits, exponent);
+                layout.Decimals = static_cast<Usize>(precision);
+            }
+            else
+            {
+                // General, fixed for exponents in [-4, precision), with the trailing zeros removed.
+                precision = KITSUNE_MAX(precision, 1);
+                layout.Count = Internal::ExactDecimalDigits(value, precision, false, digits, exponent);
+
+                while (layout.Count > 0 && digits[layout.Count - 1] == '0')
+                    --layout.Count;
+
+                Int64 significant = static_cast<Int64>(KITSUNE_MAX(layout.Count, Usize(1)));
+
+                layout.Scientific = (exponent < -4) || (exponent >= precision);
+                layout.Decimals = static_cast<Usize>(layout.Scientific ?
+                                                     significant - 1 :
+                                                     KITSUNE_MAX(significant - 1 - exponent, Int64(0)));
+            }
+
+            layout.Exponent = exponent;
+            return WriteLayout(context.GetOutput(), layout);
+        }
+
+    private:
+        template<WritableIterator<char> Iter>
+        Iter WriteLayout(Iter out, const Internal::FloatLayout& layout)
+        {
+            Usize size = layout.GetSize();
+
+            // Most numbers are short, lay them out on the stack and hand them over in one go.
+            if (size <= s_StackLayoutSize)
+            {
+                char buffer[s_StackLayoutSize];
+                char* end = layout.Write(buffer);
+
+                return Internal::WritePadded(out, buffer, end, m_Specs, (layout.Sign != '\0') ? 1 : 0);
+            }
+
+            Internal::FormatPadding padding = Internal::GetFormatPadding(m_Specs, size);
+            out = Internal::WriteFill(out, m_Specs.Fill, padding.Before);
+
+            if (padding.Zeros > 0)
+            {
+                if (layout.Sign != '\0')
+                    *out++ = layout.Sign;
+
+                out = Internal::WriteFill(out, '0', padding.Zeros);
+                out = layout.Write(out, false);
+            }
+            else
+            {
+                out = layout.Write(out);
+            }
+
+            return Internal::WriteFill(out, m_Specs.Fill, padding.After);
+        }
+
+        template<WritableIterator<char> Iter>
+        Iter FormatNonFinite(Iter out, bool isNaN, bool uppercase, char sign)
+        {
+            char buffer[4];
+            char* end = buffer;
 
-            String str(count, '\0');
-            std::snprintf(str.Data(), count, "%Lf", value);
+            if (sign != '\0')
+                *end++ = sign;
 
-            return Algorithms::Copy(str.GetBegin(), str.GetEnd(), context.GetOutput());
+            const char* text = isNaN ? (uppercase ? "NAN" : "nan") :
+                                       (uppercase ? "INF" : "inf");
+
+            end = Algorithms::Copy(text, text + 3, end);
+
+            // Zero padding would only make these look like numbers.
+            Internal::FormatSpecs specs = m_Specs;
+            specs.ZeroPad = false;
+
+            return Internal::WritePadded(out, buffer, end, specs);
         }
 
     private:
-        constexpr static char s_DigitsRep[] = "0123456789ABCDEF";
-        T m_Base;
+        static constexpr Usize s_StackLayoutSize = 64;
+
+    private:
+        Internal::FormatSpecs m_Specs;
     };
 
     template<typename T>
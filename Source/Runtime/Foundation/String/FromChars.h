@@ -0,0 +1,247 @@
+#pragma once
+
+#include <bit>
+#include <limits>
+#include <cstring>
+#include <concepts>
+#include <type_traits>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/String/StringView.h"
+
+namespace Kitsune
+{
+    enum class ParseError
+    {
+        None,
+        InvalidArgument,    // Doesn't start with a number.
+        OutOfRange          // Is a number, but not one the type can hold.
+    };
+
+    template<typename T>
+    struct ParseResult
+    {
+        T Value;
+        Usize Count;        // Characters that made up the number, errors included.
+        ParseError Error;
+
+    public:
+        [[nodiscard]] constexpr bool IsValid() const { return (Error == ParseError::None); }
+        constexpr explicit operator bool() const     { return IsValid(); }
+    };
+
+    namespace Internal
+    {
+        [[nodiscard]] constexpr bool IsDecimalDigit(char ch)
+        {
+            return (static_cast<Uint8>(ch - '0') < 10);
+        }
+
+        // Value of `ch` as a digit in bases up to 36, letters in either case. Anything that
+        // isn't a digit comes back as 36 or more.
+        [[nodiscard]] constexpr Uint32 DigitValue(char ch)
+        {
+            Uint32 digit = static_cast<Uint8>(ch - '0');
+            if (digit < 10)
+                return digit;
+
+            Uint32 letter = static_cast<Uint8>((ch | 0x20) - 'a');
+            return (letter < 26) ? letter + 10 : 36;
+        }
+
+        // Eight characters at once, in the order they're in the string.
+        [[nodiscard]] inline Uint64 LoadEightChars(const char* str)
+        {
+            Uint64 chars = 0;
+
+            if constexpr (std::endian::native == std::endian::little)
+                std::memcpy(&chars, str, sizeof(Uint64));
+            else
+            {
+                for (Usize i = 0; i < 8; ++i)
+                    chars |= static_cast<Uint64>(static_cast<Uint8>(str[i])) << (i * 8);
+            }
+
+            return chars;
+        }
+
+        // Whether all of the eight characters are '0' to '9': their high nibbles have to be
+        // 3, and adding 6 can't carry out of the low ones.
+        [[nodiscard]] constexpr bool IsEightDigits(Uint64 chars)
+        {
+            return (((chars & 0xF0F0F0F0F0F0F0F0ull) |
+                    (((chars + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull);
+        }
+
+        // Turns eight digits into their value with three multiplications, combining pairs of
+        // digits, then pairs of those, then the two halves.
+        [[nodiscard]] constexpr Uint32 ParseEightDigits(Uint64 chars)
+        {
+            constexpr Uint64 mask = 0x000000FF000000FFull;
+            constexpr Uint64 mul1 = 0x000F424000000064ull;     // 100 + (1000000 << 32)
+            constexpr Uint64 mul2 = 0x0000271000000001ull;     // 1 + (10000 << 32)
+
+            chars -= 0x3030303030303030ull;
+            chars = (chars * 10) + (chars >> 8);
+            chars = (((chars & mask) * mul1) + (((chars >> 16) & mask) * mul2)) >> 32;
+
+            return static_cast<Uint32>(chars);
+        }
+
+        // Decimal digits starting at `it`, as many as fit in a Uint64. Stops at the first
+        // non-digit or at the digit that would overflow, whichever comes first.
+        [[nodiscard]] inline const char* ParseDecimalDigits(const char* it, const char* end, Uint64& value)
+        {
+            // Skipped so that they don't count towards the 19 digits that always fit.
+            while (it != end && *it == '0')
+                ++it;
+
+            const char* digits = it;
+            Uint64 result = 0;
+
+            // Two blocks of eight leave room for three more digits without checking.
+            for (Usize i = 0; i < 2 && (end - it) >= 8; ++i)
+            {
+                Uint64 chars = LoadEightChars(it);
+                if (!IsEightDigits(chars))
+                    break;
+
+                result = result * 100000000 + ParseEightDigits(chars);
+                it += 8;
+            }
+
+            for (; it != end && IsDecimalDigit(*it); ++it)
+            {
+                Uint64 digit = static_cast<Uint64>(*it - '0');
+
+                if (it - digits >= 19 &&
+                    (it - digits > 19 || result > (std::numeric_limits<Uint64>::max() - digit) / 10))
+                {
+                    break;
+                }
+
+                result = result * 10 + digit;
+            }
+
+            value = result;
+            return it;
+        }
+
+        // Digits in bases other than 10, checked for overflow one at a time.
+        [[nodiscard]] inline const char* ParseBaseDigits(const char* it, const char* end, Uint32 base,
+                                                         Uint64& value, bool& overflow)
+        {
+            constexpr Uint64 maxValue = std::numeric_limits<Uint64>::max();
+            Uint64 result = 0;
+
+            for (; it != end; ++it)
+            {
+                Uint32 digit = DigitValue(*it);
+                if (digit >= base)
+                    break;
+
+                if (result > (maxValue - digit) / base)
+                    overflow = true;
+                else
+                    result = result * base + digit;
+            }
+
+            value = result;
+            return it;
+        }
+
+        KITSUNE_API_ ParseResult<double> ParseDouble(const char* str, Usize size);
+        KITSUNE_API_ ParseResult<float> ParseFloat(const char* str, Usize size);
+    }
+
+    // Parses the integer at the start of `str` in any base from 2 to 36 (letters in either
+    // case, no "0x" style prefixes). An optional '+' or '-' can come first, '-' is only
+    // allowed for signed types.
+    //
+    // Never allocates and doesn't need a null terminator. `Count` is the number of characters
+    // the number took, so checking it against the size tells whether there's anything after
+    // it. Numbers out of range still get all of their digits consumed, `Value` is zero then.
+    template<std::integral T>
+    [[nodiscard]] ParseResult<T> ParseInt(const StringView str, Uint32 base = 10)
+    {
+        static_assert(!std::is_same_v<T, bool>, "Template parameter `T` can't be bool.");
+
+        using UnsignedType = std::make_unsigned_t<T>;
+
+        const char* begin = str.Data();
+        const char* end = begin + str.Size();
+        const char* it = begin;
+
+        if (base < 2 || base > 36)
+            return { T(), 0, ParseError::InvalidArgument };
+
+        bool isNegative = false;
+        if (it != end && (*it == '+' || *it == '-'))
+        {
+            isNegative = (*it == '-');
+            if (isNegative && std::is_unsigned_v<T>)
+                return { T(), 0, ParseError::InvalidArgument };
+
+            ++it;
+        }
+
+        const char* digits = it;
+        Uint64 value = 0;
+        bool overflow = false;
+
+        if (base == 10)
+        {
+            it = Internal::ParseDecimalDigits(it, end, value);
+
+            // Stopped early, the rest of the digits belong to a number that's too big.
+            if (it != end && Internal::IsDecimalDigit(*it))
+            {
+                overflow = true;
+                while (it != end && Internal::IsDecimalDigit(*it))
+                    ++it;
+            }
+        }
+        else
+        {
+            it = Internal::ParseBaseDigits(it, end, base, value, overflow);
+        }
+
+        if (it == digits)
+            return { T(), 0, ParseError::InvalidArgument };
+
+        Usize count = static_cast<Usize>(it - begin);
+        Uint64 maxValue = static_cast<Uint64>(std::numeric_limits<T>::max()) + (isNegative ? 1 : 0);
+
+        if (overflow || value > maxValue)
+            return { T(), count, ParseError::OutOfRange };
+
+        UnsignedType bits = static_cast<UnsignedType>(value);
+        if (isNegative)
+            bits = static_cast<UnsignedType>(UnsignedType(0) - bits);
+
+        return { static_cast<T>(bits), count, ParseError::None };
+    }
+
+    // Parses the floating point number at the start of `str`, rounded to the nearest value
+    // exactly like the standard library would. Takes an optional sign, digits with an
+    // optional decimal point and exponent ("-12.5e-3"), "inf", "infinity" and "nan" in any
+    // case. Hexadecimal floats aren't supported.
+    //
+    // Nothing gets allocated. Numbers with up to 19 significant digits (nearly all of them)
+    // take a couple of multiplications, only values very close to halfway between two
+    // floats go through the slower exact path. Numbers too big or too small to be anything
+    // but infinity or zero give OutOfRange, with `Value` set to that.
+    template<std::floating_point T>
+    [[nodiscard]] ParseResult<T> ParseFloat(const StringView str)
+    {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+            "Template parameter `T` has to be either float or double.");
+
+        if constexpr (std::is_same_v<T, float>)
+            return Internal::ParseFloat(str.Data(), str.Size());
+        else
+            return Internal::ParseDouble(str.Data(), str.Size());
+    }
+}
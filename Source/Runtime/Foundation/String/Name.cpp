@@ -0,0 +1,226 @@
+#include "Foundation/String/Name.h"
+
+#include <cstddef>
+#include <cstring>
+
+#include "Foundation/Memory/VirtualMemory.h"
+#include "Foundation/Memory/BadAllocException.h"
+
+#include "Foundation/Threading/SpinLock.h"
+#include "Foundation/Threading/LockGuard.h"
+#include "Foundation/Threading/Interlocked.h"
+
+namespace Kitsune
+{
+    namespace
+    {
+        using Internal::NameEntry;
+
+        // Open addressing with linear probing, never more than half full so that every probe
+        // sequence ends in an empty slot. Slots only ever go from empty to an entry.
+        struct NameSlots
+        {
+            Usize Capacity;
+            const NameEntry* volatile Entries[1];
+        };
+
+        // Readers only load Slots and the entries in them, everything else belongs to
+        // whoever holds the lock.
+        struct alignas(64) NameShard
+        {
+            SpinLock Lock;
+            NameSlots* volatile Slots;
+            Usize Count;
+
+            Uint8* Cursor;
+            Uint8* End;
+        };
+
+        constexpr Usize s_ShardBits = 4;
+        constexpr Usize s_ShardCount = Usize(1) << s_ShardBits;
+
+        constexpr Usize s_InitialCapacity = 256;
+        constexpr Usize s_ArenaBlockSize = 64 * 1024;
+
+        // Names can be held by other statics, so the table is never destroyed and takes its
+        // memory straight from the OS rather than from Memory, which can be shut down.
+        NameShard s_Shards[s_ShardCount];
+
+        KITSUNE_FORCEINLINE Usize AlignUp(Usize value, Usize alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        // Committed pages come zeroed, which is what fresh slots need anyway.
+        void* AllocatePages(Usize bytes)
+        {
+            bytes = AlignUp(bytes, VirtualMemory::GetPageSize());
+
+            void* memory = VirtualMemory::Reserve(bytes);
+            if (memory == nullptr)
+                throw BadAllocException();
+
+            if (!VirtualMemory::Commit(memory, bytes))
+            {
+                VirtualMemory::Release(memory, bytes);
+                throw BadAllocException();
+            }
+
+            return memory;
+        }
+
+        NameSlots* AllocateSlots(Usize capacity)
+        {
+            auto* slots = static_cast<NameSlots*>(AllocatePages(offsetof(NameSlots, Entries) +
+                                                                capacity * sizeof(NameEntry*)));
+            slots->Capacity = capacity;
+
+            return slots;
+        }
+
+        const NameEntry* FindEntry(const NameSlots* slots, Usize hash, const char* str, Usize size)
+        {
+            Usize mask = slots->Capacity - 1;
+
+            for (Usize i = hash & mask;; i = (i + 1) & mask)
+            {
+                const NameEntry* entry = Interlocked::Load(&slots->Entries[i]);
+                if (entry == nullptr)
+                    return nullptr;
+
+                if (entry->Hash == hash && entry->Size == size && std::memcmp(entry->Data, str, size) == 0)
+                    return entry;
+            }
+        }
+
+        void PlaceEntry(NameSlots* slots, const NameEntry* entry)
+        {
+            Usize mask = slots->Capacity - 1;
+
+            Usize i = entry->Hash & mask;
+            while (slots->Entries[i] != nullptr)
+                i = (i + 1) & mask;
+
+            Interlocked::Store(&slots->Entries[i], entry);
+        }
+
+        // The old slots stay around, readers could still be probing them. They add up to
+        // less than the current ones.
+        NameSlots* GrowSlots(NameShard& shard)
+        {
+            NameSlots* slots = shard.Slots;
+            NameSlots* grown = AllocateSlots((slots != nullptr) ? slots->Capacity * 2 : s_InitialCapacity);
+
+            for (Usize i = 0; slots != nullptr && i < slots->Capacity; ++i)
+            {
+                if (slots->Entries[i] != nullptr)
+                    PlaceEntry(grown, slots->Entries[i]);
+            }
+
+            Interlocked::Store(&shard.Slots, grown);
+            return grown;
+        }
+
+        const NameEntry* CreateEntry(NameShard& shard, Usize hash, const char* str, Usize size)
+        {
+            Usize bytes = AlignUp(offsetof(NameEntry, Data) + size + 1, alignof(NameEntry));
+
+            Uint8* memory;
+            if (bytes > s_ArenaBlockSize / 4)
+            {
+                // Would waste most of a block, give it pages of its own.
+                memory = static_cast<Uint8*>(AllocatePages(bytes));
+            }
+            else
+            {
+                if (shard.Cursor == nullptr || bytes > static_cast<Usize>(shard.End - shard.Cursor))
+                {
+                    shard.Cursor = static_cast<Uint8*>(AllocatePages(s_ArenaBlockSize));
+                    shard.End = shard.Cursor + s_ArenaBlockSize;
+                }
+
+                memory = shard.Cursor;
+                shard.Cursor += bytes;
+            }
+
+            auto* entry = reinterpret_cast<NameEntry*>(memory);
+            entry->Hash = hash;
+            entry->Size = size;
+
+            std::memcpy(entry->Data, str, size);
+            entry->Data[size] = '\0';
+
+            return entry;
+        }
+    }
+
+    namespace Internal
+    {
+        Usize HashName(const char* str, Usize size)
+        {
+            constexpr Uint64 multiplier = 0x9E3779B97F4A7C15;
+
+            // Seeding with the size keeps strings that only differ by trailing zeros apart,
+            // and makes the empty string hash to 0.
+            Uint64 hash = static_cast<Uint64>(size) * multiplier;
+
+            for (; size >= sizeof(Uint64); str += sizeof(Uint64), size -= sizeof(Uint64))
+            {
+                Uint64 word;
+                std::memcpy(&word, str, sizeof(word));
+
+                hash = (hash ^ word) * multiplier;
+                hash ^= hash >> 32;
+            }
+
+            if (size != 0)
+            {
+                Uint64 word = 0;
+                std::memcpy(&word, str, size);
+
+                hash = (hash ^ word) * multiplier;
+            }
+
+            hash ^= hash >> 29;
+            hash *= 0xBF58476D1CE4E5B9;
+            hash ^= hash >> 32;
+
+            return static_cast<Usize>(hash);
+        }
+
+        const NameEntry* InternName(const char* str, Usize size)
+        {
+            if (size == 0)
+                return nullptr;
+
+            // Top bits pick the shard, the bottom ones the slot inside of it.
+            Usize hash = HashName(str, size);
+            NameShard& shard = s_Shards[hash >> (sizeof(Usize) * 8 - s_ShardBits)];
+
+            if (const NameSlots* slots = Interlocked::Load(&shard.Slots))
+            {
+                if (const NameEntry* entry = FindEntry(slots, hash, str, size))
+                    return entry;
+            }
+
+            LockGuard<SpinLock> guard(shard.Lock);
+
+            // Someone else might have added it (or grown the slots) in the meantime.
+            NameSlots* slots = shard.Slots;
+            if (slots != nullptr)
+            {
+                if (const NameEntry* entry = FindEntry(slots, hash, str, size))
+                    return entry;
+            }
+
+            if (slots == nullptr || (shard.Count + 1) * 2 > slots->Capacity)
+                slots = GrowSlots(shard);
+
+            const NameEntry* entry = CreateEntry(shard, hash, str, size);
+            PlaceEntry(slots, entry);
+            ++shard.Count;
+
+            return entry;
+        }
+    }
+}
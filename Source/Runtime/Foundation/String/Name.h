@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/String/StringView.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        // Lives in the global name table for the rest of the program, `Data` is followed by
+        // the rest of the characters and a null terminator.
+        struct NameEntry
+        {
+            Usize Hash;
+            Usize Size;
+            char Data[1];
+        };
+
+        // Finds or adds the entry for `str`, nullptr for the empty string. Lookups of strings
+        // that are already in the table don't take any locks.
+        [[nodiscard]] KITSUNE_API_ const NameEntry* InternName(const char* str, Usize size);
+
+        [[nodiscard]] KITSUNE_API_ Usize HashName(const char* str, Usize size);
+    }
+
+    // Interned, immutable string. Every distinct string is stored once for the whole program
+    // (and never freed), so comparing and hashing Names only looks at a pointer. Creating
+    // one from a string still has to hash and look it up, keep them around rather than
+    // creating them over and over.
+    //
+    // Construction is explicit so that temporaries don't end up in the table for good,
+    // comparing against a plain string just compares the characters.
+    class Name
+    {
+    public:
+        Name() = default;
+        Name(std::nullptr_t) = delete;
+
+        inline explicit Name(const char* str)
+            : Name(StringView(str))
+        {
+        }
+
+        inline explicit Name(const StringView str)
+            : m_Entry(Internal::InternName(str.Data(), str.Size()))
+        {
+        }
+
+    public:
+        [[nodiscard]] inline const char* Data() const
+        {
+            return (m_Entry != nullptr) ? m_Entry->Data : "";
+        }
+
+        [[nodiscard]] inline Usize Size() const { return (m_Entry != nullptr) ? m_Entry->Size : 0; }
+        [[nodiscard]] inline bool IsEmpty() const { return (m_Entry == nullptr); }
+
+        // Internal::HashName() of the characters, so it doesn't change between runs.
+        [[nodiscard]] inline Usize GetHash() const
+        {
+            return (m_Entry != nullptr) ? m_Entry->Hash : 0;
+        }
+
+        [[nodiscard]] inline StringView ToStringView() const { return StringView(Data(), Size()); }
+        operator StringView() const { return ToStringView(); }
+
+    public:
+        friend bool operator==(const Name& name1, const Name& name2) = default;
+
+        friend bool operator==(const Name& name, const StringView str)
+        {
+            return (name.ToStringView() == str);
+        }
+
+    private:
+        const Internal::NameEntry* m_Entry = nullptr;
+    };
+}
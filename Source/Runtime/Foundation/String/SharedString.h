@@ -0,0 +1,313 @@
+#pragma once
+
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+#include "Foundation/Concepts/Character.h"
+
+#include "Foundation/Templates/Move.h"
+#include "Foundation/Templates/Exchange.h"
+#include "Foundation/Templates/IsTriviallyRelocatable.h"
+
+#include "Foundation/String/String.h"
+#include "Foundation/String/StringView.h"
+
+#include "Foundation/Memory/Allocator.h"
+#include "Foundation/Memory/GlobalAllocator.h"
+
+#include "Foundation/Algorithms/Swap.h"
+#include "Foundation/Threading/Interlocked.h"
+#include "Foundation/Diagnostics/OutOfRangeException.h"
+
+namespace Kitsune
+{
+    // Reference counted string, copies share the same characters and only bump a counter
+    // (atomically, copies can be handed to other threads). Meant for strings that get read
+    // and passed around far more often than they change.
+    //
+    // Changing one is copy-on-write: a string that's the only owner of its characters
+    // changes them in place, otherwise it gets a copy of its own first. Nothing a string
+    // does is ever visible through its copies.
+    template<Character T, Allocator Alloc = GlobalAllocator>
+    class BasicSharedString
+    {
+    private:
+        static_assert(std::is_trivial_v<T>,
+            "Template parameter `T` has to be a trivial type.");
+
+        // Followed by the characters and a null terminator.
+        struct Header
+        {
+            Int32 RefCount;
+            Usize Size;
+            Usize Capacity;
+
+            inline T* Data() { return reinterpret_cast<T*>(this + 1); }
+        };
+
+    public:
+        using ValueType = T;
+        using AllocatorType = Alloc;
+
+        using ViewType = BasicStringView<T>;
+
+        using Iterator = const T*;
+        using ConstIterator = const T*;
+
+    public:
+        inline BasicSharedString() : m_Header(nullptr) { /* ... */ }
+        BasicSharedString(std::nullptr_t) = delete;
+
+        inline explicit BasicSharedString(const Alloc& alloc)
+            : m_Header(nullptr), m_Allocator(alloc)
+        {
+        }
+
+        inline BasicSharedString(const T* str, Usize size, const Alloc& alloc = Alloc())
+            : m_Header(nullptr), m_Allocator(alloc)
+        {
+            if (size != 0)
+                m_Header = MakeHeader(str, size, size);
+        }
+
+        inline BasicSharedString(const T* str, const Alloc& alloc = Alloc())
+            : BasicSharedString(str, CharTraits<T>::Length(str), alloc)
+        {
+        }
+
+        inline BasicSharedString(const ViewType& str, const Alloc& alloc = Alloc())
+            : BasicSharedString(str.Data(), str.Size(), alloc)
+        {
+        }
+
+        template<Allocator StringAlloc>
+        inline explicit BasicSharedString(const BasicString<T, StringAlloc>& str, const Alloc& alloc = Alloc())
+            : BasicSharedString(str.Data(), str.Size(), alloc)
+        {
+        }
+
+        inline BasicSharedString(const BasicSharedString& str)
+            : m_Header(str.m_Header), m_Allocator(str.m_Allocator)
+        {
+            if (m_Header != nullptr)
+                Interlocked::Increment(&m_Header->RefCount);
+        }
+
+        inline BasicSharedString(BasicSharedString&& str)
+            : m_Header(Exchange(str.m_Header, nullptr)), m_Allocator(Move(str.m_Allocator))
+        {
+        }
+
+        inline ~BasicSharedString()
+        {
+            Release();
+        }
+
+    public:
+        inline BasicSharedString& operator=(const BasicSharedString& str)
+        {
+            if (m_Header != str.m_Header)
+                BasicSharedString(str).Swap(*this);
+
+            return *this;
+        }
+
+        inline BasicSharedString& operator=(BasicSharedString&& str)
+        {
+            if (this != &str)
+                BasicSharedString(Move(str)).Swap(*this);
+
+            return *this;
+        }
+
+        inline BasicSharedString& operator=(const ViewType& str)
+        {
+            BasicSharedString(str, m_Allocator).Swap(*this);
+            return *this;
+        }
+
+        inline BasicSharedString& operator=(const T* str)
+        {
+            return (*this = ViewType(str));
+        }
+
+    public:
+        [[nodiscard]] inline const T& operator[](Index index) const
+        {
+            if (index >= Size())
+                throw OutOfRangeException();
+
+            return Data()[index];
+        }
+
+        inline BasicSharedString& operator+=(const ViewType& str) { Append(str); return *this; }
+        inline BasicSharedString& operator+=(T ch)                { PushBack(ch); return *this; }
+
+        operator ViewType() const { return ToStringView(); }
+
+    public:
+        [[nodiscard]] inline const T* Data() const
+        {
+            return (m_Header != nullptr) ? m_Header->Data() : s_Empty;
+        }
+
+        [[nodiscard]] inline Usize Size() const   { return (m_Header != nullptr) ? m_Header->Size : 0; }
+        [[nodiscard]] inline bool IsEmpty() const { return (Size() == 0); }
+
+        [[nodiscard]] inline Alloc& GetAllocator()             { return m_Allocator; }
+        [[nodiscard]] inline const Alloc& GetAllocator() const { return m_Allocator; }
+
+        // Number of strings sharing these characters, 0 for an empty string (which doesn't
+        // hold anything to share).
+        [[nodiscard]] inline Int32 GetUseCount() const
+        {
+            return (m_Header != nullptr) ? Interlocked::Load(&m_Header->RefCount) : 0;
+        }
+
+        // Whether changing the string would happen in place.
+        [[nodiscard]] inline bool IsUnique() const { return (GetUseCount() == 1); }
+
+        [[nodiscard]] inline ViewType ToStringView() const { return ViewType(Data(), Size()); }
+
+        [[nodiscard]] inline BasicString<T> ToString() const { return BasicString<T>(Data(), Size()); }
+
+    public:
+        [[nodiscard]] inline ConstIterator GetBegin() const { return Data(); }
+        [[nodiscard]] inline ConstIterator GetEnd() const   { return Data() + Size(); }
+
+        inline ConstIterator begin() const { return GetBegin(); }
+        inline ConstIterator end() const   { return GetEnd(); }
+
+    public:
+        // Characters that can be changed in place, copies the string first if it's shared.
+        // nullptr for an empty string. Only write through it until the string gets copied
+        // again, the copy shares the same characters.
+        [[nodiscard]] inline T* GetMutableData()
+        {
+            if (m_Header != nullptr && !IsUnique())
+                Detach(m_Header->Capacity);
+
+            return (m_Header != nullptr) ? m_Header->Data() : nullptr;
+        }
+
+        inline void Append(const T* str, Usize size)
+        {
+            if (size == 0)
+                return;
+
+            Usize oldSize = Size();
+            Usize newSize = oldSize + size;
+
+            if (m_Header == nullptr || newSize > m_Header->Capacity || !IsUnique())
+            {
+                // `str` could point into the old characters, they're released last.
+                Usize capacity = KITSUNE_MAX(newSize, static_cast<Usize>(static_cast<float>(oldSize) * s_AllocationFactor));
+                Header* header = MakeHeader(Data(), oldSize, capacity);
+
+                std::memcpy(header->Data() + oldSize, str, size * sizeof(T));
+                header->Data()[newSize] = T();
+                header->Size = newSize;
+
+                Release();
+                m_Header = header;
+            }
+            else
+            {
+                T* data = m_Header->Data();
+                m_Header->Size = newSize;
+
+                std::memcpy(data + oldSize, str, size * sizeof(T));
+                data[newSize] = T();
+            }
+        }
+
+        inline void Append(const T* str)        { Append(str, CharTraits<T>::Length(str)); }
+        inline void Append(const ViewType& str) { Append(str.Data(), str.Size()); }
+        inline void PushBack(T ch)              { Append(&ch, 1); }
+
+        // Drops this string's reference, copies keep their characters.
+        inline void Clear()
+        {
+            Release();
+            m_Header = nullptr;
+        }
+
+        inline void Swap(BasicSharedString& str)
+        {
+            Algorithms::Swap(m_Header, str.m_Header);
+            Algorithms::Swap(m_Allocator, str.m_Allocator);
+        }
+
+    public:
+        friend bool operator==(const BasicSharedString& str1, const BasicSharedString& str2)
+        {
+            // Copies of each other, no need to look at the characters.
+            if (str1.m_Header == str2.m_Header)
+                return true;
+
+            return (str1.ToStringView() == str2.ToStringView());
+        }
+
+        friend bool operator==(const BasicSharedString& str1, const ViewType& str2)
+        {
+            return (str1.ToStringView() == str2);
+        }
+
+        friend bool operator==(const BasicSharedString& str1, const T* str2)
+        {
+            return (str1.ToStringView() == ViewType(str2));
+        }
+
+    private:
+        inline Header* MakeHeader(const T* str, Usize size, Usize capacity)
+        {
+            auto* header = static_cast<Header*>(m_Allocator.Allocate(sizeof(Header) + (capacity + 1) * sizeof(T),
+                                                                     alignof(Header)));
+            header->RefCount = 1;
+            header->Size = size;
+            header->Capacity = capacity;
+
+            std::memcpy(header->Data(), str, size * sizeof(T));
+            header->Data()[size] = T();
+
+            return header;
+        }
+
+        // Gives this string characters of its own, with room for `capacity` of them.
+        KITSUNE_NOINLINE void Detach(Usize capacity)
+        {
+            Header* header = MakeHeader(Data(), Size(), capacity);
+
+            Release();
+            m_Header = header;
+        }
+
+        inline void Release()
+        {
+            if (m_Header != nullptr && Interlocked::Decrement(&m_Header->RefCount) == 0)
+                m_Allocator.Free(m_Header);
+        }
+
+    private:
+        static constexpr float s_AllocationFactor = 1.5f;
+        static constexpr T s_Empty[1] = { T() };
+
+    private:
+        Header* m_Header;
+        KITSUNE_MAYBE_OVERLAPPING Alloc m_Allocator;
+    };
+
+    // Only points to the shared characters, never into itself.
+    template<Character T, Allocator Alloc>
+    inline constexpr bool IsTriviallyRelocatable<BasicSharedString<T, Alloc>> = IsTriviallyRelocatable<Alloc>;
+
+    using SharedString = BasicSharedString<char>;
+    using WideSharedString = BasicSharedString<wchar_t>;
+
+    using U8SharedString = BasicSharedString<char8_t>;
+    using U16SharedString = BasicSharedString<char16_t>;
+    using U32SharedString = BasicSharedString<char32_t>;
+}
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <bit>
 #include <cstring>
 #include <type_traits>
 #include <initializer_list>
 
 #include "Foundation/Templates/Move.h"
+#include "Foundation/Templates/IsTriviallyRelocatable.h"
 
 #include "Foundation/String/StringView.h"
 #include "Foundation/Concepts/Character.h"
@@ -40,6 +42,9 @@ namespace Kitsune
         using ReverseIterator = Kitsune::ReverseIterator<Iterator>;
         using ReverseConstIterator = Kitsune::ReverseIterator<ConstIterator>;
 
+    public:
+        static constexpr Index s_NoPosition = ViewType::s_NoPosition;
+
     public:
         inline BasicString() : m_Data() { /* ... */ }
         BasicString(std::nullptr_t) = delete;
@@ -69,33 +74,33 @@ namespace Kitsune
         inline BasicString(Usize count, T ch, const Alloc& alloc)
             : BasicString(count, alloc)
         {
-            *Algorithms::UninitializedFillN(m_Data.Pointer, count, ch) = T();
-            m_Data.Size = count;
+            *Algorithms::UninitializedFillN(Data(), count, ch) = T();
+            m_Data.SetSize(count);
         }
 
         inline BasicString(Usize count, T ch, Alloc&& alloc = Alloc())
             : BasicString(count, Move(alloc))
         {
-            *Algorithms::UninitializedFillN(m_Data.Pointer, count, ch) = T();
-            m_Data.Size = count;
+            *Algorithms::UninitializedFillN(Data(), count, ch) = T();
+            m_Data.SetSize(count);
         }
 
         inline BasicString(const T* str, Usize size, const Alloc& alloc)
             : BasicString(size, alloc)
         {
-            std::memcpy(m_Data.Pointer, str, size * sizeof(T));
+            std::memcpy(Data(), str, size * sizeof(T));
 
-            m_Data.Pointer[size] = T();
-            m_Data.Size = size;
+            Data()[size] = T();
+            m_Data.SetSize(size);
         }
 
         inline BasicString(const T* str, Usize size, Alloc&& alloc = Alloc())
             : BasicString(size, Move(alloc))
         {
-            std::memcpy(m_Data.Pointer, str, size * sizeof(T));
+            std::memcpy(Data(), str, size * sizeof(T));
 
-            m_Data.Pointer[size] = T();
-            m_Data.Size = size;
+            Data()[size] = T();
+            m_Data.SetSize(size);
         }
 
         inline BasicString(const T* str, const Alloc& alloc)
@@ -112,16 +117,16 @@ namespace Kitsune
         inline BasicString(It begin, It end, const Alloc& alloc)
             : BasicString(Algorithms::Distance(begin, end), alloc)
         {
-            *Algorithms::UninitializedCopy(begin, end, m_Data.Pointer) = T();
-            m_Data.Size = Algorithms::Distance(begin, end);
+            *Algorithms::UninitializedCopy(begin, end, Data()) = T();
+            m_Data.SetSize(Algorithms::Distance(begin, end));
         }
 
         template<ForwardIterator It>
         inline BasicString(It begin, It end, Alloc&& alloc = Alloc())
             : BasicString(Algorithms::Distance(begin, end), Move(alloc))
         {
-            *Algorithms::UninitializedCopy(begin, end, m_Data.Pointer) = T();
-            m_Data.Size = Algorithms::Distance(begin, end);
+            *Algorithms::UninitializedCopy(begin, end, Data()) = T();
+            m_Data.SetSize(Algorithms::Distance(begin, end));
         }
 
         inline BasicString(const BasicString& str)
@@ -130,10 +135,8 @@ namespace Kitsune
         }
 
         inline BasicString(BasicString&& str)
+            : m_Data(str.m_Data), m_Allocator(Move(str.GetAllocator()))
         {
-            m_Data = Move(str.m_Data);
-            m_Allocator = Move(str.GetAllocator());
-
             str.m_Data.InitializeSSO();
         }
 
@@ -263,18 +266,18 @@ namespace Kitsune
             return Data()[Size() - 1];
         }
 
-        [[nodiscard]] inline T* Data()             { return m_Data.Pointer; }
-        [[nodiscard]] inline const T* Data() const { return m_Data.Pointer; }
+        [[nodiscard]] inline T* Data()             { return m_Data.GetPointer(); }
+        [[nodiscard]] inline const T* Data() const { return m_Data.GetPointer(); }
 
         [[nodiscard]] inline const T* Raw() const { return Data(); }
 
     public:
         [[nodiscard]] inline Usize Capacity() const
         {
-            return IsLocal() ? StringData::SmallBufferSize : m_Data.Shared.Capacity;
+            return m_Data.GetCapacity();
         }
 
-        [[nodiscard]] inline Usize Size() const   { return m_Data.Size; }
+        [[nodiscard]] inline Usize Size() const   { return m_Data.GetSize(); }
         [[nodiscard]] inline bool IsLocal() const { return m_Data.IsLocal(); }
 
         [[nodiscard]] inline Alloc& GetAllocator()             { return m_Allocator; }
@@ -304,27 +307,44 @@ namespace Kitsune
 
         inline void ShrinkToFit()
         {
+            if (IsLocal()) return;
+
             if (Size() > StringData::SmallBufferSize)
                 ReallocateGrowExact(Size());
             else
             {
-                std::memcpy(m_Data.Shared.Buffer, m_Data.Pointer, (Size() + 1) * sizeof(T));
-                m_Data.Pointer = m_Data.Shared.Buffer;
+                T* ptr = Data();
+                m_Data.SetLocal(ptr, Size());
+
+                FreeAllocation(ptr);
             }
         }
 
+        // Makes room for `count` characters without initialising them, and lets
+        // `op(Data(), count)` write the contents. The string ends up with as many characters
+        // as `op` returns, which can't be more than `count`.
+        template<typename Op>
+        inline void ResizeAndOverwrite(Usize count, Op op)
+        {
+            Reserve(count);
+            Usize size = static_cast<Usize>(op(Data(), count));
+
+            Data()[size] = T();
+            m_Data.SetSize(size);
+        }
+
     public:
         inline void Swap(BasicString& str)
         {
             Algorithms::Swap(m_Allocator, str.GetAllocator());
-            m_Data.Swap(str.m_Data);
+            Algorithms::Swap(m_Data, str.m_Data);
         }
 
     public:
         inline void Clear()
         {
             if (IsLocal()) return;
-            FreeAllocation(m_Data.Pointer);
+            FreeAllocation(Data());
 
             m_Data.InitializeSSO();
         }
@@ -380,10 +400,10 @@ namespace Kitsune
             if ((begin < GetBegin()) || (begin >= GetEnd()) || (end < GetBegin()) || (end > GetEnd()))
                 throw OutOfRangeException();
 
-            Usize removedSize = static_cast<Usize>(Algorithms::Distance(begin, end));
+            Usize newSize = Size() - static_cast<Usize>(Algorithms::Distance(begin, end));
             std::memmove(begin, end, (GetEnd() - end + 1) * sizeof(T));
 
-            m_Data.Size -= removedSize;
+            m_Data.SetSize(newSize);
         }
 
         inline void PushBack(T ch)
@@ -392,9 +412,13 @@ namespace Kitsune
             if (Capacity() < newSize)
                 ReallocateGrowExact(newSize);
 
-            ++m_Data.Size;
-            Data()[Size() - 1] = ch;
-            Data()[Size()] = T();
+            // Size goes first, character stores could alias the string itself and make the
+            // compiler check whether it's local all over again.
+            T* data = Data();
+            m_Data.SetSize(newSize);
+
+            data[newSize - 1] = ch;
+            data[newSize] = T();
         }
 
         inline void PopBack()
@@ -402,8 +426,10 @@ namespace Kitsune
             if (IsEmpty())
                 throw OutOfRangeException();
 
-            --m_Data.Size;
-            Data()[Size()] = T();
+            Usize newSize = Size() - 1;
+
+            Data()[newSize] = T();
+            m_Data.SetSize(newSize);
         }
 
         inline void Append(const BasicString& str) { Append(str.Raw(), str.Size()); }
@@ -416,19 +442,21 @@ namespace Kitsune
                 ReallocateGrow(newSize);
 
             *Algorithms::UninitializedFillN(GetEnd(), count, ch) = T();
-            m_Data.Size = newSize;
+            m_Data.SetSize(newSize);
         }
 
         inline void Append(const T* str, Usize size)
         {
-            Usize newSize = Size() + size;
+            Usize oldSize = Size();
+            Usize newSize = oldSize + size;
             if (Capacity() < newSize)
                 ReallocateGrow(newSize);
 
-            std::memcpy(GetEnd(), str, size * sizeof(T));
-            Data()[newSize] = T();
+            T* data = Data();
+            m_Data.SetSize(newSize);
 
-            m_Data.Size = newSize;
+            std::memcpy(data + oldSize, str, size * sizeof(T));
+            data[newSize] = T();
         }
 
         template<ForwardIterator It>
@@ -439,7 +467,7 @@ namespace Kitsune
                 ReallocateGrow(newSize);
 
             *Algorithms::UninitializedCopy(begin, end, GetEnd()) = T();
-            m_Data.Size = newSize;
+            m_Data.SetSize(newSize);
         }
 
         inline void Append(std::initializer_list<T> ilist) { Append(ilist.begin(), ilist.end()); }
@@ -450,6 +478,35 @@ namespace Kitsune
             return BasicString(GetBegin() + startPos, count, GetAllocator());
         }
 
+        // Same characters as Substring() without copying them, the view is only good for as
+        // long as the string isn't changed. `count` gets clamped to what's left.
+        [[nodiscard]] inline ViewType Slice(Usize startPos, Usize count = s_NoPosition) const
+        {
+            if (startPos > Size())
+                throw OutOfRangeException();
+
+            return ViewType(Data() + startPos, KITSUNE_MIN(count, Size() - startPos));
+        }
+
+    public:
+        [[nodiscard]] inline Index Find(const ViewType& str, Index startPos = 0) const
+        {
+            return ViewType(*this).Find(str, startPos);
+        }
+
+        [[nodiscard]] inline Index Find(T ch, Index startPos = 0) const
+        {
+            return ViewType(*this).Find(ch, startPos);
+        }
+
+        [[nodiscard]] inline Index FindAny(const ViewType& chars, Index startPos = 0) const
+        {
+            return ViewType(*this).FindAny(chars, startPos);
+        }
+
+        [[nodiscard]] inline bool Contains(const ViewType& str) const { return ViewType(*this).Contains(str); }
+        [[nodiscard]] inline bool Contains(T ch) const                { return ViewType(*this).Contains(ch); }
+
     public:
         // Should not be called by engine/client code.
         // Made public so that the compiler can generate range-based for loops.
@@ -486,15 +543,44 @@ namespace Kitsune
 
         inline void ReallocateGrowExact(Usize newCapacity)
         {
+            if (!IsLocal() && TryReallocateInPlace(newCapacity))
+                return;
+
             T* ptr = MakeAllocation(newCapacity + 1);
             std::memcpy(ptr, Raw(), (Size() + 1) * sizeof(T));
 
             Usize size = Size();
             Clear();
 
-            m_Data.Pointer = ptr;
-            m_Data.Size = size;
-            m_Data.Shared.Capacity = newCapacity;
+            m_Data.SetHeap(ptr, size, newCapacity);
+        }
+
+        // Same as Array's, characters are trivial so realloc() style moves are always fine.
+        inline bool TryReallocateInPlace(Usize newCapacity)
+        {
+            Usize bytes = (newCapacity + 1) * sizeof(T);
+
+            if constexpr (ExpandableAllocator<Alloc>)
+            {
+                if (newCapacity > Capacity() && m_Allocator.TryExpand(Data(), bytes))
+                {
+                    m_Data.SetHeap(Data(), Size(), newCapacity);
+                    return true;
+                }
+            }
+
+            if constexpr (ReallocatableAllocator<Alloc>)
+            {
+                T* ptr = static_cast<T*>(m_Allocator.TryReallocate(Data(), bytes, alignof(T)));
+                if (ptr != nullptr)
+                {
+                    m_Data.SetHeap(ptr, Size(), newCapacity);
+                    return true;
+                }
+            }
+
+            KITSUNE_UNUSED(bytes);
+            return false;
         }
 
     private:
@@ -506,8 +592,8 @@ namespace Kitsune
             if (Capacity() < size)
                 BasicString(size, Move(m_Allocator)).Swap(*this);
 
-            *Algorithms::UninitializedCopy(begin, end, m_Data.Pointer) = T();
-            m_Data.Size = size;
+            *Algorithms::UninitializedCopy(begin, end, Data()) = T();
+            m_Data.SetSize(size);
         }
 
         inline void InitializeCapacity(Usize size)
@@ -517,12 +603,10 @@ namespace Kitsune
             else
             {
                 Usize adjusted = GetAdjustedCapacity(size);
-
-                m_Data.Pointer = MakeAllocation(adjusted + 1);
-                m_Data.Shared.Capacity = adjusted;
+                m_Data.SetHeap(MakeAllocation(adjusted + 1), 0, adjusted);
             }
 
-            *m_Data.Pointer = T();
+            *Data() = T();
         }
 
         inline Iterator ShiftEnd(Iterator from, Usize offset)
@@ -539,7 +623,7 @@ namespace Kitsune
             Iterator fromIt = GetBegin() + index;
             std::memmove(fromIt + offset, fromIt, sizeof(T) * (GetEnd() - fromIt + 1));
 
-            m_Data.Size += offset;
+            m_Data.SetSize(newSize);
             return fromIt;
         }
 
@@ -547,69 +631,106 @@ namespace Kitsune
         static constexpr float s_AllocationFactor = 1.5f;
 
     private:
+        // Three words. Heap strings store a pointer, the size and the capacity, local ones
+        // use all of it as the buffer and keep how much room is left in the last character,
+        // which is the null terminator once the buffer is full.
+        //
+        // Heap strings set the top bit of the capacity, which lands in the last byte of the
+        // struct on little-endian targets. Room left is never large enough to reach that bit.
         class StringData
         {
         public:
             StringData() { InitializeSSO(); }
-            StringData(StringData&& data)
-                : Pointer(data.Pointer), Size(data.Size), Shared(data.Shared)
-            {
-                if (data.IsLocal())
-                    Pointer = data.Shared.Buffer;
 
-                data.InitializeSSO();
+        public:
+            // Clears every byte rather than just the first character, copies of the string
+            // then never read anything uninitialised.
+            inline void InitializeSSO()
+            {
+                Heap = HeapData();
+                SetLocalSize(0);
             }
 
-            StringData& operator=(StringData&& data)
+            // Copies `size` characters and the terminator after them into the local buffer.
+            inline void SetLocal(const T* str, Usize size)
             {
-                Size = data.Size;
-                Shared = data.Shared;
+                std::memcpy(Local, str, (size + 1) * sizeof(T));
+                SetLocalSize(size);
+            }
 
-                Pointer = data.IsLocal() ? Shared.Buffer : data.Pointer;
+            inline void SetHeap(T* pointer, Usize size, Usize capacity)
+            {
+                Heap.Pointer = pointer;
+                Heap.Size = size;
+                Heap.Capacity = capacity | s_HeapFlag;
+            }
 
-                data.InitializeSSO();
-                return *this;
+            inline void SetSize(Usize size)
+            {
+                if (IsLocal())
+                    SetLocalSize(size);
+                else
+                    Heap.Size = size;
             }
 
         public:
-            inline void InitializeSSO()
+            inline bool IsLocal() const
             {
-                Pointer = Shared.Buffer;
-                Pointer[0] = T();
-
-                Size = 0;
+                return ((reinterpret_cast<const Uint8*>(this)[sizeof(StringData) - 1] & 0x80) == 0);
             }
 
-            inline bool IsLocal() const { return (Pointer == Shared.Buffer); }
+            inline T* GetPointer()             { return IsLocal() ? Local : Heap.Pointer; }
+            inline const T* GetPointer() const { return IsLocal() ? Local : Heap.Pointer; }
 
-            inline void Swap(StringData& data)
+            inline Usize GetSize() const
             {
-                T* dataPointer = data.Pointer;
-                data.Pointer = IsLocal() ? data.Shared.Buffer : Pointer;
-                Pointer = (dataPointer == data.Shared.Buffer) ? Shared.Buffer : dataPointer;
+                return IsLocal() ? SmallBufferSize - static_cast<Usize>(Local[SmallBufferSize]) : Heap.Size;
+            }
 
-                Algorithms::Swap(Size, data.Size);
-                Algorithms::Swap(Shared, data.Shared);
+            inline Usize GetCapacity() const
+            {
+                return IsLocal() ? SmallBufferSize : (Heap.Capacity & ~s_HeapFlag);
             }
 
-        public:
-            static constexpr Usize SmallBufferSize = KITSUNE_MAX(2, 16 / sizeof(T)) - 1;
+        private:
+            inline void SetLocalSize(Usize size)
+            {
+                Local[SmallBufferSize] = static_cast<T>(SmallBufferSize - size);
+            }
+
+        private:
+            struct HeapData
+            {
+                T* Pointer;
+                Usize Size;
+                Usize Capacity;
+            };
+
+            static constexpr Usize s_HeapFlag = Usize(1) << (sizeof(Usize) * 8 - 1);
 
         public:
-            T* Pointer;
-            Usize Size;
+            static constexpr Usize SmallBufferSize = sizeof(HeapData) / sizeof(T) - 1;
 
+        private:
             union
             {
-                T Buffer[SmallBufferSize + 1];
-                Usize Capacity;
-            } Shared;
+                HeapData Heap;
+                T Local[SmallBufferSize + 1];
+            };
         };
 
+        static_assert(std::endian::native == std::endian::little,
+            "The local/heap flag has to be in the last byte of StringData.");
+        static_assert(sizeof(StringData) == 3 * sizeof(Usize));
+
         StringData m_Data;
-        Alloc m_Allocator;
+        KITSUNE_MAYBE_OVERLAPPING Alloc m_Allocator;
     };
 
+    // Nothing points into the string itself, local characters included.
+    template<Character T, Allocator Alloc>
+    inline constexpr bool IsTriviallyRelocatable<BasicString<T, Alloc>> = IsTriviallyRelocatable<Alloc>;
+
     namespace Algorithms
     {
         template<Character T, Allocator Alloc>
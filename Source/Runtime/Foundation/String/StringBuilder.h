@@ -0,0 +1,375 @@
+#pragma once
+
+#include <cstring>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+#include "Foundation/Concepts/Character.h"
+
+#include "Foundation/Templates/Move.h"
+#include "Foundation/Templates/Exchange.h"
+
+#include "Foundation/String/String.h"
+#include "Foundation/String/StringView.h"
+#include "Foundation/Logging/IStream.h"
+
+#include "Foundation/Memory/Allocator.h"
+#include "Foundation/Memory/GlobalAllocator.h"
+
+namespace Kitsune
+{
+    // Builds up long strings out of a list of chunks instead of a single buffer, appending
+    // never moves what's already been written. ToString() flattens it when it's needed,
+    // GetChunks() and WriteTo() hand out the chunks as they are.
+    //
+    // Chunks come from `Alloc`, a LinearAllocator puts the whole builder in an arena.
+    template<Character T, Allocator Alloc = GlobalAllocator>
+    class BasicStringBuilder
+    {
+    private:
+        struct Chunk
+        {
+            Chunk* Next;
+            Usize Size;
+            Usize Capacity;
+
+            inline T* Data() { return reinterpret_cast<T*>(this + 1); }
+            inline const T* Data() const { return reinterpret_cast<const T*>(this + 1); }
+        };
+
+    public:
+        using ValueType = T;
+        using AllocatorType = Alloc;
+
+        using ViewType = BasicStringView<T>;
+
+        // Walks the chunks in order, each one as a view of the characters in it.
+        class ChunkIterator
+        {
+        public:
+            using ValueType = ViewType;
+            using DifferenceType = Ptrdiff;
+
+        public:
+            ChunkIterator() = default;
+            explicit ChunkIterator(const Chunk* chunk) : m_Chunk(chunk) { /* ... */ }
+
+        public:
+            inline ViewType operator*() const { return ViewType(m_Chunk->Data(), m_Chunk->Size); }
+
+            inline ChunkIterator& operator++()
+            {
+                m_Chunk = m_Chunk->Next;
+                return *this;
+            }
+
+            inline ChunkIterator operator++(int)
+            {
+                ChunkIterator copy = *this;
+                m_Chunk = m_Chunk->Next;
+
+                return copy;
+            }
+
+            friend bool operator==(const ChunkIterator&, const ChunkIterator&) = default;
+
+        private:
+            const Chunk* m_Chunk = nullptr;
+        };
+
+        class ChunkRange
+        {
+        public:
+            explicit ChunkRange(const Chunk* head) : m_Head(head) { /* ... */ }
+
+        public:
+            [[nodiscard]] inline ChunkIterator GetBegin() const { return ChunkIterator(m_Head); }
+            [[nodiscard]] inline ChunkIterator GetEnd() const   { return ChunkIterator(); }
+
+            inline ChunkIterator begin() const { return GetBegin(); }
+            inline ChunkIterator end() const   { return GetEnd(); }
+
+        private:
+            const Chunk* m_Head;
+        };
+
+        // Appends whatever gets written through it, for FormatTo() and Algorithms::Copy().
+        class AppendIterator
+        {
+        public:
+            using ValueType = T;
+            using DifferenceType = Ptrdiff;
+
+        public:
+            AppendIterator() = default;
+            explicit AppendIterator(BasicStringBuilder& builder) : m_Builder(&builder) { /* ... */ }
+
+        public:
+            inline AppendIterator& operator=(T ch)
+            {
+                m_Builder->PushBack(ch);
+                return *this;
+            }
+
+            inline void Write(const T* data, Usize count)
+            {
+                m_Builder->Append(data, count);
+            }
+
+        public:
+            inline AppendIterator& operator*() { return *this; }
+
+            inline AppendIterator& operator++()   { return *this; }
+            inline AppendIterator operator++(int) { return *this; }
+
+        private:
+            BasicStringBuilder* m_Builder = nullptr;
+        };
+
+    public:
+        // Characters in a chunk, anything appended in one go that's longer than that gets a
+        // chunk of its own size.
+        static constexpr Usize s_DefaultChunkSize = 4096;
+
+    public:
+        inline BasicStringBuilder()
+            : BasicStringBuilder(Alloc())
+        {
+        }
+
+        inline explicit BasicStringBuilder(const Alloc& alloc, Usize chunkSize = s_DefaultChunkSize)
+            : m_Head(nullptr), m_Tail(nullptr), m_Size(0),
+              m_ChunkSize((chunkSize != 0) ? chunkSize : 1), m_Allocator(alloc)
+        {
+        }
+
+        inline explicit BasicStringBuilder(Usize chunkSize)
+            : BasicStringBuilder(Alloc(), chunkSize)
+        {
+        }
+
+        inline BasicStringBuilder(BasicStringBuilder&& builder)
+            : m_Head(Exchange(builder.m_Head, nullptr)), m_Tail(Exchange(builder.m_Tail, nullptr)),
+              m_Size(Exchange(builder.m_Size, 0)), m_ChunkSize(builder.m_ChunkSize),
+              m_Allocator(Move(builder.GetAllocator()))
+        {
+        }
+
+        inline ~BasicStringBuilder()
+        {
+            FreeChunks(m_Head);
+        }
+
+    public:
+        BasicStringBuilder(const BasicStringBuilder&) = delete;
+        BasicStringBuilder& operator=(const BasicStringBuilder&) = delete;
+
+        // The chunks come along with the allocator they were made with.
+        inline BasicStringBuilder& operator=(BasicStringBuilder&& builder)
+        {
+            if (this == &builder) return *this;
+            FreeChunks(m_Head);
+
+            m_Head = Exchange(builder.m_Head, nullptr);
+            m_Tail = Exchange(builder.m_Tail, nullptr);
+            m_Size = Exchange(builder.m_Size, 0);
+
+            m_ChunkSize = builder.m_ChunkSize;
+            m_Allocator = Move(builder.GetAllocator());
+
+            return *this;
+        }
+
+    public:
+        inline void PushBack(T ch)
+        {
+            if (m_Tail == nullptr || m_Tail->Size == m_Tail->Capacity)
+                AddChunk(1);
+
+            m_Tail->Data()[m_Tail->Size++] = ch;
+            ++m_Size;
+        }
+
+        inline void Append(const T* str, Usize size)
+        {
+            // Kept small enough to inline, the copy is a couple of moves for short literals.
+            if (m_Tail != nullptr && size <= m_Tail->Capacity - m_Tail->Size)
+            {
+                std::memcpy(m_Tail->Data() + m_Tail->Size, str, size * sizeof(T));
+
+                m_Tail->Size += size;
+                m_Size += size;
+            }
+            else
+            {
+                AppendToNewChunk(str, size);
+            }
+        }
+
+        inline void Append(Usize count, T ch)
+        {
+            for (Usize i = 0; i < count; ++i)
+                PushBack(ch);
+        }
+
+        inline void Append(const T* str)       { Append(str, CharTraits<T>::Length(str)); }
+        inline void Append(const ViewType& str) { Append(str.Data(), str.Size()); }
+
+        template<Allocator StringAlloc>
+        inline void Append(const BasicString<T, StringAlloc>& str)
+        {
+            Append(str.Data(), str.Size());
+        }
+
+        // Keeps the first chunk around for whatever gets built next.
+        inline void Clear()
+        {
+            if (m_Head == nullptr)
+                return;
+
+            FreeChunks(Exchange(m_Head->Next, nullptr));
+            m_Head->Size = 0;
+
+            m_Tail = m_Head;
+            m_Size = 0;
+        }
+
+    public:
+        [[nodiscard]] inline Usize Size() const     { return m_Size; }
+        [[nodiscard]] inline bool IsEmpty() const   { return (m_Size == 0); }
+
+        [[nodiscard]] inline Usize GetChunkSize() const { return m_ChunkSize; }
+
+        [[nodiscard]] inline Alloc& GetAllocator()             { return m_Allocator; }
+        [[nodiscard]] inline const Alloc& GetAllocator() const { return m_Allocator; }
+
+        [[nodiscard]] inline AppendIterator GetAppendIterator() { return AppendIterator(*this); }
+
+        // Chunks, in order, as views into the builder. They stay valid until it's cleared,
+        // appending only ever adds new ones.
+        [[nodiscard]] inline ChunkRange GetChunks() const { return ChunkRange(m_Head); }
+
+        [[nodiscard]] inline Usize GetChunkCount() const
+        {
+            Usize count = 0;
+            for (const Chunk* chunk = m_Head; chunk != nullptr; chunk = chunk->Next)
+                ++count;
+
+            return count;
+        }
+
+    public:
+        // Copies all of the characters into `dest`, which needs room for Size() of them. No
+        // null terminator gets written.
+        inline void CopyTo(T* dest) const
+        {
+            for (const Chunk* chunk = m_Head; chunk != nullptr; chunk = chunk->Next)
+            {
+                std::memcpy(dest, chunk->Data(), chunk->Size * sizeof(T));
+                dest += chunk->Size;
+            }
+        }
+
+        // Writes out one chunk at a time, nothing gets flattened first.
+        inline void WriteTo(IWriteStream<T>& stream) const
+        {
+            for (const Chunk* chunk = m_Head; chunk != nullptr; chunk = chunk->Next)
+            {
+                if (chunk->Size != 0)
+                    stream.Write(chunk->Data(), chunk->Size);
+            }
+        }
+
+        [[nodiscard]] inline BasicString<T> ToString() const
+        {
+            return ToString(GlobalAllocator());
+        }
+
+        template<Allocator StringAlloc>
+        [[nodiscard]] inline BasicString<T, StringAlloc> ToString(const StringAlloc& alloc) const
+        {
+            BasicString<T, StringAlloc> string(alloc);
+            string.ResizeAndOverwrite(m_Size, [this](T* dest, Usize size)
+            {
+                CopyTo(dest);
+                return size;
+            });
+
+            return string;
+        }
+
+    private:
+        // Fills up the current chunk, the rest goes into a new one in one piece. The new chunk
+        // gets allocated first, nothing changes if that throws.
+        KITSUNE_NOINLINE void AppendToNewChunk(const T* str, Usize size)
+        {
+            if (size == 0)
+                return;
+
+            Usize taken = (m_Tail != nullptr) ? (m_Tail->Capacity - m_Tail->Size) : 0;
+            Chunk* chunk = CreateChunk(size - taken);
+
+            if (taken != 0)
+            {
+                std::memcpy(m_Tail->Data() + m_Tail->Size, str, taken * sizeof(T));
+                m_Tail->Size += taken;
+            }
+
+            std::memcpy(chunk->Data(), str + taken, (size - taken) * sizeof(T));
+            chunk->Size = size - taken;
+
+            LinkChunk(chunk);
+            m_Size += size;
+        }
+
+        inline void AddChunk(Usize minCapacity)
+        {
+            LinkChunk(CreateChunk(minCapacity));
+        }
+
+        KITSUNE_NOINLINE Chunk* CreateChunk(Usize minCapacity)
+        {
+            Usize capacity = KITSUNE_MAX(m_ChunkSize, minCapacity);
+
+            auto* chunk = static_cast<Chunk*>(m_Allocator.Allocate(sizeof(Chunk) + capacity * sizeof(T),
+                                                                   alignof(Chunk)));
+            chunk->Next = nullptr;
+            chunk->Size = 0;
+            chunk->Capacity = capacity;
+
+            return chunk;
+        }
+
+        inline void LinkChunk(Chunk* chunk)
+        {
+            if (m_Tail != nullptr)
+                m_Tail->Next = chunk;
+            else
+                m_Head = chunk;
+
+            m_Tail = chunk;
+        }
+
+        inline void FreeChunks(Chunk* chunk)
+        {
+            while (chunk != nullptr)
+                m_Allocator.Free(Exchange(chunk, chunk->Next));
+        }
+
+    private:
+        Chunk* m_Head;
+        Chunk* m_Tail;
+
+        Usize m_Size;
+        Usize m_ChunkSize;
+
+        KITSUNE_MAYBE_OVERLAPPING Alloc m_Allocator;
+    };
+
+    using StringBuilder = BasicStringBuilder<char>;
+    using WideStringBuilder = BasicStringBuilder<wchar_t>;
+
+    using U8StringBuilder = BasicStringBuilder<char8_t>;
+    using U16StringBuilder = BasicStringBuilder<char16_t>;
+    using U32StringBuilder = BasicStringBuilder<char32_t>;
+}
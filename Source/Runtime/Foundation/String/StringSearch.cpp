@@ -0,0 +1,692 @@
+#include "Foundation/String/StringSearch.h"
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include "Foundation/Common/Simd.h"
+#include "Foundation/String/CharTraits.h"
+
+namespace Kitsune::Internal
+{
+    namespace
+    {
+        // Sets with more characters than this aren't worth a comparison per character and
+        // block, unless the nibble lookup can take them.
+        constexpr Usize s_MaxComparedSet = 16;
+
+        template<typename T>
+        using UnsignedChar = std::make_unsigned_t<T>;
+
+        template<typename T>
+        bool EqualChars(const T* str1, const T* str2, Usize count)
+        {
+            return (std::memcmp(str1, str2, count * sizeof(T)) == 0);
+        }
+
+        // Short needles: jump from one occurrence of the first character to the next and
+        // compare the rest. Quadratic at worst, but never by more than s_MaxFilteredNeedle.
+        template<typename T>
+        const T* ScalarFindShort(const T* haystack, Usize size, const T* needle, Usize needleSize)
+        {
+            const T* end = haystack + (size - needleSize + 1);
+
+            while (haystack != end)
+            {
+                haystack = CharTraits<T>::Find(haystack, static_cast<Usize>(end - haystack), needle[0]);
+                if (haystack == nullptr)
+                    return nullptr;
+
+                if (EqualChars(haystack + 1, needle + 1, needleSize - 1))
+                    return haystack;
+
+                ++haystack;
+            }
+
+            return nullptr;
+        }
+
+        // Splits the needle into u and v such that searching for v from the left, then for u
+        // from the right never needs to backtrack (Crochemore & Perrin). Returns the length of
+        // u, `period` gets the period of the needle if it has one that fits.
+        template<typename T>
+        Usize CriticalFactorization(const T* needle, Usize needleSize, Usize& period)
+        {
+            constexpr Usize none = ~Usize(0);
+
+            // Maximal suffix for both orderings, the longer one wins. `none + k` wraps around
+            // to the start of the needle on purpose.
+            Usize maxSuffix = none;
+            Usize j = 0, k = 1, p = 1;
+
+            while (j + k < needleSize)
+            {
+                UnsignedChar<T> a = static_cast<UnsignedChar<T>>(needle[j + k]);
+                UnsignedChar<T> b = static_cast<UnsignedChar<T>>(needle[maxSuffix + k]);
+
+                if (a < b)
+                {
+                    j += k;
+                    k = 1;
+                    p = j - maxSuffix;
+                }
+                else if (a == b)
+                {
+                    if (k != p)
+                        ++k;
+                    else
+                    {
+                        j += p;
+                        k = 1;
+                    }
+                }
+                else
+                {
+                    maxSuffix = j++;
+                    k = p = 1;
+                }
+            }
+
+            period = p;
+
+            Usize maxSuffixReverse = none;
+            j = 0, k = 1, p = 1;
+
+            while (j + k < needleSize)
+            {
+                UnsignedChar<T> a = static_cast<UnsignedChar<T>>(needle[j + k]);
+                UnsignedChar<T> b = static_cast<UnsignedChar<T>>(needle[maxSuffixReverse + k]);
+
+                if (b < a)
+                {
+                    j += k;
+                    k = 1;
+                    p = j - maxSuffixReverse;
+                }
+                else if (a == b)
+                {
+                    if (k != p)
+                        ++k;
+                    else
+                    {
+                        j += p;
+                        k = 1;
+                    }
+                }
+                else
+                {
+                    maxSuffixReverse = j++;
+                    k = p = 1;
+                }
+            }
+
+            if (maxSuffixReverse + 1 < maxSuffix + 1)
+                return maxSuffix + 1;
+
+            period = p;
+            return maxSuffixReverse + 1;
+        }
+
+        // Two-Way, with a Horspool table on the last character of the window to skip ahead
+        // before comparing anything. Wide characters share slots by their low byte, which
+        // only makes the skips shorter, but also means a zero skip doesn't guarantee the last
+        // character matches, so it gets compared along with the rest of the right half.
+        template<typename T>
+        const T* TwoWayFind(const T* haystack, Usize size, const T* needle, Usize needleSize)
+        {
+            Usize period;
+            Usize suffix = CriticalFactorization(needle, needleSize, period);
+
+            Usize skips[256];
+            for (Usize& skip : skips)
+                skip = needleSize;
+
+            for (Usize i = 0; i < needleSize; ++i)
+                skips[static_cast<Uint8>(needle[i])] = needleSize - i - 1;
+
+            Usize end = size - needleSize;
+
+            if (EqualChars(needle, needle + period, suffix))
+            {
+                // Periodic needle: a mismatch in the left half still lets us skip a whole
+                // period, and whatever matched of it doesn't need to be compared again.
+                Usize memory = 0;
+
+                for (Usize j = 0; j <= end; )
+                {
+                    Usize shift = skips[static_cast<Uint8>(haystack[j + needleSize - 1])];
+                    if (shift > 0)
+                    {
+                        if (memory != 0 && shift < period)
+                            shift = needleSize - period;
+
+                        memory = 0;
+                        j += shift;
+                        continue;
+                    }
+
+                    Usize i = KITSUNE_MAX(suffix, memory);
+                    while (i < needleSize && needle[i] == haystack[i + j])
+                        ++i;
+
+                    if (i < needleSize)
+                    {
+                        j += i - suffix + 1;
+                        memory = 0;
+                        continue;
+                    }
+
+                    i = suffix - 1;
+                    while (memory < i + 1 && needle[i] == haystack[i + j])
+                        --i;
+
+                    if (i + 1 < memory + 1)
+                        return haystack + j;
+
+                    j += period;
+                    memory = needleSize - period;
+                }
+            }
+            else
+            {
+                // The halves are different enough that any mismatch shifts past one of them.
+                period = KITSUNE_MAX(suffix, needleSize - suffix) + 1;
+
+                for (Usize j = 0; j <= end; )
+                {
+                    Usize shift = skips[static_cast<Uint8>(haystack[j + needleSize - 1])];
+                    if (shift > 0)
+                    {
+                        j += shift;
+                        continue;
+                    }
+
+                    Usize i = suffix;
+                    while (i < needleSize && needle[i] == haystack[i + j])
+                        ++i;
+
+                    if (i < needleSize)
+                    {
+                        j += i - suffix + 1;
+                        continue;
+                    }
+
+                    // Wraps around once the whole left half matched.
+                    i = suffix - 1;
+                    while (i != ~Usize(0) && needle[i] == haystack[i + j])
+                        --i;
+
+                    if (i == ~Usize(0))
+                        return haystack + j;
+
+                    j += period;
+                }
+            }
+
+            return nullptr;
+        }
+
+        // 256 bits for the characters below 256, anything above gets looked up in the set.
+        template<typename T>
+        class CharSet
+        {
+        public:
+            CharSet(const T* set, Usize setSize)
+                : m_Set(set), m_SetSize(setSize), m_Bits(), m_HasWide(false)
+            {
+                for (Usize i = 0; i < setSize; ++i)
+                {
+                    auto ch = static_cast<UnsignedChar<T>>(set[i]);
+
+                    if (ch < 256)
+                        m_Bits[ch / 64] |= Uint64(1) << (ch % 64);
+                    else
+                        m_HasWide = true;
+                }
+            }
+
+        public:
+            [[nodiscard]] bool Contains(T ch) const
+            {
+                auto value = static_cast<UnsignedChar<T>>(ch);
+
+                if (value < 256)
+                    return (m_Bits[value / 64] >> (value % 64)) & 1;
+
+                return m_HasWide && (CharTraits<T>::Find(m_Set, m_SetSize, ch) != nullptr);
+            }
+
+        private:
+            const T* m_Set;
+            Usize m_SetSize;
+
+            Uint64 m_Bits[4];
+            bool m_HasWide;
+        };
+
+        template<typename T>
+        const T* ScalarFindAny(const T* str, Usize size, const T* set, Usize setSize)
+        {
+            CharSet<T> chars(set, setSize);
+
+            for (Usize i = 0; i < size; ++i)
+            {
+                if (chars.Contains(str[i]))
+                    return str + i;
+            }
+
+            return nullptr;
+        }
+
+        // Nibble lookup for byte sized characters: the low nibble picks a row of 8 bits out of
+        // a 16 byte table, the high one which of those bits to test. High nibbles of 8 and up
+        // get a table of their own, picked by the top bit of the byte.
+        struct NibbleTables
+        {
+            alignas(16) Uint8 Low[16];      // Rows for high nibbles 0 to 7.
+            alignas(16) Uint8 High[16];     // Rows for high nibbles 8 to 15.
+        };
+
+        template<typename T>
+        NibbleTables MakeNibbleTables(const T* set, Usize setSize)
+        {
+            NibbleTables tables = {};
+
+            for (Usize i = 0; i < setSize; ++i)
+            {
+                Uint8 ch = static_cast<Uint8>(set[i]);
+                Uint8 bit = static_cast<Uint8>(1u << ((ch >> 4) & 7));
+
+                if (ch < 0x80)
+                    tables.Low[ch & 0x0F] |= bit;
+                else
+                    tables.High[ch & 0x0F] |= bit;
+            }
+
+            return tables;
+        }
+
+        alignas(16) constexpr Uint8 s_NibbleBits[16] =
+        {
+            1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128
+        };
+
+        // The vector kernels share their structure with the CharTraits ones: blocks of
+        // unaligned loads, with the last block overlapping the previous one instead of a
+        // scalar tail. Inputs shorter than a block go to the next smaller kernel.
+
+#if defined(KITSUNE_SIMD_X86)
+        // Candidates are the positions where both the first and the last character of the
+        // needle line up, only those get compared in full.
+        template<typename T>
+        KITSUNE_TARGET("sse2") const T* Sse2FindShort(const T* haystack, Usize size,
+                                                      const T* needle, Usize needleSize)
+        {
+            constexpr Usize lanes = sizeof(__m128i) / sizeof(T);
+
+            Usize candidates = size - needleSize + 1;
+            if (candidates < lanes)
+                return ScalarFindShort(haystack, size, needle, needleSize);
+
+            const __m128i first = Sse2Broadcast(needle[0]);
+            const __m128i last = Sse2Broadcast(needle[needleSize - 1]);
+
+            Usize lastBlock = candidates - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, lastBlock))
+            {
+                const T* block = haystack + i;
+
+                __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+                __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + needleSize - 1));
+
+                Uint32 mask = Sse2EqualMask<T>(blockFirst, first) & Sse2EqualMask<T>(blockLast, last);
+
+                for (mask &= s_X86LaneBits<T>; mask != 0; mask &= mask - 1)
+                {
+                    const T* candidate = block + static_cast<Usize>(std::countr_zero(mask)) / sizeof(T);
+                    if (EqualChars(candidate + 1, needle + 1, needleSize - 2))
+                        return candidate;
+                }
+
+                if (i == lastBlock)
+                    return nullptr;
+            }
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("sse2") const T* Sse2FindAny(const T* str, Usize size, const T* set, Usize setSize)
+        {
+            constexpr Usize lanes = sizeof(__m128i) / sizeof(T);
+            if (size < lanes || setSize > s_MaxComparedSet)
+                return ScalarFindAny(str, size, set, setSize);
+
+            __m128i chars[s_MaxComparedSet];
+            for (Usize i = 0; i < setSize; ++i)
+                chars[i] = Sse2Broadcast(set[i]);
+
+            Usize last = size - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+
+                Uint32 mask = 0;
+                for (Usize j = 0; j < setSize; ++j)
+                    mask |= Sse2EqualMask<T>(block, chars[j]);
+
+                if (mask != 0)
+                    return str + i + static_cast<Usize>(std::countr_zero(mask)) / sizeof(T);
+
+                if (i == last)
+                    return nullptr;
+            }
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("avx2") const T* Avx2FindShort(const T* haystack, Usize size,
+                                                      const T* needle, Usize needleSize)
+        {
+            constexpr Usize lanes = sizeof(__m256i) / sizeof(T);
+
+            Usize candidates = size - needleSize + 1;
+            if (candidates < lanes)
+                return Sse2FindShort(haystack, size, needle, needleSize);
+
+            const __m256i first = Avx2Broadcast(needle[0]);
+            const __m256i last = Avx2Broadcast(needle[needleSize - 1]);
+
+            Usize lastBlock = candidates - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, lastBlock))
+            {
+                const T* block = haystack + i;
+
+                __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+                __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + needleSize - 1));
+
+                Uint32 mask = Avx2EqualMask<T>(blockFirst, first) & Avx2EqualMask<T>(blockLast, last);
+
+                for (mask &= s_X86LaneBits<T>; mask != 0; mask &= mask - 1)
+                {
+                    const T* candidate = block + static_cast<Usize>(std::countr_zero(mask)) / sizeof(T);
+                    if (EqualChars(candidate + 1, needle + 1, needleSize - 2))
+                        return candidate;
+                }
+
+                if (i == lastBlock)
+                    return nullptr;
+            }
+        }
+
+        KITSUNE_TARGET("avx2") Uint32 Avx2NibbleMask(__m256i block, __m256i low, __m256i high, __m256i bits)
+        {
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+            __m256i lowNibbles = _mm256_and_si256(block, nibble);
+            __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble);
+
+            // blendv picks by the top bit of each byte, the one that tells the tables apart.
+            __m256i rows = _mm256_blendv_epi8(_mm256_shuffle_epi8(low, lowNibbles),
+                                              _mm256_shuffle_epi8(high, lowNibbles), block);
+            __m256i bit = _mm256_shuffle_epi8(bits, highNibbles);
+
+            return static_cast<Uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(rows, bit), bit)));
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("avx2") const T* Avx2FindAny(const T* str, Usize size, const T* set, Usize setSize)
+        {
+            constexpr Usize lanes = sizeof(__m256i) / sizeof(T);
+            if (size < lanes)
+                return Sse2FindAny(str, size, set, setSize);
+
+            Usize last = size - lanes;
+
+            if constexpr (sizeof(T) == 1)
+            {
+                NibbleTables tables = MakeNibbleTables(set, setSize);
+
+                // vpshufb looks up each 128-bit half separately, both get the same table.
+                const __m256i low = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.Low)));
+                const __m256i high = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.High)));
+                const __m256i bits = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(s_NibbleBits)));
+
+                for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+                {
+                    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+
+                    Uint32 mask = Avx2NibbleMask(block, low, high, bits);
+                    if (mask != 0)
+                        return str + i + static_cast<Usize>(std::countr_zero(mask));
+
+                    if (i == last)
+                        return nullptr;
+                }
+            }
+            else
+            {
+                if (setSize > s_MaxComparedSet)
+                    return ScalarFindAny(str, size, set, setSize);
+
+                __m256i chars[s_MaxComparedSet];
+                for (Usize i = 0; i < setSize; ++i)
+                    chars[i] = Avx2Broadcast(set[i]);
+
+                for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+                {
+                    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+
+                    Uint32 mask = 0;
+                    for (Usize j = 0; j < setSize; ++j)
+                        mask |= Avx2EqualMask<T>(block, chars[j]);
+
+                    if (mask != 0)
+                        return str + i + static_cast<Usize>(std::countr_zero(mask)) / sizeof(T);
+
+                    if (i == last)
+                        return nullptr;
+                }
+            }
+        }
+#endif
+
+#if defined(KITSUNE_SIMD_NEON)
+        template<typename T>
+        const T* NeonFindShort(const T* haystack, Usize size, const T* needle, Usize needleSize)
+        {
+            constexpr Usize lanes = 16 / sizeof(T);
+
+            Usize candidates = size - needleSize + 1;
+            if (candidates < lanes)
+                return ScalarFindShort(haystack, size, needle, needleSize);
+
+            const uint8x16_t first = NeonBroadcast(needle[0]);
+            const uint8x16_t last = NeonBroadcast(needle[needleSize - 1]);
+
+            Usize lastBlock = candidates - lanes;
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, lastBlock))
+            {
+                const T* block = haystack + i;
+
+                Uint64 mask = NeonEqualMask<T>(NeonLoad(block), first) &
+                              NeonEqualMask<T>(NeonLoad(block + needleSize - 1), last);
+
+                for (mask &= s_NeonLaneBits<T>; mask != 0; mask &= mask - 1)
+                {
+                    const T* candidate = block + static_cast<Usize>(std::countr_zero(mask) / 4) / sizeof(T);
+                    if (EqualChars(candidate + 1, needle + 1, needleSize - 2))
+                        return candidate;
+                }
+
+                if (i == lastBlock)
+                    return nullptr;
+            }
+        }
+
+    #if defined(KITSUNE_ARCH_AARCH64)
+        inline Uint64 NeonNibbleMask(uint8x16_t block, uint8x16_t low, uint8x16_t high, uint8x16_t bits)
+        {
+            uint8x16_t lowNibbles = vandq_u8(block, vdupq_n_u8(0x0F));
+            uint8x16_t highNibbles = vshrq_n_u8(block, 4);
+
+            uint8x16_t isHigh = vcgeq_u8(block, vdupq_n_u8(0x80));
+            uint8x16_t rows = vbslq_u8(isHigh, vqtbl1q_u8(high, lowNibbles), vqtbl1q_u8(low, lowNibbles));
+
+            return NeonMask(vtstq_u8(rows, vqtbl1q_u8(bits, highNibbles)));
+        }
+    #endif
+
+        template<typename T>
+        const T* NeonFindAny(const T* str, Usize size, const T* set, Usize setSize)
+        {
+            constexpr Usize lanes = 16 / sizeof(T);
+            if (size < lanes)
+                return ScalarFindAny(str, size, set, setSize);
+
+            Usize last = size - lanes;
+
+    #if defined(KITSUNE_ARCH_AARCH64)
+            // Table lookups (vqtbl1q) are AArch64 only.
+            if constexpr (sizeof(T) == 1)
+            {
+                NibbleTables tables = MakeNibbleTables(set, setSize);
+
+                const uint8x16_t low = vld1q_u8(tables.Low);
+                const uint8x16_t high = vld1q_u8(tables.High);
+                const uint8x16_t bits = vld1q_u8(s_NibbleBits);
+
+                for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+                {
+                    Uint64 mask = NeonNibbleMask(NeonLoad(str + i), low, high, bits);
+                    if (mask != 0)
+                        return str + i + static_cast<Usize>(std::countr_zero(mask) / 4);
+
+                    if (i == last)
+                        return nullptr;
+                }
+            }
+    #endif
+
+            if (setSize > s_MaxComparedSet)
+                return ScalarFindAny(str, size, set, setSize);
+
+            uint8x16_t chars[s_MaxComparedSet];
+            for (Usize i = 0; i < setSize; ++i)
+                chars[i] = NeonBroadcast(set[i]);
+
+            for (Usize i = 0;; i = KITSUNE_MIN(i + lanes, last))
+            {
+                uint8x16_t block = NeonLoad(str + i);
+
+                Uint64 mask = 0;
+                for (Usize j = 0; j < setSize; ++j)
+                    mask |= NeonEqualMask<T>(block, chars[j]);
+
+                if (mask != 0)
+                    return str + i + static_cast<Usize>(std::countr_zero(mask) / 4) / sizeof(T);
+
+                if (i == last)
+                    return nullptr;
+            }
+        }
+#endif
+
+        template<typename T>
+        const T* FindSubstringImpl(const T* haystack, Usize size, const T* needle, Usize needleSize)
+        {
+            if (needleSize == 0)
+                return haystack;
+
+            if (needleSize > size)
+                return nullptr;
+
+            if (needleSize == 1)
+                return CharTraits<T>::Find(haystack, size, needle[0]);
+
+            if (needleSize > s_MaxFilteredNeedle)
+                return TwoWayFind(haystack, size, needle, needleSize);
+
+            switch (GetCharKernelSet())
+            {
+#if defined(KITSUNE_SIMD_X86)
+            case CharKernelSet::AVX2: return Avx2FindShort(haystack, size, needle, needleSize);
+            case CharKernelSet::SSE2: return Sse2FindShort(haystack, size, needle, needleSize);
+#endif
+#if defined(KITSUNE_SIMD_NEON)
+            case CharKernelSet::NEON: return NeonFindShort(haystack, size, needle, needleSize);
+#endif
+            default:                  return ScalarFindShort(haystack, size, needle, needleSize);
+            }
+        }
+
+        template<typename T>
+        const T* FindAnyImpl(const T* str, Usize size, const T* set, Usize setSize)
+        {
+            if (setSize == 0)
+                return nullptr;
+
+            if (setSize == 1)
+                return CharTraits<T>::Find(str, size, set[0]);
+
+            switch (GetCharKernelSet())
+            {
+#if defined(KITSUNE_SIMD_X86)
+            case CharKernelSet::AVX2: return Avx2FindAny(str, size, set, setSize);
+            case CharKernelSet::SSE2: return Sse2FindAny(str, size, set, setSize);
+#endif
+#if defined(KITSUNE_SIMD_NEON)
+            case CharKernelSet::NEON: return NeonFindAny(str, size, set, setSize);
+#endif
+            default:                  return ScalarFindAny(str, size, set, setSize);
+            }
+        }
+    }
+
+    const char* FindSubstring(const char* haystack, Usize size, const char* needle, Usize needleSize)
+    {
+        return FindSubstringImpl(haystack, size, needle, needleSize);
+    }
+
+    const wchar_t* FindSubstring(const wchar_t* haystack, Usize size, const wchar_t* needle, Usize needleSize)
+    {
+        return FindSubstringImpl(haystack, size, needle, needleSize);
+    }
+
+    const char8_t* FindSubstring(const char8_t* haystack, Usize size, const char8_t* needle, Usize needleSize)
+    {
+        return FindSubstringImpl(haystack, size, needle, needleSize);
+    }
+
+    const char16_t* FindSubstring(const char16_t* haystack, Usize size, const char16_t* needle, Usize needleSize)
+    {
+        return FindSubstringImpl(haystack, size, needle, needleSize);
+    }
+
+    const char32_t* FindSubstring(const char32_t* haystack, Usize size, const char32_t* needle, Usize needleSize)
+    {
+        return FindSubstringImpl(haystack, size, needle, needleSize);
+    }
+
+    const char* FindAny(const char* str, Usize size, const char* set, Usize setSize)
+    {
+        return FindAnyImpl(str, size, set, setSize);
+    }
+
+    const wchar_t* FindAny(const wchar_t* str, Usize size, const wchar_t* set, Usize setSize)
+    {
+        return FindAnyImpl(str, size, set, setSize);
+    }
+
+    const char8_t* FindAny(const char8_t* str, Usize size, const char8_t* set, Usize setSize)
+    {
+        return FindAnyImpl(str, size, set, setSize);
+    }
+
+    const char16_t* FindAny(const char16_t* str, Usize size, const char16_t* set, Usize setSize)
+    {
+        return FindAnyImpl(str, size, set, setSize);
+    }
+
+    const char32_t* FindAny(const char32_t* str, Usize size, const char32_t* set, Usize setSize)
+    {
+        return FindAnyImpl(str, size, set, setSize);
+    }
+}
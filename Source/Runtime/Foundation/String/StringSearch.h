@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        inline constexpr Usize s_MaxFilteredNeedle = 32;
+
+        // First occurrence of `needle` in `haystack`, nullptr if there's none. An empty needle
+        // matches right away.
+        //
+        // Needles of up to s_MaxFilteredNeedle characters go through a SIMD filter on their
+        // first and last character, only verifying the candidates it lets through. Longer
+        // ones use Two-Way with a Horspool skip table, which stays linear in the worst case.
+        [[nodiscard]] KITSUNE_API_ const char* FindSubstring(const char* haystack, Usize size,
+                                                             const char* needle, Usize needleSize);
+        [[nodiscard]] KITSUNE_API_ const wchar_t* FindSubstring(const wchar_t* haystack, Usize size,
+                                                                const wchar_t* needle, Usize needleSize);
+        [[nodiscard]] KITSUNE_API_ const char8_t* FindSubstring(const char8_t* haystack, Usize size,
+                                                                const char8_t* needle, Usize needleSize);
+        [[nodiscard]] KITSUNE_API_ const char16_t* FindSubstring(const char16_t* haystack, Usize size,
+                                                                 const char16_t* needle, Usize needleSize);
+        [[nodiscard]] KITSUNE_API_ const char32_t* FindSubstring(const char32_t* haystack, Usize size,
+                                                                 const char32_t* needle, Usize needleSize);
+
+        // First character of `str` that is also in `set`, nullptr if there's none. Byte sized
+        // characters are matched against the whole set at once with a nibble lookup table,
+        // wider ones only get vectorised for small sets.
+        [[nodiscard]] KITSUNE_API_ const char* FindAny(const char* str, Usize size,
+                                                       const char* set, Usize setSize);
+        [[nodiscard]] KITSUNE_API_ const wchar_t* FindAny(const wchar_t* str, Usize size,
+                                                          const wchar_t* set, Usize setSize);
+        [[nodiscard]] KITSUNE_API_ const char8_t* FindAny(const char8_t* str, Usize size,
+                                                          const char8_t* set, Usize setSize);
+        [[nodiscard]] KITSUNE_API_ const char16_t* FindAny(const char16_t* str, Usize size,
+                                                           const char16_t* set, Usize setSize);
+        [[nodiscard]] KITSUNE_API_ const char32_t* FindAny(const char32_t* str, Usize size,
+                                                           const char32_t* set, Usize setSize);
+    }
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Concepts/Character.h"
+
+#include "Foundation/String/CharTraits.h"
+#include "Foundation/String/StringSearch.h"
+
+namespace Kitsune
+{
+    template<Character T>
+    class BasicStringView;
+
+    namespace Internal
+    {
+        // Delimiters for BasicSplitView. Find() returns where the next one starts in
+        // [begin, end), or nullptr if there's none left.
+        template<Character T>
+        struct CharDelimiter
+        {
+            T Char;
+
+            static constexpr bool s_IsLines = false;
+
+            inline const T* Find(const T* begin, const T* end) const
+            {
+                return CharTraits<T>::Find(begin, static_cast<Usize>(end - begin), Char);
+            }
+
+            inline Usize Size() const { return 1; }
+        };
+
+        template<Character T>
+        struct StringDelimiter
+        {
+            const T* Pointer;
+            Usize Length;
+
+            static constexpr bool s_IsLines = false;
+
+            // An empty delimiter would be found everywhere without ever moving ahead, it
+            // doesn't split anything instead.
+            inline const T* Find(const T* begin, const T* end) const
+            {
+                if (Length == 0)
+                    return nullptr;
+
+                return FindSubstring(begin, static_cast<Usize>(end - begin), Pointer, Length);
+            }
+
+            inline Usize Size() const { return Length; }
+        };
+
+        template<Character T>
+        struct AnyOfDelimiter
+        {
+            const T* Chars;
+            Usize CharCount;
+
+            static constexpr bool s_IsLines = false;
+
+            inline const T* Find(const T* begin, const T* end) const
+            {
+                return FindAny(begin, static_cast<Usize>(end - begin), Chars, CharCount);
+            }
+
+            inline Usize Size() const { return 1; }
+        };
+
+        // Splits at '\n' and drops the '\r' of "\r\n" line endings. Text that ends with a line
+        // break doesn't have an empty line after it.
+        template<Character T>
+        struct LineDelimiter
+        {
+            static constexpr bool s_IsLines = true;
+
+            inline const T* Find(const T* begin, const T* end) const
+            {
+                return CharTraits<T>::Find(begin, static_cast<Usize>(end - begin), T('\n'));
+            }
+
+            inline Usize Size() const { return 1; }
+        };
+    }
+
+    // Lazily splits a string into the pieces between delimiters, as views into the original
+    // string. Nothing gets allocated and each delimiter is only searched for once the
+    // iterator gets to it. Delimiters next to each other (or at either end) give empty
+    // pieces, the same as in most other languages' split().
+    template<Character T, typename Delimiter>
+    class BasicSplitView
+    {
+    public:
+        using ViewType = BasicStringView<T>;
+
+    public:
+        class Iterator
+        {
+        public:
+            using ValueType = ViewType;
+            using DifferenceType = Ptrdiff;
+
+        public:
+            Iterator() = default;
+
+            inline Iterator(const T* begin, const T* end, const Delimiter& delimiter)
+                : m_Begin(begin), m_End(end), m_Finished(Delimiter::s_IsLines && begin == end),
+                  m_Delimiter(delimiter)
+            {
+                FindPieceEnd();
+            }
+
+        public:
+            inline ViewType operator*() const
+            {
+                const T* pieceEnd = m_PieceEnd;
+
+                if constexpr (Delimiter::s_IsLines)
+                {
+                    if (pieceEnd != m_End && pieceEnd != m_Begin && pieceEnd[-1] == T('\r'))
+                        --pieceEnd;
+                }
+
+                return ViewType(m_Begin, static_cast<Usize>(pieceEnd - m_Begin));
+            }
+
+            inline Iterator& operator++()
+            {
+                if (m_PieceEnd == m_End)
+                {
+                    m_Finished = true;
+                    return *this;
+                }
+
+                m_Begin = m_PieceEnd + m_Delimiter.Size();
+
+                if constexpr (Delimiter::s_IsLines)
+                    m_Finished = (m_Begin == m_End);
+
+                FindPieceEnd();
+                return *this;
+            }
+
+            inline Iterator operator++(int)
+            {
+                Iterator copy = *this;
+                ++*this;
+
+                return copy;
+            }
+
+            // Every finished iterator is the end iterator.
+            friend bool operator==(const Iterator& it1, const Iterator& it2)
+            {
+                if (it1.m_Finished || it2.m_Finished)
+                    return (it1.m_Finished == it2.m_Finished);
+
+                return (it1.m_Begin == it2.m_Begin);
+            }
+
+        private:
+            inline void FindPieceEnd()
+            {
+                if (m_Finished)
+                    return;
+
+                // Empty strings can be null, don't hand those to the search functions.
+                const T* found = (m_Begin != m_End) ? m_Delimiter.Find(m_Begin, m_End) : nullptr;
+                m_PieceEnd = (found != nullptr) ? found : m_End;
+            }
+
+        private:
+            const T* m_Begin = nullptr;
+            const T* m_PieceEnd = nullptr;
+            const T* m_End = nullptr;
+
+            bool m_Finished = true;
+            Delimiter m_Delimiter{};
+        };
+
+    public:
+        inline BasicSplitView(const T* str, Usize size, const Delimiter& delimiter)
+            : m_Begin(str), m_End(str + size), m_Delimiter(delimiter)
+        {
+        }
+
+    public:
+        [[nodiscard]] inline Iterator GetBegin() const { return Iterator(m_Begin, m_End, m_Delimiter); }
+        [[nodiscard]] inline Iterator GetEnd() const   { return Iterator(); }
+
+        inline Iterator begin() const { return GetBegin(); }
+        inline Iterator end() const   { return GetEnd(); }
+
+    private:
+        const T* m_Begin;
+        const T* m_End;
+
+        Delimiter m_Delimiter;
+    };
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Foundation/String/CharTraits.h"
+#include "Foundation/String/StringSearch.h"
+#include "Foundation/String/StringSplit.h"
 #include "Foundation/Concepts/Character.h"
 
 #include "Foundation/Iterators/ReverseIterator.h"
@@ -23,6 +25,10 @@ namespace Kitsune
         using ReverseIterator = Kitsune::ReverseIterator<Iterator>;
         using ReverseConstIterator = Kitsune::ReverseIterator<ConstIterator>;
 
+    public:
+        // Returned by the Find functions when there's nothing to be found.
+        static constexpr Index s_NoPosition = ~Index(0);
+
     public:
         BasicStringView() = default;
         BasicStringView(std::nullptr_t) = delete;
@@ -108,6 +114,100 @@ namespace Kitsune
             return BasicStringView(m_Pointer + startPos, KITSUNE_MIN(count, Size() - startPos));
         }
 
+    public:
+        // Index of the first occurrence of `str` at or after `startPos`, see
+        // Internal::FindSubstring() for how it's searched.
+        [[nodiscard]] Index Find(const BasicStringView& str, Index startPos = 0) const
+        {
+            if (startPos > Size() || str.Size() > Size() - startPos)
+                return s_NoPosition;
+
+            if (str.IsEmpty())
+                return startPos;
+
+            const T* found = Internal::FindSubstring(m_Pointer + startPos, Size() - startPos,
+                                                     str.Data(), str.Size());
+
+            return (found != nullptr) ? static_cast<Index>(found - m_Pointer) : s_NoPosition;
+        }
+
+        [[nodiscard]] Index Find(T ch, Index startPos = 0) const
+        {
+            if (startPos >= Size())
+                return s_NoPosition;
+
+            const T* found = ThisCharTraits::Find(m_Pointer + startPos, Size() - startPos, ch);
+            return (found != nullptr) ? static_cast<Index>(found - m_Pointer) : s_NoPosition;
+        }
+
+        // Index of the first character at or after `startPos` that is one of `chars`.
+        [[nodiscard]] Index FindAny(const BasicStringView& chars, Index startPos = 0) const
+        {
+            if (startPos >= Size())
+                return s_NoPosition;
+
+            const T* found = Internal::FindAny(m_Pointer + startPos, Size() - startPos,
+                                               chars.Data(), chars.Size());
+
+            return (found != nullptr) ? static_cast<Index>(found - m_Pointer) : s_NoPosition;
+        }
+
+        [[nodiscard]] bool Contains(const BasicStringView& str) const { return (Find(str) != s_NoPosition); }
+        [[nodiscard]] bool Contains(T ch) const                       { return (Find(ch) != s_NoPosition); }
+
+    public:
+        // Views of the pieces between the delimiters, see BasicSplitView. The views (and the
+        // delimiter strings passed in) have to outlive whatever iterates over them.
+        [[nodiscard]] BasicSplitView<T, Internal::CharDelimiter<T>> Split(T delimiter) const
+        {
+            return { m_Pointer, m_Size, { delimiter } };
+        }
+
+        [[nodiscard]] BasicSplitView<T, Internal::StringDelimiter<T>> Split(const BasicStringView& delimiter) const
+        {
+            return { m_Pointer, m_Size, { delimiter.Data(), delimiter.Size() } };
+        }
+
+        // Splits at every character that is one of `delimiters`.
+        [[nodiscard]] BasicSplitView<T, Internal::AnyOfDelimiter<T>> SplitAny(const BasicStringView& delimiters) const
+        {
+            return { m_Pointer, m_Size, { delimiters.Data(), delimiters.Size() } };
+        }
+
+        [[nodiscard]] BasicSplitView<T, Internal::LineDelimiter<T>> Lines() const
+        {
+            return { m_Pointer, m_Size, {} };
+        }
+
+        // Without any of `chars` at the start and/or the end.
+        [[nodiscard]] BasicStringView TrimStart(const BasicStringView& chars) const
+        {
+            Usize start = 0;
+            while (start < m_Size && IsAnyOf(m_Pointer[start], chars))
+                ++start;
+
+            return BasicStringView(m_Pointer + start, m_Size - start);
+        }
+
+        [[nodiscard]] BasicStringView TrimEnd(const BasicStringView& chars) const
+        {
+            Usize size = m_Size;
+            while (size > 0 && IsAnyOf(m_Pointer[size - 1], chars))
+                --size;
+
+            return BasicStringView(m_Pointer, size);
+        }
+
+        [[nodiscard]] BasicStringView Trim(const BasicStringView& chars) const
+        {
+            return TrimStart(chars).TrimEnd(chars);
+        }
+
+        // Without the ASCII whitespace at the start and/or the end.
+        [[nodiscard]] BasicStringView TrimStart() const { return TrimStart(GetWhitespace()); }
+        [[nodiscard]] BasicStringView TrimEnd() const   { return TrimEnd(GetWhitespace()); }
+        [[nodiscard]] BasicStringView Trim() const      { return Trim(GetWhitespace()); }
+
     public:
         [[nodiscard]] Iterator GetBegin()            { return m_Pointer; }
         [[nodiscard]] ConstIterator GetBegin() const { return m_Pointer; }
@@ -130,6 +230,26 @@ namespace Kitsune
         Iterator end() { return GetEnd(); }
         Iterator end() const { return GetEnd(); }
 
+    private:
+        static BasicStringView GetWhitespace()
+        {
+            return BasicStringView(s_Whitespace, sizeof(s_Whitespace) / sizeof(T));
+        }
+
+        static bool IsAnyOf(T ch, const BasicStringView& chars)
+        {
+            for (T c : chars)
+            {
+                if (c == ch)
+                    return true;
+            }
+
+            return false;
+        }
+
+    private:
+        static constexpr T s_Whitespace[] = { T(' '), T('\t'), T('\n'), T('\v'), T('\f'), T('\r') };
+
     private:
         const T* m_Pointer = nullptr;
         Usize m_Size = 0;
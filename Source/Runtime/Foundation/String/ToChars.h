@@ -0,0 +1,292 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <concepts>
+#include <type_traits>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+
+#include "Foundation/Iterators/Iterator.h"
+#include "Foundation/Algorithms/Copy.h"
+
+namespace Kitsune
+{
+    // Enough room for any T in any base, a minus sign included.
+    template<std::integral T>
+    inline constexpr Usize MaxIntegerChars = sizeof(T) * 8 + 1;
+
+    // Enough room for anything written by FloatToChars(), NaN and infinities included.
+    inline constexpr Usize MaxFloatChars = 32;
+
+    namespace Internal
+    {
+        // "00" to "99", so decimal conversion only needs one division every two digits.
+        inline constexpr char s_DigitPairs[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+        inline constexpr char s_UpperDigits[] = "0123456789ABCDEF";
+        inline constexpr char s_LowerDigits[] = "0123456789abcdef";
+
+        inline constexpr Uint64 s_PowersOf10[] =
+        {
+            1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+            100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+            10000000000000ull, 100000000000000ull, 1000000000000000ull,
+            10000000000000000ull, 100000000000000000ull, 1000000000000000000ull,
+            10000000000000000000ull
+        };
+
+        // log10(2) ~= 1233 / 4096 turns the bit width into a guess that is at most one too
+        // low, fixed up with a single comparison instead of a loop.
+        [[nodiscard]] constexpr Usize CountDecimalDigits(Uint64 value)
+        {
+            value |= 1;
+
+            Usize guess = (static_cast<Usize>(std::bit_width(value)) * 1233) >> 12;
+            return guess + static_cast<Usize>(value >= s_PowersOf10[guess]);
+        }
+
+        // Writes the digits so that the last one ends up right before `end`.
+        constexpr void WriteDecimalDigits(char* end, Uint64 value)
+        {
+            while (value >= 100)
+            {
+                Usize pair = static_cast<Usize>(value % 100) * 2;
+                value /= 100;
+
+                *--end = s_DigitPairs[pair + 1];
+                *--end = s_DigitPairs[pair];
+            }
+
+            if (value >= 10)
+            {
+                Usize pair = static_cast<Usize>(value) * 2;
+
+                *--end = s_DigitPairs[pair + 1];
+                *--end = s_DigitPairs[pair];
+            }
+            else
+            {
+                *--end = static_cast<char>('0' + value);
+            }
+        }
+
+        // Bases 2, 8 and 16 only need shifts and masks.
+        constexpr char* WritePowerOf2Digits(char* buffer, Uint64 value, Uint32 shift, bool uppercase)
+        {
+            const char* digits = uppercase ? s_UpperDigits : s_LowerDigits;
+            Uint64 mask = (Uint64(1) << shift) - 1;
+
+            Usize count = (static_cast<Usize>(std::bit_width(value | 1)) + shift - 1) / shift;
+            char* end = buffer + count;
+
+            for (char* it = end; it != buffer; value >>= shift)
+                *--it = digits[value & mask];
+
+            return end;
+        }
+    }
+
+    // Converts `value` to text in base 2, 8, 10 or 16, without any allocation or terminator.
+    // `buffer` needs room for at least MaxIntegerChars<T> characters, the returned pointer is
+    // one past the last one written.
+    //
+    // Negative numbers only get a minus sign in base 10, other bases print their two's
+    // complement representation.
+    template<std::integral T>
+    constexpr char* IntegerToChars(char* buffer, T value, Uint32 base = 10, bool uppercase = true)
+    {
+        using UnsignedType = std::make_unsigned_t<T>;
+        UnsignedType bits = static_cast<UnsignedType>(value);
+
+        switch (base)
+        {
+        case 2:  return Internal::WritePowerOf2Digits(buffer, bits, 1, uppercase);
+        case 8:  return Internal::WritePowerOf2Digits(buffer, bits, 3, uppercase);
+        case 16: return Internal::WritePowerOf2Digits(buffer, bits, 4, uppercase);
+        default: break;
+        }
+
+        if constexpr (std::is_signed_v<T>)
+        {
+            if (value < 0)
+            {
+                *buffer++ = '-';
+                bits = static_cast<UnsignedType>(UnsignedType(0) - bits);
+            }
+        }
+
+        char* end = buffer + Internal::CountDecimalDigits(bits);
+        Internal::WriteDecimalDigits(end, bits);
+
+        return end;
+    }
+
+    namespace Internal
+    {
+        // Decimal floating point number, Significand * 10^Exponent.
+        struct DecimalFloat
+        {
+            Uint64 Significand;
+            Int32 Exponent;
+        };
+
+        // Shortest decimal that parses back into the same value, its sign is ignored.
+        // Expects a finite value, zero comes back as a zero significand.
+        [[nodiscard]] KITSUNE_API_ DecimalFloat ShortestDecimal(double value);
+        [[nodiscard]] KITSUNE_API_ DecimalFloat ShortestDecimal(float value);
+
+        // A double has at most 767 significant digits, every digit past those is zero.
+        inline constexpr Usize s_MaxExactDigits = 768;
+
+        // Exact decimal digits of a finite value (sign ignored), rounded half to even after
+        // `precision` significant digits, or `precision` digits after the decimal point when
+        // `fixed` is set. Writes at most s_MaxExactDigits digits, trailing zeros might be left
+        // out. `exponent` receives the power of ten of the first digit, after rounding.
+        //
+        // Returns the number of digits, zero if the value rounds to zero.
+        KITSUNE_API_ Usize ExactDecimalDigits(double value, Int32 precision, bool fixed,
+                                              char* digits, Int32& exponent);
+
+        // Places a run of decimal digits in fixed or scientific notation. Any digit past the
+        // end of `Digits` is taken to be zero.
+        struct FloatLayout
+        {
+            const char* Digits;
+            Usize Count;
+            Int32 Exponent;         // Power of ten of the first digit.
+
+            Usize Decimals;         // Digits after the decimal point.
+            bool Scientific;
+            bool Uppercase;
+
+            char Sign;              // '\0' for none.
+
+        public:
+            [[nodiscard]] constexpr Usize GetSize() const
+            {
+                Usize size = (Sign != '\0') ? 1 : 0;
+                size += (Decimals > 0) ? Decimals + 1 : 0;
+
+                if (Scientific)
+                {
+                    Uint32 exponent = static_cast<Uint32>((Exponent < 0) ? -Exponent : Exponent);
+                    return size + 3 + ((exponent >= 100) ? 3 : 2);
+                }
+
+                return size + ((Exponent >= 0) ? static_cast<Usize>(Exponent) + 1 : 1);
+            }
+
+            [[nodiscard]] constexpr char GetDigit(Int64 index) const
+            {
+                return (index >= 0 && static_cast<Usize>(index) < Count) ? Digits[index] : '0';
+            }
+
+            template<WritableIterator<char> Iter>
+            Iter Write(Iter out, bool withSign = true) const
+            {
+                if (withSign && Sign != '\0')
+                    *out++ = Sign;
+
+                if (Scientific || Exponent < 0)
+                    *out++ = Scientific ? GetDigit(0) : '0';
+                else
+                {
+                    for (Int64 i = 0; i <= Exponent; ++i)
+                        *out++ = GetDigit(i);
+                }
+
+                if (Decimals > 0)
+                {
+                    *out++ = '.';
+
+                    // Digit i sits at the power of ten Exponent - i.
+                    Int64 index = Scientific ? 1 : Int64(Exponent) + 1;
+                    for (Usize i = 0; i < Decimals; ++i)
+                        *out++ = GetDigit(index++);
+                }
+
+                if (Scientific)
+                {
+                    *out++ = Uppercase ? 'E' : 'e';
+                    *out++ = (Exponent < 0) ? '-' : '+';
+
+                    char buffer[MaxIntegerChars<Int32>];
+                    Uint32 exponent = static_cast<Uint32>((Exponent < 0) ? -Exponent : Exponent);
+
+                    if (exponent < 10)
+                        *out++ = '0';
+
+                    char* end = IntegerToChars(buffer, exponent);
+                    for (const char* it = buffer; it != end; ++it)
+                        *out++ = *it;
+                }
+
+                return out;
+            }
+        };
+
+        // Layout of the shortest digits: fixed notation for reasonably sized numbers,
+        // scientific otherwise.
+        [[nodiscard]] constexpr FloatLayout GetShortestLayout(const char* digits, Usize count,
+                                                              Int32 exponent, char sign)
+        {
+            FloatLayout layout = { digits, count, exponent, 0, false, false, sign };
+            layout.Scientific = (exponent < -4) || (exponent > 16);
+
+            if (layout.Scientific)
+                layout.Decimals = count - 1;
+            else if (static_cast<Int64>(count) - 1 > exponent)
+                layout.Decimals = static_cast<Usize>(static_cast<Int64>(count) - 1 - exponent);
+
+            return layout;
+        }
+
+        template<std::floating_point T>
+        char* ShortestToChars(char* buffer, T value)
+        {
+            if (value != value)
+                return Algorithms::Copy("nan", "nan" + 3, buffer);
+
+            bool isNegative = std::signbit(value);
+            if (isNegative)
+                *buffer++ = '-';
+
+            if (value == std::numeric_limits<T>::infinity() || value == -std::numeric_limits<T>::infinity())
+                return Algorithms::Copy("inf", "inf" + 3, buffer);
+
+            char digits[MaxIntegerChars<Uint64>];
+
+            DecimalFloat decimal = ShortestDecimal(value);
+            Usize count = static_cast<Usize>(IntegerToChars(digits, decimal.Significand) - digits);
+
+            Int32 exponent = decimal.Exponent + static_cast<Int32>(count) - 1;
+            return GetShortestLayout(digits, count, exponent, '\0').Write(buffer);
+        }
+    }
+
+    // Shortest text that parses back into exactly `value`, in fixed notation unless the
+    // exponent is below -4 or above 16. `buffer` needs room for at least MaxFloatChars
+    // characters, the returned pointer is one past the last one written.
+    inline char* FloatToChars(char* buffer, double value)
+    {
+        return Internal::ShortestToChars(buffer, value);
+    }
+
+    inline char* FloatToChars(char* buffer, float value)
+    {
+        return Internal::ShortestToChars(buffer, value);
+    }
+}
@@ -0,0 +1,1173 @@
+#include "Foundation/String/Unicode.h"
+
+#include <bit>
+#include <cstring>
+
+#include "Foundation/Common/Simd.h"
+#include "Foundation/String/CharTraits.h"
+
+namespace Kitsune::Internal
+{
+    namespace
+    {
+        // UTF-8 goes through unsigned char, which is allowed to alias whatever the caller
+        // stored the text as.
+        using Utf8Unit = Uint8;
+
+        // How many code units the scalar code takes care of once a vector kernel gives up,
+        // before giving it another try. Stops text with few ASCII characters from paying for
+        // a failed vector block on every character.
+        constexpr Usize s_ScalarRun = 16;
+
+        // A code unit matches when (unit & Mask) == Value, or when it doesn't if Negate is
+        // set. Covers every class of code units the kernels need to tell apart.
+        template<typename T>
+        struct UnitPattern
+        {
+            T Mask;
+            T Value;
+            bool Negate;
+        };
+
+        template<typename T>
+        constexpr UnitPattern<T> s_Ascii = { static_cast<T>(~T(0x7F)), 0, false };
+
+        template<typename T>
+        constexpr UnitPattern<T> s_Below800 = { static_cast<T>(~T(0x7FF)), 0, false };
+
+        constexpr UnitPattern<Utf8Unit> s_Utf8Continuation = { 0xC0, 0x80, false };
+        constexpr UnitPattern<Utf8Unit> s_Utf8FourByteLead = { 0xF0, 0xF0, false };
+
+        constexpr UnitPattern<char16_t> s_Surrogate = { 0xF800, 0xD800, false };
+        constexpr UnitPattern<char16_t> s_NotSurrogate = { 0xF800, 0xD800, true };
+        constexpr UnitPattern<char16_t> s_LowSurrogate = { 0xFC00, 0xDC00, false };
+
+        constexpr UnitPattern<char32_t> s_Bmp = { 0xFFFF0000, 0, false };
+
+        template<typename T>
+        KITSUNE_FORCEINLINE bool Matches(T unit, UnitPattern<T> pattern)
+        {
+            return ((unit & pattern.Mask) == pattern.Value) != pattern.Negate;
+        }
+
+        template<typename T>
+        Usize ScalarFindMismatch(const T* str, Usize size, UnitPattern<T> pattern)
+        {
+            for (Usize i = 0; i < size; ++i)
+            {
+                if (!Matches(str[i], pattern))
+                    return i;
+            }
+
+            return size;
+        }
+
+        // Adds to `counts` rather than setting them, the vector kernels finish with this.
+        template<typename T, Usize N>
+        void ScalarCountMatches(const T* str, Usize size, const UnitPattern<T> (&patterns)[N],
+                                Usize (&counts)[N])
+        {
+            for (Usize i = 0; i < size; ++i)
+            {
+                for (Usize j = 0; j < N; ++j)
+                    counts[j] += Matches(str[i], patterns[j]);
+            }
+        }
+
+        // Length of the valid sequence at the start of `str`, 0 if it doesn't start with one.
+        Usize ValidUtf8SequenceLength(const Utf8Unit* str, Usize size)
+        {
+            Utf8Unit lead = str[0];
+            if (lead < 0x80)
+                return 1;
+
+            Usize length = UnicodeSequenceLength(static_cast<char8_t>(lead));
+            if (length == 1 || size < length)
+                return 0;
+
+            // Only the second byte has a range of its own, to rule out overlong encodings,
+            // surrogates and anything past U+10FFFF.
+            Utf8Unit low = 0x80, high = 0xBF;
+            switch (lead)
+            {
+            case 0xE0: low = 0xA0;  break;
+            case 0xED: high = 0x9F; break;
+            case 0xF0: low = 0x90;  break;
+            case 0xF4: high = 0x8F; break;
+            default:                break;
+            }
+
+            if (str[1] < low || str[1] > high)
+                return 0;
+
+            for (Usize i = 2; i < length; ++i)
+            {
+                if ((str[i] & 0xC0) != 0x80)
+                    return 0;
+            }
+
+            return length;
+        }
+
+        Usize ValidUtf16SequenceLength(const char16_t* str, Usize size)
+        {
+            if (!Matches(str[0], s_Surrogate))
+                return 1;
+
+            if (str[0] >= 0xDC00 || size < 2 || !Matches(str[1], s_LowSurrogate))
+                return 0;
+
+            return 2;
+        }
+
+        Usize ScalarFindInvalidUtf8(const Utf8Unit* str, Usize size)
+        {
+            for (Usize i = 0; i < size; )
+            {
+                Usize length = ValidUtf8SequenceLength(str + i, size - i);
+                if (length == 0)
+                    return i;
+
+                i += length;
+            }
+
+            return size;
+        }
+
+        Usize ScalarFindInvalidUtf32(const char32_t* str, Usize size)
+        {
+            for (Usize i = 0; i < size; ++i)
+            {
+                if (str[i] > 0x10FFFF || Matches(str[i], { 0xFFFFF800, 0xD800, false }))
+                    return i;
+            }
+
+            return size;
+        }
+
+        // Decoders and encoders for valid input, the scalar half of every conversion.
+        KITSUNE_FORCEINLINE char32_t Decode(const Utf8Unit*& it)
+        {
+            Uint32 lead = *it++;
+            if (lead < 0x80)
+                return lead;
+
+            if (lead < 0xE0)
+            {
+                Uint32 cp = ((lead & 0x1F) << 6) | (it[0] & 0x3F);
+                it += 1;
+
+                return cp;
+            }
+
+            if (lead < 0xF0)
+            {
+                Uint32 cp = ((lead & 0x0F) << 12) | ((it[0] & 0x3F) << 6) | (it[1] & 0x3F);
+                it += 2;
+
+                return cp;
+            }
+
+            Uint32 cp = ((lead & 0x07) << 18) | ((it[0] & 0x3F) << 12) | ((it[1] & 0x3F) << 6) | (it[2] & 0x3F);
+            it += 3;
+
+            return cp;
+        }
+
+        KITSUNE_FORCEINLINE char32_t Decode(const char16_t*& it)
+        {
+            Uint32 unit = *it++;
+            if (!Matches(static_cast<char16_t>(unit), s_Surrogate))
+                return unit;
+
+            Uint32 low = *it++;
+            return 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+        }
+
+        KITSUNE_FORCEINLINE char32_t Decode(const char32_t*& it)
+        {
+            return *it++;
+        }
+
+        KITSUNE_FORCEINLINE void Encode(char32_t cp, Utf8Unit*& out)
+        {
+            if (cp < 0x80)
+            {
+                *out++ = static_cast<Utf8Unit>(cp);
+            }
+            else if (cp < 0x800)
+            {
+                *out++ = static_cast<Utf8Unit>(0xC0 | (cp >> 6));
+                *out++ = static_cast<Utf8Unit>(0x80 | (cp & 0x3F));
+            }
+            else if (cp < 0x10000)
+            {
+                *out++ = static_cast<Utf8Unit>(0xE0 | (cp >> 12));
+                *out++ = static_cast<Utf8Unit>(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = static_cast<Utf8Unit>(0x80 | (cp & 0x3F));
+            }
+            else
+            {
+                *out++ = static_cast<Utf8Unit>(0xF0 | (cp >> 18));
+                *out++ = static_cast<Utf8Unit>(0x80 | ((cp >> 12) & 0x3F));
+                *out++ = static_cast<Utf8Unit>(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = static_cast<Utf8Unit>(0x80 | (cp & 0x3F));
+            }
+        }
+
+        KITSUNE_FORCEINLINE void Encode(char32_t cp, char16_t*& out)
+        {
+            if (cp < 0x10000)
+            {
+                *out++ = static_cast<char16_t>(cp);
+            }
+            else
+            {
+                *out++ = static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10));
+                *out++ = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+            }
+        }
+
+        KITSUNE_FORCEINLINE void Encode(char32_t cp, char32_t*& out)
+        {
+            *out++ = cp;
+        }
+
+        // UTF-8 validation, after Keiser & Lemire: with the previous three bytes at hand,
+        // every error shows up in the high nibble of the previous byte, its low nibble or the
+        // high nibble of the current one, so three table lookups ANDed together flag them.
+        // Only the third and fourth bytes of longer sequences need a check of their own.
+        constexpr Uint8 s_TooShort    = 1 << 0;    // Lead byte followed by a non-continuation.
+        constexpr Uint8 s_TooLong     = 1 << 1;    // ASCII followed by a continuation.
+        constexpr Uint8 s_Overlong3   = 1 << 2;    // E0 80..9F
+        constexpr Uint8 s_TooLarge    = 1 << 3;    // F4 90..BF, F5..FF
+        constexpr Uint8 s_Surrogate8  = 1 << 4;    // ED A0..BF
+        constexpr Uint8 s_Overlong2   = 1 << 5;    // C0..C1
+        constexpr Uint8 s_TooLarge1000 = 1 << 6;   // F5..FF 80..8F
+        constexpr Uint8 s_Overlong4   = 1 << 6;    // F0 80..8F
+        constexpr Uint8 s_TwoConts    = 1 << 7;    // Continuation following a continuation.
+        constexpr Uint8 s_Carry = s_TooShort | s_TooLong | s_TwoConts;
+
+        alignas(16) constexpr Uint8 s_Utf8PrevHigh[16] =
+        {
+            s_TooLong, s_TooLong, s_TooLong, s_TooLong,
+            s_TooLong, s_TooLong, s_TooLong, s_TooLong,
+            s_TwoConts, s_TwoConts, s_TwoConts, s_TwoConts,
+            s_TooShort | s_Overlong2,
+            s_TooShort,
+            s_TooShort | s_Overlong3 | s_Surrogate8,
+            s_TooShort | s_TooLarge | s_TooLarge1000 | s_Overlong4
+        };
+
+        alignas(16) constexpr Uint8 s_Utf8PrevLow[16] =
+        {
+            s_Carry | s_Overlong3 | s_Overlong2 | s_Overlong4,
+            s_Carry | s_Overlong2,
+            s_Carry,
+            s_Carry,
+            s_Carry | s_TooLarge,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000 | s_Surrogate8,
+            s_Carry | s_TooLarge | s_TooLarge1000,
+            s_Carry | s_TooLarge | s_TooLarge1000
+        };
+
+        alignas(16) constexpr Uint8 s_Utf8CurrentHigh[16] =
+        {
+            s_TooShort, s_TooShort, s_TooShort, s_TooShort,
+            s_TooShort, s_TooShort, s_TooShort, s_TooShort,
+            s_TooLong | s_Overlong2 | s_TwoConts | s_Overlong3 | s_TooLarge1000 | s_Overlong4,
+            s_TooLong | s_Overlong2 | s_TwoConts | s_Overlong3 | s_TooLarge,
+            s_TooLong | s_Overlong2 | s_TwoConts | s_Surrogate8 | s_TooLarge,
+            s_TooLong | s_Overlong2 | s_TwoConts | s_Surrogate8 | s_TooLarge,
+            s_TooShort, s_TooShort, s_TooShort, s_TooShort
+        };
+
+        // Subtracted with saturation from the last bytes of a block, anything left means a
+        // sequence that doesn't fit.
+        alignas(32) constexpr Uint8 s_Utf8IncompleteMax[32] =
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+        };
+
+        // Once a block shows an error, everything before the previous block is known to be
+        // fine. That block may start in the middle of a sequence, which the check of the
+        // block itself already validated.
+        Usize FindInvalidUtf8From(const Utf8Unit* str, Usize size, Usize block, Usize blockSize)
+        {
+            if (block < blockSize)
+                return ScalarFindInvalidUtf8(str, size);
+
+            Usize start = block - blockSize;
+            for (Usize i = 0; i < 3 && (str[start] & 0xC0) == 0x80; ++i)
+                ++start;
+
+            return start + ScalarFindInvalidUtf8(str + start, size - start);
+        }
+
+        // The vector kernels go through full blocks of unaligned loads, and leave the rest to
+        // the scalar code: unlike CharTraits' they only ever find prefixes or count, so
+        // there's little to gain from an overlapping last block.
+
+#if defined(KITSUNE_SIMD_X86)
+        template<typename T>
+        KITSUNE_TARGET("sse2") Usize Sse2FindMismatch(const T* str, Usize size, UnitPattern<T> pattern)
+        {
+            constexpr Usize lanes = sizeof(__m128i) / sizeof(T);
+
+            __m128i mask = Sse2Broadcast(pattern.Mask);
+            __m128i value = Sse2Broadcast(pattern.Value);
+            Uint32 flip = pattern.Negate ? 0 : 0xFFFF;
+
+            Usize i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+
+                Uint32 mismatches = Sse2EqualMask<T>(_mm_and_si128(block, mask), value) ^ flip;
+                if (mismatches != 0)
+                    return i + static_cast<Usize>(std::countr_zero(mismatches)) / sizeof(T);
+            }
+
+            return i + ScalarFindMismatch(str + i, size - i, pattern);
+        }
+
+        // Matching lanes are all ones, subtracting them counts a match per byte of the lane.
+        // The byte counters get summed up before they can overflow.
+        template<typename T, Usize N>
+        KITSUNE_TARGET("sse2") void Sse2CountMatches(const T* str, Usize size, const UnitPattern<T> (&patterns)[N],
+                                                     Usize (&counts)[N])
+        {
+            constexpr Usize lanes = sizeof(__m128i) / sizeof(T);
+
+            __m128i masks[N], values[N], flips[N], counters[N], sums[N];
+            for (Usize j = 0; j < N; ++j)
+            {
+                masks[j] = Sse2Broadcast(patterns[j].Mask);
+                values[j] = Sse2Broadcast(patterns[j].Value);
+                flips[j] = _mm_set1_epi8(patterns[j].Negate ? -1 : 0);
+
+                counters[j] = _mm_setzero_si128();
+                sums[j] = _mm_setzero_si128();
+            }
+
+            Usize i = 0, rounds = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+
+                for (Usize j = 0; j < N; ++j)
+                {
+                    __m128i matches = Sse2Equal<T>(_mm_and_si128(block, masks[j]), values[j]);
+                    counters[j] = _mm_sub_epi8(counters[j], _mm_xor_si128(matches, flips[j]));
+                }
+
+                if (++rounds == 255)
+                {
+                    for (Usize j = 0; j < N; ++j)
+                    {
+                        sums[j] = _mm_add_epi64(sums[j], _mm_sad_epu8(counters[j], _mm_setzero_si128()));
+                        counters[j] = _mm_setzero_si128();
+                    }
+
+                    rounds = 0;
+                }
+            }
+
+            for (Usize j = 0; j < N; ++j)
+            {
+                alignas(16) Uint64 total[2];
+                sums[j] = _mm_add_epi64(sums[j], _mm_sad_epu8(counters[j], _mm_setzero_si128()));
+                _mm_store_si128(reinterpret_cast<__m128i*>(total), sums[j]);
+
+                counts[j] += static_cast<Usize>(total[0] + total[1]) / sizeof(T);
+            }
+
+            ScalarCountMatches(str + i, size - i, patterns, counts);
+        }
+
+        // Widens or narrows every block whose code units all match `pattern`, so that each
+        // of them converts to a single code unit. Stops at the first block that doesn't.
+        template<typename From, typename To>
+        KITSUNE_TARGET("sse2") Usize Sse2ConvertMatching(const From* src, Usize size, To* dest,
+                                                         UnitPattern<From> pattern)
+        {
+            constexpr Usize lanes = sizeof(__m128i) / sizeof(From);
+
+            __m128i mask = Sse2Broadcast(pattern.Mask);
+            __m128i value = Sse2Broadcast(pattern.Value);
+            Uint32 flip = pattern.Negate ? 0 : 0xFFFF;
+
+            __m128i zero = _mm_setzero_si128();
+
+            Usize i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                if ((Sse2EqualMask<From>(_mm_and_si128(block, mask), value) ^ flip) != 0)
+                    break;
+
+                To* out = dest + i;
+
+                if constexpr (sizeof(From) == 1 && sizeof(To) == 2)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(block, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(block, zero));
+                }
+                else if constexpr (sizeof(From) == 1 && sizeof(To) == 4)
+                {
+                    __m128i low = _mm_unpacklo_epi8(block, zero);
+                    __m128i high = _mm_unpackhi_epi8(block, zero);
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(high, zero));
+                }
+                else if constexpr (sizeof(From) == 2 && sizeof(To) == 4)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(block, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(block, zero));
+                }
+                else if constexpr (sizeof(From) == 2 && sizeof(To) == 1)
+                {
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(block, block));
+                }
+                else if constexpr (sizeof(From) == 4 && sizeof(To) == 1)
+                {
+                    __m128i words = _mm_packs_epi32(block, block);
+                    Uint32 bytes = static_cast<Uint32>(_mm_cvtsi128_si32(_mm_packus_epi16(words, words)));
+
+                    std::memcpy(out, &bytes, sizeof(bytes));
+                }
+                else
+                {
+                    // No unsigned 32-bit pack before SSE4.1, sign extending the low halves
+                    // makes the signed one exact.
+                    __m128i extended = _mm_srai_epi32(_mm_slli_epi32(block, 16), 16);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packs_epi32(extended, extended));
+                }
+            }
+
+            return i;
+        }
+
+        KITSUNE_TARGET("sse2") Usize Sse2FindInvalidUtf32(const char32_t* str, Usize size)
+        {
+            // Unsigned comparisons through signed ones, by flipping the sign bits.
+            __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000));
+            __m128i maxCodePoint = _mm_set1_epi32(static_cast<int>(0x10FFFF ^ 0x80000000));
+            __m128i surrogateCount = _mm_set1_epi32(static_cast<int>(0x800 ^ 0x80000000));
+            __m128i surrogateStart = _mm_set1_epi32(0xD800);
+
+            Usize i = 0;
+            for (; i + 4 <= size; i += 4)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+
+                __m128i tooLarge = _mm_cmpgt_epi32(_mm_xor_si128(block, bias), maxCodePoint);
+                __m128i surrogate = _mm_cmplt_epi32(_mm_xor_si128(_mm_sub_epi32(block, surrogateStart), bias),
+                                                    surrogateCount);
+
+                Uint32 invalid = static_cast<Uint32>(_mm_movemask_epi8(_mm_or_si128(tooLarge, surrogate)));
+                if (invalid != 0)
+                    return i + static_cast<Usize>(std::countr_zero(invalid)) / 4;
+            }
+
+            return i + ScalarFindInvalidUtf32(str + i, size - i);
+        }
+
+        template<typename T>
+        KITSUNE_TARGET("avx2") Usize Avx2FindMismatch(const T* str, Usize size, UnitPattern<T> pattern)
+        {
+            constexpr Usize lanes = sizeof(__m256i) / sizeof(T);
+
+            __m256i mask = Avx2Broadcast(pattern.Mask);
+            __m256i value = Avx2Broadcast(pattern.Value);
+            Uint32 flip = pattern.Negate ? 0 : 0xFFFFFFFF;
+
+            Usize i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+
+                Uint32 mismatches = Avx2EqualMask<T>(_mm256_and_si256(block, mask), value) ^ flip;
+                if (mismatches != 0)
+                    return i + static_cast<Usize>(std::countr_zero(mismatches)) / sizeof(T);
+            }
+
+            // The SSE2 tails are legacy encoded, leaving the upper halves dirty would make
+            // every instruction in them pay for the transition.
+            _mm256_zeroupper();
+            return i + Sse2FindMismatch(str + i, size - i, pattern);
+        }
+
+        template<typename T, Usize N>
+        KITSUNE_TARGET("avx2") void Avx2CountMatches(const T* str, Usize size, const UnitPattern<T> (&patterns)[N],
+                                                     Usize (&counts)[N])
+        {
+            constexpr Usize lanes = sizeof(__m256i) / sizeof(T);
+
+            __m256i masks[N], values[N], flips[N], counters[N], sums[N];
+            for (Usize j = 0; j < N; ++j)
+            {
+                masks[j] = Avx2Broadcast(patterns[j].Mask);
+                values[j] = Avx2Broadcast(patterns[j].Value);
+                flips[j] = _mm256_set1_epi8(patterns[j].Negate ? -1 : 0);
+
+                counters[j] = _mm256_setzero_si256();
+                sums[j] = _mm256_setzero_si256();
+            }
+
+            Usize i = 0, rounds = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+
+                for (Usize j = 0; j < N; ++j)
+                {
+                    __m256i matches = Avx2Equal<T>(_mm256_and_si256(block, masks[j]), values[j]);
+                    counters[j] = _mm256_sub_epi8(counters[j], _mm256_xor_si256(matches, flips[j]));
+                }
+
+                if (++rounds == 255)
+                {
+                    for (Usize j = 0; j < N; ++j)
+                    {
+                        sums[j] = _mm256_add_epi64(sums[j], _mm256_sad_epu8(counters[j], _mm256_setzero_si256()));
+                        counters[j] = _mm256_setzero_si256();
+                    }
+
+                    rounds = 0;
+                }
+            }
+
+            for (Usize j = 0; j < N; ++j)
+            {
+                alignas(32) Uint64 total[4];
+                sums[j] = _mm256_add_epi64(sums[j], _mm256_sad_epu8(counters[j], _mm256_setzero_si256()));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(total), sums[j]);
+
+                counts[j] += static_cast<Usize>(total[0] + total[1] + total[2] + total[3]) / sizeof(T);
+            }
+
+            _mm256_zeroupper();
+            Sse2CountMatches(str + i, size - i, patterns, counts);
+        }
+
+        template<typename From, typename To>
+        KITSUNE_TARGET("avx2") Usize Avx2ConvertMatching(const From* src, Usize size, To* dest,
+                                                         UnitPattern<From> pattern)
+        {
+            constexpr Usize lanes = sizeof(__m256i) / sizeof(From);
+
+            __m256i mask = Avx2Broadcast(pattern.Mask);
+            __m256i value = Avx2Broadcast(pattern.Value);
+            Uint32 flip = pattern.Negate ? 0 : 0xFFFFFFFF;
+
+            Usize i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                if ((Avx2EqualMask<From>(_mm256_and_si256(block, mask), value) ^ flip) != 0)
+                    break;
+
+                __m128i low = _mm256_castsi256_si128(block);
+                __m128i high = _mm256_extracti128_si256(block, 1);
+                To* out = dest + i;
+
+                if constexpr (sizeof(From) == 1 && sizeof(To) == 2)
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_cvtepu8_epi16(low));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16), _mm256_cvtepu8_epi16(high));
+                }
+                else if constexpr (sizeof(From) == 1 && sizeof(To) == 4)
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_cvtepu8_epi32(low));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16), _mm256_cvtepu8_epi32(high));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+                }
+                else if constexpr (sizeof(From) == 2 && sizeof(To) == 4)
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_cvtepu16_epi32(low));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8), _mm256_cvtepu16_epi32(high));
+                }
+                else if constexpr (sizeof(From) == 2 && sizeof(To) == 1)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(low, high));
+                }
+                else if constexpr (sizeof(From) == 4 && sizeof(To) == 1)
+                {
+                    __m128i words = _mm_packs_epi32(low, high);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(words, words));
+                }
+                else
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi32(low, high));
+                }
+            }
+
+            return i;
+        }
+
+        KITSUNE_TARGET("avx2") Usize Avx2FindInvalidUtf32(const char32_t* str, Usize size)
+        {
+            __m256i maxCodePoint = _mm256_set1_epi32(0x10FFFF);
+            __m256i surrogateLast = _mm256_set1_epi32(0x7FF);
+            __m256i surrogateStart = _mm256_set1_epi32(0xD800);
+
+            Usize i = 0;
+            for (; i + 8 <= size; i += 8)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+
+                // x <= limit (unsigned) if min(x, limit) == x.
+                __m256i inRange = _mm256_cmpeq_epi32(_mm256_min_epu32(block, maxCodePoint), block);
+                __m256i offset = _mm256_sub_epi32(block, surrogateStart);
+                __m256i surrogate = _mm256_cmpeq_epi32(_mm256_min_epu32(offset, surrogateLast), offset);
+
+                Uint32 invalid = ~static_cast<Uint32>(_mm256_movemask_epi8(inRange))
+                               | static_cast<Uint32>(_mm256_movemask_epi8(surrogate));
+
+                if (invalid != 0)
+                    return i + static_cast<Usize>(std::countr_zero(invalid)) / 4;
+            }
+
+            _mm256_zeroupper();
+            return i + Sse2FindInvalidUtf32(str + i, size - i);
+        }
+
+        KITSUNE_TARGET("avx2") __m256i Avx2BroadcastTable(const Uint8 (&table)[16])
+        {
+            return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+        }
+
+        struct Avx2Utf8Check
+        {
+            __m256i Previous;
+            __m256i Incomplete;
+        };
+
+        // True if the block has errors, or the previous one ended in the middle of a sequence.
+        KITSUNE_TARGET("avx2") bool Avx2HasUtf8Errors(Avx2Utf8Check& check, __m256i input)
+        {
+            // An ASCII block can't finish what the previous one started, any other block is
+            // checked against the previous one's last bytes below.
+            __m256i errors = check.Incomplete;
+
+            if (_mm256_movemask_epi8(input) != 0)
+            {
+                __m256i nibble = _mm256_set1_epi8(0x0F);
+
+                // The previous block's last bytes in front of this one's, lane by lane.
+                __m256i shifted = _mm256_permute2x128_si256(check.Previous, input, 0x21);
+                __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+                __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+                __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+                __m256i prevHigh = _mm256_shuffle_epi8(Avx2BroadcastTable(s_Utf8PrevHigh),
+                                                       _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+                __m256i prevLow = _mm256_shuffle_epi8(Avx2BroadcastTable(s_Utf8PrevLow),
+                                                      _mm256_and_si256(prev1, nibble));
+                __m256i currentHigh = _mm256_shuffle_epi8(Avx2BroadcastTable(s_Utf8CurrentHigh),
+                                                          _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+
+                __m256i special = _mm256_and_si256(_mm256_and_si256(prevHigh, prevLow), currentHigh);
+
+                // Only 111_____ two bytes back or 1111____ three bytes back keep their top bit,
+                // and those need a continuation here.
+                __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+                __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+                __m256i needsContinuation = _mm256_and_si256(_mm256_or_si256(third, fourth),
+                                                             _mm256_set1_epi8(static_cast<char>(0x80)));
+
+                errors = _mm256_xor_si256(needsContinuation, special);
+                check.Incomplete = _mm256_subs_epu8(input, _mm256_load_si256(reinterpret_cast<const __m256i*>(s_Utf8IncompleteMax)));
+            }
+            else
+            {
+                check.Incomplete = _mm256_setzero_si256();
+            }
+
+            check.Previous = input;
+            return (_mm256_testz_si256(errors, errors) == 0);
+        }
+
+        KITSUNE_TARGET("avx2") Usize Avx2FindInvalidUtf8(const Utf8Unit* str, Usize size)
+        {
+            Avx2Utf8Check check = { _mm256_setzero_si256(), _mm256_setzero_si256() };
+
+            Usize i = 0;
+            for (; i + 32 <= size; i += 32)
+            {
+                if (Avx2HasUtf8Errors(check, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i))))
+                    return FindInvalidUtf8From(str, size, i, 32);
+            }
+
+            // Zeros are ASCII, padding with them is enough to catch a truncated sequence.
+            alignas(32) Uint8 tail[32] = {};
+            if (i != size)
+                std::memcpy(tail, str + i, size - i);
+
+            if (Avx2HasUtf8Errors(check, _mm256_load_si256(reinterpret_cast<const __m256i*>(tail))))
+                return FindInvalidUtf8From(str, size, i, 32);
+
+            return size;
+        }
+#endif
+
+#if defined(KITSUNE_SIMD_NEON)
+        template<typename T>
+        Usize NeonFindMismatch(const T* str, Usize size, UnitPattern<T> pattern)
+        {
+            constexpr Usize lanes = 16 / sizeof(T);
+
+            uint8x16_t mask = NeonBroadcast(pattern.Mask);
+            uint8x16_t value = NeonBroadcast(pattern.Value);
+            Uint64 flip = pattern.Negate ? 0 : ~Uint64(0);
+
+            Usize i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                uint8x16_t block = NeonLoad(str + i);
+
+                Uint64 mismatches = NeonEqualMask<T>(vandq_u8(block, mask), value) ^ flip;
+                if (mismatches != 0)
+                    return i + static_cast<Usize>(std::countr_zero(mismatches) / 4) / sizeof(T);
+            }
+
+            return i + ScalarFindMismatch(str + i, size - i, pattern);
+        }
+
+        template<typename T, Usize N>
+        void NeonCountMatches(const T* str, Usize size, const UnitPattern<T> (&patterns)[N], Usize (&counts)[N])
+        {
+            constexpr Usize lanes = 16 / sizeof(T);
+
+            uint8x16_t masks[N], values[N], flips[N], counters[N];
+            uint64x2_t sums[N];
+
+            for (Usize j = 0; j < N; ++j)
+            {
+                masks[j] = NeonBroadcast(patterns[j].Mask);
+                values[j] = NeonBroadcast(patterns[j].Value);
+                flips[j] = vdupq_n_u8(patterns[j].Negate ? 0xFF : 0);
+
+                counters[j] = vdupq_n_u8(0);
+                sums[j] = vdupq_n_u64(0);
+            }
+
+            auto flush = [&]()
+            {
+                for (Usize j = 0; j < N; ++j)
+                {
+                    sums[j] = vaddq_u64(sums[j], vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(counters[j]))));
+                    counters[j] = vdupq_n_u8(0);
+                }
+            };
+
+            Usize i = 0, rounds = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                uint8x16_t block = NeonLoad(str + i);
+
+                for (Usize j = 0; j < N; ++j)
+                {
+                    uint8x16_t matches = NeonEqual<T>(vandq_u8(block, masks[j]), values[j]);
+                    counters[j] = vsubq_u8(counters[j], veorq_u8(matches, flips[j]));
+                }
+
+                if (++rounds == 255)
+                {
+                    flush();
+                    rounds = 0;
+                }
+            }
+
+            flush();
+            for (Usize j = 0; j < N; ++j)
+                counts[j] += static_cast<Usize>(vgetq_lane_u64(sums[j], 0) + vgetq_lane_u64(sums[j], 1)) / sizeof(T);
+
+            ScalarCountMatches(str + i, size - i, patterns, counts);
+        }
+
+        template<typename From, typename To>
+        Usize NeonConvertMatching(const From* src, Usize size, To* dest, UnitPattern<From> pattern)
+        {
+            constexpr Usize lanes = 16 / sizeof(From);
+
+            uint8x16_t mask = NeonBroadcast(pattern.Mask);
+            uint8x16_t value = NeonBroadcast(pattern.Value);
+            Uint64 flip = pattern.Negate ? 0 : ~Uint64(0);
+
+            Usize i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                uint8x16_t block = NeonLoad(src + i);
+                if ((NeonEqualMask<From>(vandq_u8(block, mask), value) ^ flip) != 0)
+                    break;
+
+                To* out = dest + i;
+
+                if constexpr (sizeof(From) == 1 && sizeof(To) == 2)
+                {
+                    vst1q_u16(reinterpret_cast<uint16_t*>(out), vmovl_u8(vget_low_u8(block)));
+                    vst1q_u16(reinterpret_cast<uint16_t*>(out + 8), vmovl_u8(vget_high_u8(block)));
+                }
+                else if constexpr (sizeof(From) == 1 && sizeof(To) == 4)
+                {
+                    uint16x8_t low = vmovl_u8(vget_low_u8(block));
+                    uint16x8_t high = vmovl_u8(vget_high_u8(block));
+
+                    vst1q_u32(reinterpret_cast<uint32_t*>(out), vmovl_u16(vget_low_u16(low)));
+                    vst1q_u32(reinterpret_cast<uint32_t*>(out + 4), vmovl_u16(vget_high_u16(low)));
+                    vst1q_u32(reinterpret_cast<uint32_t*>(out + 8), vmovl_u16(vget_low_u16(high)));
+                    vst1q_u32(reinterpret_cast<uint32_t*>(out + 12), vmovl_u16(vget_high_u16(high)));
+                }
+                else if constexpr (sizeof(From) == 2 && sizeof(To) == 4)
+                {
+                    uint16x8_t units = vreinterpretq_u16_u8(block);
+
+                    vst1q_u32(reinterpret_cast<uint32_t*>(out), vmovl_u16(vget_low_u16(units)));
+                    vst1q_u32(reinterpret_cast<uint32_t*>(out + 4), vmovl_u16(vget_high_u16(units)));
+                }
+                else if constexpr (sizeof(From) == 2 && sizeof(To) == 1)
+                {
+                    vst1_u8(reinterpret_cast<uint8_t*>(out), vmovn_u16(vreinterpretq_u16_u8(block)));
+                }
+                else if constexpr (sizeof(From) == 4 && sizeof(To) == 1)
+                {
+                    uint16x4_t words = vmovn_u32(vreinterpretq_u32_u8(block));
+                    uint8x8_t bytes = vmovn_u16(vcombine_u16(words, words));
+
+                    vst1_lane_u32(reinterpret_cast<uint32_t*>(out), vreinterpret_u32_u8(bytes), 0);
+                }
+                else
+                {
+                    vst1_u16(reinterpret_cast<uint16_t*>(out), vmovn_u32(vreinterpretq_u32_u8(block)));
+                }
+            }
+
+            return i;
+        }
+
+        Usize NeonFindInvalidUtf32(const char32_t* str, Usize size)
+        {
+            Usize i = 0;
+            for (; i + 4 <= size; i += 4)
+            {
+                uint32x4_t block = vld1q_u32(reinterpret_cast<const uint32_t*>(str + i));
+
+                uint32x4_t tooLarge = vcgtq_u32(block, vdupq_n_u32(0x10FFFF));
+                uint32x4_t surrogate = vcltq_u32(vsubq_u32(block, vdupq_n_u32(0xD800)), vdupq_n_u32(0x800));
+
+                Uint64 invalid = NeonMask(vreinterpretq_u8_u32(vorrq_u32(tooLarge, surrogate)));
+                if (invalid != 0)
+                    return i + static_cast<Usize>(std::countr_zero(invalid) / 16);
+            }
+
+            return i + ScalarFindInvalidUtf32(str + i, size - i);
+        }
+
+    #if defined(KITSUNE_ARCH_AARCH64)
+        // Same as the AVX2 version, on 16 byte blocks.
+        struct NeonUtf8Check
+        {
+            uint8x16_t Previous;
+            uint8x16_t Incomplete;
+        };
+
+        bool NeonHasUtf8Errors(NeonUtf8Check& check, uint8x16_t input)
+        {
+            uint8x16_t errors = check.Incomplete;
+
+            if (vmaxvq_u8(input) >= 0x80)
+            {
+                uint8x16_t prev1 = vextq_u8(check.Previous, input, 15);
+                uint8x16_t prev2 = vextq_u8(check.Previous, input, 14);
+                uint8x16_t prev3 = vextq_u8(check.Previous, input, 13);
+
+                uint8x16_t prevHigh = vqtbl1q_u8(vld1q_u8(s_Utf8PrevHigh), vshrq_n_u8(prev1, 4));
+                uint8x16_t prevLow = vqtbl1q_u8(vld1q_u8(s_Utf8PrevLow), vandq_u8(prev1, vdupq_n_u8(0x0F)));
+                uint8x16_t currentHigh = vqtbl1q_u8(vld1q_u8(s_Utf8CurrentHigh), vshrq_n_u8(input, 4));
+                uint8x16_t special = vandq_u8(vandq_u8(prevHigh, prevLow), currentHigh);
+
+                uint8x16_t third = vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80));
+                uint8x16_t fourth = vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80));
+                uint8x16_t needsContinuation = vandq_u8(vorrq_u8(third, fourth), vdupq_n_u8(0x80));
+
+                errors = veorq_u8(needsContinuation, special);
+                check.Incomplete = vqsubq_u8(input, vld1q_u8(s_Utf8IncompleteMax + 16));
+            }
+            else
+            {
+                check.Incomplete = vdupq_n_u8(0);
+            }
+
+            check.Previous = input;
+            return (vmaxvq_u8(errors) != 0);
+        }
+
+        Usize NeonFindInvalidUtf8(const Utf8Unit* str, Usize size)
+        {
+            NeonUtf8Check check = { vdupq_n_u8(0), vdupq_n_u8(0) };
+
+            Usize i = 0;
+            for (; i + 16 <= size; i += 16)
+            {
+                if (NeonHasUtf8Errors(check, vld1q_u8(str + i)))
+                    return FindInvalidUtf8From(str, size, i, 16);
+            }
+
+            alignas(16) Uint8 tail[16] = {};
+            if (i != size)
+                std::memcpy(tail, str + i, size - i);
+
+            if (NeonHasUtf8Errors(check, vld1q_u8(tail)))
+                return FindInvalidUtf8From(str, size, i, 16);
+
+            return size;
+        }
+    #endif
+#endif
+
+        template<typename T>
+        Usize FindMismatch(const T* str, Usize size, UnitPattern<T> pattern)
+        {
+            switch (GetCharKernelSet())
+            {
+#if defined(KITSUNE_SIMD_X86)
+            case CharKernelSet::AVX2: return Avx2FindMismatch(str, size, pattern);
+            case CharKernelSet::SSE2: return Sse2FindMismatch(str, size, pattern);
+#endif
+#if defined(KITSUNE_SIMD_NEON)
+            case CharKernelSet::NEON: return NeonFindMismatch(str, size, pattern);
+#endif
+            default:                  return ScalarFindMismatch(str, size, pattern);
+            }
+        }
+
+        template<typename T, Usize N>
+        void CountMatches(const T* str, Usize size, const UnitPattern<T> (&patterns)[N], Usize (&counts)[N])
+        {
+            switch (GetCharKernelSet())
+            {
+#if defined(KITSUNE_SIMD_X86)
+            case CharKernelSet::AVX2: Avx2CountMatches(str, size, patterns, counts); break;
+            case CharKernelSet::SSE2: Sse2CountMatches(str, size, patterns, counts); break;
+#endif
+#if defined(KITSUNE_SIMD_NEON)
+            case CharKernelSet::NEON: NeonCountMatches(str, size, patterns, counts); break;
+#endif
+            default:                  ScalarCountMatches(str, size, patterns, counts); break;
+            }
+        }
+
+        template<typename From, typename To>
+        Usize ConvertMatching(const From* src, Usize size, To* dest, UnitPattern<From> pattern)
+        {
+            switch (GetCharKernelSet())
+            {
+#if defined(KITSUNE_SIMD_X86)
+            case CharKernelSet::AVX2: return Avx2ConvertMatching(src, size, dest, pattern);
+            case CharKernelSet::SSE2: return Sse2ConvertMatching(src, size, dest, pattern);
+#endif
+#if defined(KITSUNE_SIMD_NEON)
+            case CharKernelSet::NEON: return NeonConvertMatching(src, size, dest, pattern);
+#endif
+            default:
+                KITSUNE_UNUSED(src); KITSUNE_UNUSED(size); KITSUNE_UNUSED(dest); KITSUNE_UNUSED(pattern);
+                return 0;
+            }
+        }
+
+        // Vector kernels for the runs of code units that convert one to one (`direct`), the
+        // decoders and encoders for everything in between.
+        template<typename From, typename To>
+        Usize Transcode(const From* src, Usize size, To* dest, UnitPattern<From> direct)
+        {
+            const From* end = src + size;
+            To* out = dest;
+
+            while (src != end)
+            {
+                Usize converted = ConvertMatching(src, static_cast<Usize>(end - src), out, direct);
+                src += converted;
+                out += converted;
+
+                const From* stop = src + KITSUNE_MIN(s_ScalarRun, static_cast<Usize>(end - src));
+                while (src < stop)
+                    Encode(Decode(src), out);
+            }
+
+            return static_cast<Usize>(out - dest);
+        }
+
+        // Skips over the code units that are valid on their own (`single`) with the vector
+        // kernels, and validates whatever is in between one sequence at a time.
+        template<typename T, typename SequenceLength>
+        Usize FindInvalidSequence(const T* str, Usize size, UnitPattern<T> single, SequenceLength sequenceLength)
+        {
+            Usize i = 0;
+
+            while (i != size)
+            {
+                i += FindMismatch(str + i, size - i, single);
+
+                Usize stop = i + KITSUNE_MIN(s_ScalarRun, size - i);
+                while (i < stop)
+                {
+                    Usize length = sequenceLength(str + i, size - i);
+                    if (length == 0)
+                        return i;
+
+                    i += length;
+                }
+            }
+
+            return size;
+        }
+
+        const Utf8Unit* AsUtf8Units(const char8_t* str) { return reinterpret_cast<const Utf8Unit*>(str); }
+        Utf8Unit* AsUtf8Units(char8_t* str)             { return reinterpret_cast<Utf8Unit*>(str); }
+    }
+
+    Usize FindInvalidUtf8(const char8_t* str, Usize size)
+    {
+        const Utf8Unit* units = AsUtf8Units(str);
+
+        switch (GetCharKernelSet())
+        {
+#if defined(KITSUNE_SIMD_X86)
+        case CharKernelSet::AVX2: return Avx2FindInvalidUtf8(units, size);
+#endif
+#if defined(KITSUNE_SIMD_NEON) && defined(KITSUNE_ARCH_AARCH64)
+        case CharKernelSet::NEON: return NeonFindInvalidUtf8(units, size);
+#endif
+        default:                  return FindInvalidSequence(units, size, s_Ascii<Utf8Unit>, ValidUtf8SequenceLength);
+        }
+    }
+
+    Usize FindInvalidUtf16(const char16_t* str, Usize size)
+    {
+        return FindInvalidSequence(str, size, s_NotSurrogate, ValidUtf16SequenceLength);
+    }
+
+    Usize FindInvalidUtf32(const char32_t* str, Usize size)
+    {
+        switch (GetCharKernelSet())
+        {
+#if defined(KITSUNE_SIMD_X86)
+        case CharKernelSet::AVX2: return Avx2FindInvalidUtf32(str, size);
+        case CharKernelSet::SSE2: return Sse2FindInvalidUtf32(str, size);
+#endif
+#if defined(KITSUNE_SIMD_NEON)
+        case CharKernelSet::NEON: return NeonFindInvalidUtf32(str, size);
+#endif
+        default:                  return ScalarFindInvalidUtf32(str, size);
+        }
+    }
+
+    // Lengths come from counting the code units that add or remove output units compared to
+    // one per input unit, which the vector kernels do without decoding anything.
+
+    Usize Utf8ToUtf16Length(const char8_t* str, Usize size)
+    {
+        constexpr UnitPattern<Utf8Unit> patterns[] = { s_Utf8Continuation, s_Utf8FourByteLead };
+        Usize counts[2] = {};
+
+        CountMatches(AsUtf8Units(str), size, patterns, counts);
+        return size - counts[0] + counts[1];
+    }
+
+    Usize Utf8ToUtf32Length(const char8_t* str, Usize size)
+    {
+        constexpr UnitPattern<Utf8Unit> patterns[] = { s_Utf8Continuation };
+        Usize counts[1] = {};
+
+        CountMatches(AsUtf8Units(str), size, patterns, counts);
+        return size - counts[0];
+    }
+
+    Usize Utf16ToUtf8Length(const char16_t* str, Usize size)
+    {
+        // 3 bytes per unit, minus one for each below U+0800 and one more for ASCII. Pairs of
+        // surrogates make 4 bytes, so each of them takes one off too.
+        constexpr UnitPattern<char16_t> patterns[] = { s_Ascii<char16_t>, s_Below800<char16_t>, s_Surrogate };
+        Usize counts[3] = {};
+
+        CountMatches(str, size, patterns, counts);
+        return 3 * size - counts[0] - counts[1] - counts[2];
+    }
+
+    Usize Utf16ToUtf32Length(const char16_t* str, Usize size)
+    {
+        constexpr UnitPattern<char16_t> patterns[] = { s_LowSurrogate };
+        Usize counts[1] = {};
+
+        CountMatches(str, size, patterns, counts);
+        return size - counts[0];
+    }
+
+    Usize Utf32ToUtf8Length(const char32_t* str, Usize size)
+    {
+        constexpr UnitPattern<char32_t> patterns[] = { s_Ascii<char32_t>, s_Below800<char32_t>, s_Bmp };
+        Usize counts[3] = {};
+
+        CountMatches(str, size, patterns, counts);
+        return 4 * size - counts[0] - counts[1] - counts[2];
+    }
+
+    Usize Utf32ToUtf16Length(const char32_t* str, Usize size)
+    {
+        constexpr UnitPattern<char32_t> patterns[] = { s_Bmp };
+        Usize counts[1] = {};
+
+        CountMatches(str, size, patterns, counts);
+        return 2 * size - counts[0];
+    }
+
+    // ASCII converts one to one between everything, BMP characters between UTF-16 and
+    // UTF-32 as long as they aren't surrogates (which valid UTF-32 never has).
+
+    Usize ConvertUtf8ToUtf16(const char8_t* src, Usize size, char16_t* dest)
+    {
+        return Transcode(AsUtf8Units(src), size, dest, s_Ascii<Utf8Unit>);
+    }
+
+    Usize ConvertUtf8ToUtf32(const char8_t* src, Usize size, char32_t* dest)
+    {
+        return Transcode(AsUtf8Units(src), size, dest, s_Ascii<Utf8Unit>);
+    }
+
+    Usize ConvertUtf16ToUtf8(const char16_t* src, Usize size, char8_t* dest)
+    {
+        return Transcode(src, size, AsUtf8Units(dest), s_Ascii<char16_t>);
+    }
+
+    Usize ConvertUtf16ToUtf32(const char16_t* src, Usize size, char32_t* dest)
+    {
+        return Transcode(src, size, dest, s_NotSurrogate);
+    }
+
+    Usize ConvertUtf32ToUtf8(const char32_t* src, Usize size, char8_t* dest)
+    {
+        return Transcode(src, size, AsUtf8Units(dest), s_Ascii<char32_t>);
+    }
+
+    Usize ConvertUtf32ToUtf16(const char32_t* src, Usize size, char16_t* dest)
+    {
+        return Transcode(src, size, dest, s_Bmp);
+    }
+}
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+#include "Foundation/Concepts/Character.h"
+
+#include "Foundation/String/String.h"
+#include "Foundation/String/StringView.h"
+#include "Foundation/String/InvalidUnicodeException.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        // Offset of the first code unit that doesn't start a valid sequence, `size` if the
+        // whole string is valid. Surrogates never are in UTF-8 and UTF-32, and only in pairs
+        // in UTF-16.
+        [[nodiscard]] KITSUNE_API_ Usize FindInvalidUtf8(const char8_t* str, Usize size);
+        [[nodiscard]] KITSUNE_API_ Usize FindInvalidUtf16(const char16_t* str, Usize size);
+        [[nodiscard]] KITSUNE_API_ Usize FindInvalidUtf32(const char32_t* str, Usize size);
+
+        // Code units the conversions below write for `str`, which has to be valid.
+        [[nodiscard]] KITSUNE_API_ Usize Utf8ToUtf16Length(const char8_t* str, Usize size);
+        [[nodiscard]] KITSUNE_API_ Usize Utf8ToUtf32Length(const char8_t* str, Usize size);
+        [[nodiscard]] KITSUNE_API_ Usize Utf16ToUtf8Length(const char16_t* str, Usize size);
+        [[nodiscard]] KITSUNE_API_ Usize Utf16ToUtf32Length(const char16_t* str, Usize size);
+        [[nodiscard]] KITSUNE_API_ Usize Utf32ToUtf8Length(const char32_t* str, Usize size);
+        [[nodiscard]] KITSUNE_API_ Usize Utf32ToUtf16Length(const char32_t* str, Usize size);
+
+        // No validation, `src` has to be valid and `dest` large enough for the length above.
+        // Returns the number of code units written.
+        KITSUNE_API_ Usize ConvertUtf8ToUtf16(const char8_t* src, Usize size, char16_t* dest);
+        KITSUNE_API_ Usize ConvertUtf8ToUtf32(const char8_t* src, Usize size, char32_t* dest);
+        KITSUNE_API_ Usize ConvertUtf16ToUtf8(const char16_t* src, Usize size, char8_t* dest);
+        KITSUNE_API_ Usize ConvertUtf16ToUtf32(const char16_t* src, Usize size, char32_t* dest);
+        KITSUNE_API_ Usize ConvertUtf32ToUtf8(const char32_t* src, Usize size, char8_t* dest);
+        KITSUNE_API_ Usize ConvertUtf32ToUtf16(const char32_t* src, Usize size, char16_t* dest);
+
+        // char holds UTF-8 and wchar_t whichever of UTF-16 and UTF-32 matches its size.
+        template<Character T>
+        using UnicodeUnit = std::conditional_t<sizeof(T) == 1, char8_t,
+                            std::conditional_t<sizeof(T) == 2, char16_t, char32_t>>;
+
+        template<Character T>
+        KITSUNE_FORCEINLINE const UnicodeUnit<T>* AsUnicodeUnits(const T* str)
+        {
+            return reinterpret_cast<const UnicodeUnit<T>*>(str);
+        }
+
+        template<Character T>
+        KITSUNE_FORCEINLINE UnicodeUnit<T>* AsUnicodeUnits(T* str)
+        {
+            return reinterpret_cast<UnicodeUnit<T>*>(str);
+        }
+
+        // Code units in the sequence starting with `unit`. Units that can't start one count
+        // as complete sequences of their own, validation is what rejects them.
+        template<Character T>
+        [[nodiscard]] constexpr Usize UnicodeSequenceLength(T unit)
+        {
+            auto value = static_cast<std::make_unsigned_t<T>>(unit);
+
+            if constexpr (sizeof(T) == 1)
+            {
+                if (value >= 0xC2 && value < 0xE0) return 2;
+                if (value >= 0xE0 && value < 0xF0) return 3;
+                if (value >= 0xF0 && value < 0xF5) return 4;
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                if ((value & 0xFC00) == 0xD800) return 2;
+            }
+
+            return 1;
+        }
+
+        // Size of `str` without the sequence it ends in the middle of, if any.
+        template<Character T>
+        [[nodiscard]] constexpr Usize CompleteUnicodePrefix(const T* str, Usize size)
+        {
+            Usize maxBack = KITSUNE_MIN(size, Usize(4 / sizeof(T) - 1));
+
+            for (Usize back = 1; back <= maxBack; ++back)
+            {
+                auto value = static_cast<std::make_unsigned_t<T>>(str[size - back]);
+
+                if (sizeof(T) == 1 && (value & 0xC0) == 0x80)
+                    continue;
+
+                return (UnicodeSequenceLength(str[size - back]) > back) ? size - back : size;
+            }
+
+            return size;
+        }
+
+        template<Character To, Character From>
+        Usize ConvertValidUnicode(const From* src, Usize size, To* dest)
+        {
+            const UnicodeUnit<From>* units = AsUnicodeUnits(src);
+            UnicodeUnit<To>* out = AsUnicodeUnits(dest);
+
+            if constexpr (sizeof(From) == sizeof(To))
+            {
+                if (size != 0)
+                    std::memcpy(out, units, size * sizeof(From));
+
+                return size;
+            }
+            else if constexpr (sizeof(From) == 1)
+            {
+                if constexpr (sizeof(To) == 2) return ConvertUtf8ToUtf16(units, size, out);
+                else                           return ConvertUtf8ToUtf32(units, size, out);
+            }
+            else if constexpr (sizeof(From) == 2)
+            {
+                if constexpr (sizeof(To) == 1) return ConvertUtf16ToUtf8(units, size, out);
+                else                           return ConvertUtf16ToUtf32(units, size, out);
+            }
+            else
+            {
+                if constexpr (sizeof(To) == 1) return ConvertUtf32ToUtf8(units, size, out);
+                else                           return ConvertUtf32ToUtf16(units, size, out);
+            }
+        }
+    }
+
+    template<Character T>
+    [[nodiscard]] inline Usize FindInvalidUnicode(const T* str, Usize size)
+    {
+        if constexpr (sizeof(T) == 1)
+            return Internal::FindInvalidUtf8(Internal::AsUnicodeUnits(str), size);
+        else if constexpr (sizeof(T) == 2)
+            return Internal::FindInvalidUtf16(Internal::AsUnicodeUnits(str), size);
+        else
+            return Internal::FindInvalidUtf32(Internal::AsUnicodeUnits(str), size);
+    }
+
+    template<Character T>
+    [[nodiscard]] inline bool IsValidUnicode(const T* str, Usize size)
+    {
+        return (FindInvalidUnicode(str, size) == size);
+    }
+
+    template<Character T>
+    [[nodiscard]] inline bool IsValidUnicode(BasicStringView<T> str)
+    {
+        return IsValidUnicode(str.Data(), str.Size());
+    }
+
+    // Exact number of To code units `str` converts to, `str` has to be valid.
+    template<Character To, Character From>
+    [[nodiscard]] inline Usize ConvertedLength(const From* str, Usize size)
+    {
+        using namespace Internal;
+        const UnicodeUnit<From>* units = AsUnicodeUnits(str);
+
+        if constexpr (sizeof(From) == sizeof(To))
+            return size;
+        else if constexpr (sizeof(From) == 1)
+            return (sizeof(To) == 2) ? Utf8ToUtf16Length(units, size) : Utf8ToUtf32Length(units, size);
+        else if constexpr (sizeof(From) == 2)
+            return (sizeof(To) == 1) ? Utf16ToUtf8Length(units, size) : Utf16ToUtf32Length(units, size);
+        else
+            return (sizeof(To) == 1) ? Utf32ToUtf8Length(units, size) : Utf32ToUtf16Length(units, size);
+    }
+
+    // Converts `src` into `dest`, which needs room for ConvertedLength<To>(src, size) code
+    // units. Returns the number of units written, throws InvalidUnicodeException (without
+    // writing anything) if `src` isn't valid.
+    template<Character To, Character From>
+    inline Usize ConvertUnicode(const From* src, Usize size, To* dest)
+    {
+        if (!IsValidUnicode(src, size))
+            throw InvalidUnicodeException();
+
+        return Internal::ConvertValidUnicode(src, size, dest);
+    }
+
+    template<Character To, Character From>
+    [[nodiscard]] inline BasicString<To> ConvertString(BasicStringView<From> str)
+    {
+        if (!IsValidUnicode(str))
+            throw InvalidUnicodeException();
+
+        BasicString<To> converted;
+        converted.ResizeAndOverwrite(ConvertedLength<To>(str.Data(), str.Size()), [&str](To* dest, Usize)
+        {
+            return Internal::ConvertValidUnicode(str.Data(), str.Size(), dest);
+        });
+
+        return converted;
+    }
+
+    template<Character To, Character From, Allocator Alloc>
+    [[nodiscard]] inline BasicString<To> ConvertString(const BasicString<From, Alloc>& str)
+    {
+        return ConvertString<To>(BasicStringView<From>(str.Data(), str.Size()));
+    }
+
+    template<Character To, Character From>
+    [[nodiscard]] inline BasicString<To> ConvertString(const From* str)
+    {
+        return ConvertString<To>(BasicStringView<From>(str));
+    }
+
+    // Like ConvertString(), but every code unit that doesn't start a valid sequence turns into
+    // U+FFFD instead of throwing, the same as the Win32 conversion functions do by default.
+    // Meant for text going to or coming from the OS, which doesn't have to be valid (unpaired
+    // surrogates in Windows command lines, for one).
+    template<Character To, Character From>
+    [[nodiscard]] inline BasicString<To> ConvertStringLossy(BasicStringView<From> str)
+    {
+        if (IsValidUnicode(str))
+            return ConvertString<To>(str);
+
+        constexpr Usize replacementSize = (sizeof(To) == 1) ? 3 : 1;
+
+        auto forEachRun = [&str](auto&& function)
+        {
+            const From* data = str.Data();
+            Usize size = str.Size();
+
+            while (size != 0)
+            {
+                Usize valid = FindInvalidUnicode(data, size);
+                function(data, valid, valid != size);
+
+                if (valid == size)
+                    break;
+
+                data += valid + 1;
+                size -= valid + 1;
+            }
+        };
+
+        Usize length = 0;
+        forEachRun([&length](const From* data, Usize size, bool replaced)
+        {
+            length += ConvertedLength<To>(data, size) + (replaced ? replacementSize : 0);
+        });
+
+        BasicString<To> converted;
+        converted.ResizeAndOverwrite(length, [&forEachRun](To* dest, Usize size)
+        {
+            forEachRun([&dest](const From* data, Usize count, bool replaced)
+            {
+                dest += Internal::ConvertValidUnicode(data, count, dest);
+                if (!replaced)
+                    return;
+
+                if constexpr (sizeof(To) == 1)
+                {
+                    *dest++ = static_cast<To>(0xEF);
+                    *dest++ = static_cast<To>(0xBF);
+                    *dest++ = static_cast<To>(0xBD);
+                }
+                else
+                {
+                    *dest++ = static_cast<To>(0xFFFD);
+                }
+            });
+
+            return size;
+        });
+
+        return converted;
+    }
+
+    template<Character To, Character From, Allocator Alloc>
+    [[nodiscard]] inline BasicString<To> ConvertStringLossy(const BasicString<From, Alloc>& str)
+    {
+        return ConvertStringLossy<To>(BasicStringView<From>(str.Data(), str.Size()));
+    }
+
+    template<Character To, Character From>
+    [[nodiscard]] inline BasicString<To> ConvertStringLossy(const From* str)
+    {
+        return ConvertStringLossy<To>(BasicStringView<From>(str));
+    }
+
+    // Converts text that arrives in chunks split at arbitrary code units: a character cut
+    // off at the end of a chunk is kept until the next one completes it.
+    template<Character To, Character From>
+    class UnicodeStreamConverter
+    {
+    public:
+        UnicodeStreamConverter() = default;
+
+    public:
+        // Enough room for whatever Convert() writes for a chunk of `size` code units.
+        [[nodiscard]] inline Usize MaxConvertedLength(Usize size) const
+        {
+            return (m_PendingSize + size) * s_MaxExpansion;
+        }
+
+        // Converts every complete character of `chunk` (and of whatever the previous chunk
+        // left over) into `dest`, and returns the number of code units written. Throws
+        // InvalidUnicodeException on invalid input.
+        inline Usize Convert(const From* chunk, Usize size, To* dest)
+        {
+            Usize written = 0;
+
+            if (m_PendingSize != 0)
+            {
+                Usize needed = Internal::UnicodeSequenceLength(m_Pending[0]);
+                Usize taken = KITSUNE_MIN(needed - m_PendingSize, size);
+
+                for (Usize i = 0; i < taken; ++i)
+                    m_Pending[m_PendingSize++] = chunk[i];
+
+                chunk += taken;
+                size -= taken;
+
+                if (m_PendingSize < needed)
+                    return 0;
+
+                written = ConvertUnicode(m_Pending, m_PendingSize, dest);
+                m_PendingSize = 0;
+            }
+
+            Usize complete = Internal::CompleteUnicodePrefix(chunk, size);
+            written += ConvertUnicode(chunk, complete, dest + written);
+
+            for (Usize i = complete; i < size; ++i)
+                m_Pending[m_PendingSize++] = chunk[i];
+
+            return written;
+        }
+
+        // Ends the stream, throws InvalidUnicodeException if it stopped in the middle of a
+        // character.
+        inline void Finish()
+        {
+            bool truncated = (m_PendingSize != 0);
+            m_PendingSize = 0;
+
+            if (truncated)
+                throw InvalidUnicodeException();
+        }
+
+        [[nodiscard]] inline bool HasPending() const { return (m_PendingSize != 0); }
+
+    private:
+        // Most To units a From unit turns into: BMP characters take 3 bytes in UTF-8 for one
+        // UTF-16 unit, everything else takes at most as many units as it did before.
+        static constexpr Usize s_MaxExpansion = (sizeof(To) >= sizeof(From)) ? 1 :
+                                                (sizeof(From) == 2)           ? 3 :
+                                                                                4 / sizeof(To);
+
+    private:
+        From m_Pending[4] = {};
+        Usize m_PendingSize = 0;
+    };
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <type_traits>
+
+namespace Kitsune
+{
+    // Whether an object can be moved to a new address with a plain memcpy()/memmove(), after
+    // which the old bytes are simply forgotten about instead of being destroyed. That holds for
+    // anything trivially copyable, and for most types which only own memory through pointers.
+    //
+    // Specialize it for such types, but never for ones that point into themselves.
+    template<typename T>
+    inline constexpr bool IsTriviallyRelocatable = std::is_trivially_copyable_v<T>;
+}
@@ -127,6 +127,50 @@ namespace Kitsune
         return __atomic_fetch_xor(dest, value, __ATOMIC_SEQ_CST);
     }
 
+    Int8 Interlocked::Exchange(volatile Int8* dest, Int8 value)
+    {
+        return __atomic_exchange_n(dest, value, __ATOMIC_SEQ_CST);
+    }
+
+    Int16 Interlocked::Exchange(volatile Int16* dest, Int16 value)
+    {
+        return __atomic_exchange_n(dest, value, __ATOMIC_SEQ_CST);
+    }
+
+    Int32 Interlocked::Exchange(volatile Int32* dest, Int32 value)
+    {
+        return __atomic_exchange_n(dest, value, __ATOMIC_SEQ_CST);
+    }
+
+    Int64 Interlocked::Exchange(volatile Int64* dest, Int64 value)
+    {
+        return __atomic_exchange_n(dest, value, __ATOMIC_SEQ_CST);
+    }
+
+    Int8 Interlocked::CompareExchange(volatile Int8* dest, Int8 value, Int8 comparand)
+    {
+        __atomic_compare_exchange_n(dest, &comparand, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+        return comparand;
+    }
+
+    Int16 Interlocked::CompareExchange(volatile Int16* dest, Int16 value, Int16 comparand)
+    {
+        __atomic_compare_exchange_n(dest, &comparand, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+        return comparand;
+    }
+
+    Int32 Interlocked::CompareExchange(volatile Int32* dest, Int32 value, Int32 comparand)
+    {
+        __atomic_compare_exchange_n(dest, &comparand, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+        return comparand;
+    }
+
+    Int64 Interlocked::CompareExchange(volatile Int64* dest, Int64 value, Int64 comparand)
+    {
+        __atomic_compare_exchange_n(dest, &comparand, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+        return comparand;
+    }
+
     Int8 Interlocked::Load(volatile const Int8* ptr)
     {
         return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
@@ -166,4 +210,16 @@ namespace Kitsune
     {
         __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
     }
+
+    template<typename T>
+    T* Interlocked::Load(T* volatile const* ptr)
+    {
+        return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+    }
+
+    template<typename T>
+    void Interlocked::Store(T* volatile* ptr, T* value)
+    {
+        __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
+    }
 }
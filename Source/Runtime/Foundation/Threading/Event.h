@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Foundation/Common/Macros.h"
+#include "Foundation/Memory/ScopedPtr.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        class IEventImpl
+        {
+        public:
+            virtual ~IEventImpl() { /* ... */ }
+
+        public:
+            virtual void Signal() = 0;
+            virtual void Wait() = 0;
+        };
+    }
+
+    // Auto-reset event. Signal() wakes up one thread waiting on it, or the next one to
+    // call Wait() if nobody is waiting yet. Signals don't add up, signaling twice before
+    // anyone waits still only lets a single Wait() through.
+    class Event
+    {
+    public:
+        KITSUNE_API_ Event();
+        ~Event() = default;
+
+    public:
+        Event(const Event&) = delete;
+        Event& operator=(const Event&) = delete;
+
+    public:
+        inline void Signal() { m_EventImpl->Signal(); }
+        inline void Wait()   { m_EventImpl->Wait(); }
+
+    private:
+        ScopedPtr<Internal::IEventImpl> m_EventImpl;
+    };
+}
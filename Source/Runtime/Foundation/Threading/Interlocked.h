@@ -42,6 +42,18 @@ namespace Kitsune
         KITSUNE_FORCEINLINE static Int32 Xor(volatile Int32* dest, Int32 value);
         KITSUNE_FORCEINLINE static Int64 Xor(volatile Int64* dest, Int64 value);
 
+    public:
+        KITSUNE_FORCEINLINE static Int8 Exchange(volatile Int8* dest, Int8 value);
+        KITSUNE_FORCEINLINE static Int16 Exchange(volatile Int16* dest, Int16 value);
+        KITSUNE_FORCEINLINE static Int32 Exchange(volatile Int32* dest, Int32 value);
+        KITSUNE_FORCEINLINE static Int64 Exchange(volatile Int64* dest, Int64 value);
+
+        // Returns the initial value of *dest, the exchange happened if it equals the comparand.
+        KITSUNE_FORCEINLINE static Int8 CompareExchange(volatile Int8* dest, Int8 value, Int8 comparand);
+        KITSUNE_FORCEINLINE static Int16 CompareExchange(volatile Int16* dest, Int16 value, Int16 comparand);
+        KITSUNE_FORCEINLINE static Int32 CompareExchange(volatile Int32* dest, Int32 value, Int32 comparand);
+        KITSUNE_FORCEINLINE static Int64 CompareExchange(volatile Int64* dest, Int64 value, Int64 comparand);
+
     public:
         KITSUNE_FORCEINLINE static Int8 Load(volatile const Int8* ptr);
         KITSUNE_FORCEINLINE static Int16 Load(volatile const Int16* ptr);
@@ -52,6 +64,15 @@ namespace Kitsune
         KITSUNE_FORCEINLINE static void Store(volatile Int16* ptr, Int16 value);
         KITSUNE_FORCEINLINE static void Store(volatile Int32* ptr, Int32 value);
         KITSUNE_FORCEINLINE static void Store(volatile Int64* ptr, Int64 value);
+
+    public:
+        // For publishing objects to other threads, everything written to the object before
+        // the store is visible to whoever loads the pointer.
+        template<typename T>
+        KITSUNE_FORCEINLINE static T* Load(T* volatile const* ptr);
+
+        template<typename T>
+        KITSUNE_FORCEINLINE static void Store(T* volatile* ptr, T* value);
     };
 }
 
@@ -0,0 +1,53 @@
+#include "Foundation/Threading/Event.h"
+#include <pthread.h>
+
+namespace Kitsune
+{
+    class LinuxEvent : public Internal::IEventImpl
+    {
+    public:
+        inline LinuxEvent()
+            : m_Signaled(false)
+        {
+            ::pthread_mutex_init(&m_Mutex, nullptr);
+            ::pthread_cond_init(&m_Condition, nullptr);
+        }
+
+        inline ~LinuxEvent()
+        {
+            ::pthread_cond_destroy(&m_Condition);
+            ::pthread_mutex_destroy(&m_Mutex);
+        }
+
+    public:
+        void Signal() override
+        {
+            ::pthread_mutex_lock(&m_Mutex);
+            m_Signaled = true;
+            ::pthread_mutex_unlock(&m_Mutex);
+
+            ::pthread_cond_signal(&m_Condition);
+        }
+
+        void Wait() override
+        {
+            ::pthread_mutex_lock(&m_Mutex);
+            while (!m_Signaled)
+                ::pthread_cond_wait(&m_Condition, &m_Mutex);
+
+            m_Signaled = false;
+            ::pthread_mutex_unlock(&m_Mutex);
+        }
+
+    private:
+        pthread_mutex_t m_Mutex;
+        pthread_cond_t m_Condition;
+
+        bool m_Signaled;
+    };
+
+    Event::Event()
+        : m_EventImpl(MakeScoped<LinuxEvent>())
+    {
+    }
+}
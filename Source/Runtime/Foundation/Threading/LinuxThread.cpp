@@ -0,0 +1,52 @@
+#include "Foundation/Threading/Thread.h"
+#include "Foundation/Threading/ThreadCreationException.h"
+
+#include <pthread.h>
+
+namespace Kitsune
+{
+    class LinuxThread : public Internal::IThreadImpl
+    {
+    public:
+        inline LinuxThread(Thread::EntryPoint entryPoint, void* userData)
+            : m_EntryPoint(entryPoint), m_UserData(userData)
+        {
+        }
+
+    public:
+        [[nodiscard]] inline bool Start()
+        {
+            return (::pthread_create(&m_Handle, nullptr, &LinuxThread::Run, this) == 0);
+        }
+
+        void Join() override
+        {
+            ::pthread_join(m_Handle, nullptr);
+        }
+
+    private:
+        static void* Run(void* param)
+        {
+            auto* thread = static_cast<LinuxThread*>(param);
+            thread->m_EntryPoint(thread->m_UserData);
+
+            return nullptr;
+        }
+
+    private:
+        pthread_t m_Handle;
+
+        Thread::EntryPoint m_EntryPoint;
+        void* m_UserData;
+    };
+
+    Thread::Thread(EntryPoint entryPoint, void* userData)
+    {
+        // Only keep the impl once the thread is running, so Join() never sees a bad handle.
+        ScopedPtr<LinuxThread> thread = MakeScoped<LinuxThread>(entryPoint, userData);
+        if (!thread->Start())
+            throw ThreadCreationException();
+
+        m_ThreadImpl = Move(thread);
+    }
+}
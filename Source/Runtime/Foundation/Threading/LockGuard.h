@@ -4,18 +4,19 @@
 
 namespace Kitsune
 {
+    template<typename LockType = Mutex>
     class LockGuard
     {
     public:
-        LockGuard(Mutex& mutex)
-            : m_Mutex(mutex)
+        LockGuard(LockType& lock)
+            : m_Lock(lock)
         {
-            m_Mutex.Acquire();
+            m_Lock.Acquire();
         }
 
         ~LockGuard()
         {
-            m_Mutex.Release();
+            m_Lock.Release();
         }
 
     public:
@@ -23,6 +24,6 @@ namespace Kitsune
         LockGuard& operator=(const LockGuard&) = delete;
 
     private:
-        Mutex& m_Mutex;
+        LockType& m_Lock;
     };
 }
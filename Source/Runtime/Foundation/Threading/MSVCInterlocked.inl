@@ -133,6 +133,47 @@ namespace Kitsune
         return (Int32)::_InterlockedXor64((volatile __int64*)dest, (__int64)value);
     }
 
+    Int8 Interlocked::Exchange(volatile Int8* dest, Int8 value)
+    {
+        return (Int8)::_InterlockedExchange8((volatile char*)dest, (char)value);
+    }
+
+    Int16 Interlocked::Exchange(volatile Int16* dest, Int16 value)
+    {
+        return (Int16)::_InterlockedExchange16((volatile short*)dest, (short)value);
+    }
+
+    Int32 Interlocked::Exchange(volatile Int32* dest, Int32 value)
+    {
+        return (Int32)::_InterlockedExchange((volatile long*)dest, (long)value);
+    }
+
+    Int64 Interlocked::Exchange(volatile Int64* dest, Int64 value)
+    {
+        return (Int64)::_InterlockedExchange64((volatile __int64*)dest, (__int64)value);
+    }
+
+    Int8 Interlocked::CompareExchange(volatile Int8* dest, Int8 value, Int8 comparand)
+    {
+        return (Int8)::_InterlockedCompareExchange8((volatile char*)dest, (char)value, (char)comparand);
+    }
+
+    Int16 Interlocked::CompareExchange(volatile Int16* dest, Int16 value, Int16 comparand)
+    {
+        return (Int16)::_InterlockedCompareExchange16((volatile short*)dest, (short)value, (short)comparand);
+    }
+
+    Int32 Interlocked::CompareExchange(volatile Int32* dest, Int32 value, Int32 comparand)
+    {
+        return (Int32)::_InterlockedCompareExchange((volatile long*)dest, (long)value, (long)comparand);
+    }
+
+    Int64 Interlocked::CompareExchange(volatile Int64* dest, Int64 value, Int64 comparand)
+    {
+        return (Int64)::_InterlockedCompareExchange64((volatile __int64*)dest,
+                                                      (__int64)value, (__int64)comparand);
+    }
+
     Int8 Interlocked::Load(volatile const Int8* ptr)
     {
         return (Int8)::_InterlockedCompareExchange8((char*)ptr, 0, 0);
@@ -172,4 +213,16 @@ namespace Kitsune
     {
         ::_InterlockedExchange64((long long*)ptr, value);
     }
+
+    template<typename T>
+    T* Interlocked::Load(T* volatile const* ptr)
+    {
+        return (T*)::_InterlockedCompareExchangePointer((void* volatile*)ptr, nullptr, nullptr);
+    }
+
+    template<typename T>
+    void Interlocked::Store(T* volatile* ptr, T* value)
+    {
+        ::_InterlockedExchangePointer((void* volatile*)ptr, (void*)value);
+    }
 }
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Foundation/Common/Types.h"
+#include "Foundation/Common/Macros.h"
+#include "Foundation/Common/Predefined.h"
+
+#include "Foundation/Threading/Interlocked.h"
+
+#if defined(KITSUNE_COMPILER_MSVC)
+    #include <intrin.h>
+#elif defined(KITSUNE_ARCH_X86)
+    #include <immintrin.h>
+#endif
+
+namespace Kitsune
+{
+    // Busy-waiting lock for very short critical sections. Unlike Mutex, this never
+    // allocates, so the memory subsystem can use it too.
+    class SpinLock
+    {
+    public:
+        constexpr SpinLock() : m_Locked(0) { /* ... */ }
+        ~SpinLock() = default;
+
+    public:
+        SpinLock(const SpinLock&) = delete;
+        SpinLock& operator=(const SpinLock&) = delete;
+
+    public:
+        inline void Acquire()
+        {
+            while (Interlocked::Exchange(&m_Locked, 1) != 0)
+            {
+                // Spin on a plain load so we don't keep stealing the cache line.
+                while (Interlocked::Load(&m_Locked) != 0)
+                    Pause();
+            }
+        }
+
+        inline bool TryAcquire()
+        {
+            return (Interlocked::Exchange(&m_Locked, 1) == 0);
+        }
+
+        inline void Release()
+        {
+            Interlocked::Store(&m_Locked, 0);
+        }
+
+    public:
+        // Tells the CPU we're busy-waiting, for other spin loops too.
+        KITSUNE_FORCEINLINE static void Pause()
+        {
+#if defined(KITSUNE_ARCH_X86)
+            _mm_pause();
+#elif defined(KITSUNE_ARCH_ARM) && defined(KITSUNE_COMPILER_MSVC)
+            __yield();
+#elif defined(KITSUNE_ARCH_ARM)
+            __asm__ __volatile__("yield");
+#endif
+        }
+
+    private:
+        volatile Int32 m_Locked;
+    };
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Foundation/Common/Macros.h"
+#include "Foundation/Memory/ScopedPtr.h"
+
+namespace Kitsune
+{
+    namespace Internal
+    {
+        class IThreadImpl
+        {
+        public:
+            virtual ~IThreadImpl() { /* ... */ }
+
+        public:
+            virtual void Join() = 0;
+        };
+    }
+
+    // OS thread running `entryPoint(userData)`. A thread that's still running gets joined
+    // when it's destroyed, it's never left detached.
+    class Thread
+    {
+    public:
+        using EntryPoint = void (*)(void* userData);
+
+    public:
+        Thread() = default;
+        KITSUNE_API_ Thread(EntryPoint entryPoint, void* userData);
+
+        inline ~Thread()
+        {
+            Join();
+        }
+
+    public:
+        Thread(const Thread&) = delete;
+        Thread& operator=(const Thread&) = delete;
+
+    public:
+        [[nodiscard]] inline bool IsJoinable() const { return static_cast<bool>(m_ThreadImpl); }
+
+        // Waits for the thread to return, does nothing if there's no thread.
+        inline void Join()
+        {
+            if (!m_ThreadImpl)
+                return;
+
+            m_ThreadImpl->Join();
+            m_ThreadImpl.Reset();
+        }
+
+    private:
+        ScopedPtr<Internal::IThreadImpl> m_ThreadImpl;
+    };
+}
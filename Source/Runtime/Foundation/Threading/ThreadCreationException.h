@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Foundation/Diagnostics/IException.h"
+
+namespace Kitsune
+{
+    class ThreadCreationException : public IException
+    {
+    public:
+        ThreadCreationException() = default;
+
+    public:
+        const char* GetName() const noexcept override { return "ThreadCreationException"; }
+        const char* GetDescription() const noexcept override
+        {
+            return "The operating system failed to start a new thread";
+        }
+    };
+}
@@ -0,0 +1,31 @@
+#include "Foundation/Threading/Event.h"
+#include <Windows.h>
+
+namespace Kitsune
+{
+    class WindowsEvent : public Internal::IEventImpl
+    {
+    public:
+        inline WindowsEvent()
+            : m_Handle(::CreateEventW(nullptr, FALSE, FALSE, nullptr))
+        {
+        }
+
+        inline ~WindowsEvent()
+        {
+            ::CloseHandle(m_Handle);
+        }
+
+    public:
+        void Signal() override { ::SetEvent(m_Handle); }
+        void Wait() override   { ::WaitForSingleObject(m_Handle, INFINITE); }
+
+    private:
+        HANDLE m_Handle;
+    };
+
+    Event::Event()
+        : m_EventImpl(MakeScoped<WindowsEvent>())
+    {
+    }
+}
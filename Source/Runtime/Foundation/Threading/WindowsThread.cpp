@@ -0,0 +1,59 @@
+#include "Foundation/Threading/Thread.h"
+#include "Foundation/Threading/ThreadCreationException.h"
+
+#include <Windows.h>
+
+namespace Kitsune
+{
+    class WindowsThread : public Internal::IThreadImpl
+    {
+    public:
+        inline WindowsThread(Thread::EntryPoint entryPoint, void* userData)
+            : m_Handle(nullptr), m_EntryPoint(entryPoint), m_UserData(userData)
+        {
+        }
+
+        inline ~WindowsThread()
+        {
+            if (m_Handle != nullptr)
+                ::CloseHandle(m_Handle);
+        }
+
+    public:
+        [[nodiscard]] inline bool Start()
+        {
+            m_Handle = ::CreateThread(nullptr, 0, &WindowsThread::Run, this, 0, nullptr);
+            return (m_Handle != nullptr);
+        }
+
+        void Join() override
+        {
+            ::WaitForSingleObject(m_Handle, INFINITE);
+        }
+
+    private:
+        static DWORD WINAPI Run(LPVOID param)
+        {
+            auto* thread = static_cast<WindowsThread*>(param);
+            thread->m_EntryPoint(thread->m_UserData);
+
+            return 0;
+        }
+
+    private:
+        HANDLE m_Handle;
+
+        Thread::EntryPoint m_EntryPoint;
+        void* m_UserData;
+    };
+
+    Thread::Thread(EntryPoint entryPoint, void* userData)
+    {
+        // Only keep the impl once the thread is running, so Join() never sees a bad handle.
+        ScopedPtr<WindowsThread> thread = MakeScoped<WindowsThread>(entryPoint, userData);
+        if (!thread->Start())
+            throw ThreadCreationException();
+
+        m_ThreadImpl = Move(thread);
+    }
+}
@@ -1,4 +1,6 @@
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 #include "Foundation/Common/Macros.h"
 #include "Foundation/Diagnostics/IException.h"
@@ -16,11 +18,44 @@ namespace Kitsune
     class MemorySubsystemGuard
     {
     public:
-        MemorySubsystemGuard() { Memory::InitializeExplicit(); }
+        MemorySubsystemGuard()
+        {
+            Memory::InitializeExplicit(GetRequestedBackend(), GetRequestedTracking());
+        }
+
         ~MemorySubsystemGuard()
         {
             Memory::Shutdown();
         }
+
+    private:
+        // CMalloc unless KITSUNE_MEMORY_BACKEND is "threadcaching". Its blocks are gone once
+        // Memory::Shutdown() returns, and the engine still frees some after that, so it's
+        // only safe together with KITSUNE_MEMORY_TRACKING (the tracker keeps its backend).
+        static MemoryBackend GetRequestedBackend()
+        {
+            const char* value = std::getenv("KITSUNE_MEMORY_BACKEND");
+            if (value != nullptr && std::strcmp(value, "threadcaching") == 0)
+                return MemoryBackend::ThreadCaching;
+
+            return MemoryBackend::CMalloc;
+        }
+
+        // Tracking costs a header per allocation, it's only turned on when asked for through
+        // KITSUNE_MEMORY_TRACKING ("stats" or "tags"). Nothing else can be used this early.
+        static MemoryTracking GetRequestedTracking()
+        {
+            const char* value = std::getenv("KITSUNE_MEMORY_TRACKING");
+            if (value == nullptr)
+                return MemoryTracking::Disabled;
+
+            if (std::strcmp(value, "stats") == 0)
+                return MemoryTracking::Statistics;
+            else if (std::strcmp(value, "tags") == 0)
+                return MemoryTracking::TagBreakdown;
+
+            return MemoryTracking::Disabled;
+        }
     };
 
     int UnguardedEngineMain(int argc, char** argv)
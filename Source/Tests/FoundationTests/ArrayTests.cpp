@@ -4,6 +4,8 @@
 #include "IteratorWrappers.h"
 
 #include "Foundation/Containers/Array.h"
+#include "Foundation/Memory/SharedPtr.h"
+#include "Foundation/String/String.h"
 
 namespace ArrayTesting
 {
@@ -80,6 +82,29 @@ namespace ArrayTesting
         int ID = 0;
     };
 
+    // Counts how often the block got resized rather than reallocated.
+    class ResizingAllocator : public Kitsune::GlobalAllocator
+    {
+    public:
+        bool TryExpand(void* ptr, Kitsune::Usize bytes)
+        {
+            bool expanded = Kitsune::Memory::TryExpand(ptr, bytes);
+            Expansions += expanded;
+
+            return expanded;
+        }
+
+        void* TryReallocate(void* ptr, Kitsune::Usize bytes, Kitsune::Usize align)
+        {
+            ++Reallocations;
+            return Kitsune::Memory::TryReallocate(ptr, bytes, align);
+        }
+
+    public:
+        static inline int Expansions = 0;
+        static inline int Reallocations = 0;
+    };
+
     class O
     {
     public:
@@ -97,6 +122,37 @@ namespace ArrayTesting
     public:
         int ID = 0;
     };
+
+    struct MoveFailed {};
+
+    // Throws once MovesLeft runs out (-1 never does), Live counts the instances that haven't
+    // been destroyed.
+    class T
+    {
+    public:
+        T(int id) : ID(id) { ++Live; }
+        T(const T& obj) : ID(obj.ID) { ++Live; }
+        T(T&& obj)
+            : ID(obj.ID)
+        {
+            if (MovesLeft == 0)
+            {
+                MovesLeft = -1;
+                throw MoveFailed();
+            }
+
+            MovesLeft -= (MovesLeft > 0);
+            ++Live;
+        }
+
+        ~T() { --Live; }
+
+    public:
+        int ID;
+
+        static inline int Live = 0;
+        static inline int MovesLeft = -1;
+    };
 }
 
 using namespace Kitsune;
@@ -630,3 +686,118 @@ TEST(ArrayTests, SwapAlgorithm)
     EXPECT_EQ(arr2[2].ID, 4343);
     EXPECT_EQ(arr2[3].ID, 121);
 }
+
+TEST(ArrayTests, ResizeInPlace)
+{
+    ResizingAllocator::Expansions = 0;
+    ResizingAllocator::Reallocations = 0;
+
+    Array<int, ResizingAllocator> arr;
+    for (int i = 0; i < 10000; ++i)
+        arr.PushBack(i);
+
+    for (int i = 0; i < 10000; ++i)
+        ASSERT_EQ(arr[i], i);
+
+    EXPECT_GT(ResizingAllocator::Expansions + ResizingAllocator::Reallocations, 0);
+
+    arr.ShrinkToFit();
+    EXPECT_EQ(arr.Capacity(), 10000);
+    EXPECT_EQ(arr[9999], 9999);
+}
+
+TEST(ArrayTests, ResizeInPlaceNonTrivial)
+{
+    ResizingAllocator::Reallocations = 0;
+
+    // O has a move constructor, realloc() can't be used to move it around.
+    Array<O, ResizingAllocator> arr;
+    for (int i = 0; i < 1000; ++i)
+        arr.PushBack(O(i));
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(arr[i].ID, i);
+
+    EXPECT_EQ(ResizingAllocator::Reallocations, 0);
+}
+
+TEST(ArrayTests, RelocateSharedPtr)
+{
+    Array<SharedPtr<int>> arr;
+    for (int i = 0; i < 100; ++i)
+        arr.PushBack(MakeShared<int>(i));
+
+    arr.Insert(arr.GetBegin() + 10, MakeShared<int>(-1));
+    arr.Remove(arr.GetBegin() + 50, arr.GetBegin() + 60);
+
+    EXPECT_EQ(arr.Size(), 91);
+    EXPECT_EQ(*arr[10], -1);
+    EXPECT_EQ(*arr[11], 10);
+    EXPECT_EQ(*arr[50], 59);
+
+    for (const SharedPtr<int>& ptr : arr)
+        EXPECT_EQ(ptr.GetCount(), 1);
+}
+
+TEST(ArrayTests, RelocateString)
+{
+    Array<String> arr;
+    for (int i = 0; i < 20; ++i)
+        arr.PushBack(String(i % 2 ? "Short" : "A string long enough to not fit in the small buffer."));
+
+    arr.Insert(arr.GetBegin(), String("First"));
+    arr.Remove(arr.GetBegin() + 1);
+
+    EXPECT_EQ(arr.Size(), 20);
+    EXPECT_EQ(arr[0], "First");
+    EXPECT_EQ(arr[1], "Short");
+    EXPECT_EQ(arr[19], "Short");
+    EXPECT_EQ(arr[18], "A string long enough to not fit in the small buffer.");
+}
+
+TEST(ArrayTests, ThrowingMoveGrow)
+{
+    {
+        Array<T> arr;
+        arr.Reserve(4);
+
+        for (int i = 0; i < 4; ++i)
+            arr.PushBack(T(i));
+
+        T::MovesLeft = 2;
+        EXPECT_THROW(arr.Reserve(16), MoveFailed);
+
+        // Nothing got moved from yet when the move threw, the array is untouched.
+        EXPECT_EQ(arr.Size(), 4);
+        EXPECT_EQ(T::Live, 4);
+
+        for (int i = 0; i < 4; ++i)
+            EXPECT_EQ(arr[i].ID, i);
+    }
+
+    EXPECT_EQ(T::Live, 0);
+}
+
+TEST(ArrayTests, ThrowingMoveInsertRemove)
+{
+    {
+        Array<T> arr;
+        arr.Reserve(16);
+
+        for (int i = 0; i < 8; ++i)
+            arr.PushBack(T(i));
+
+        T::MovesLeft = 3;
+        EXPECT_THROW(arr.Insert(arr.GetBegin(), T(-1)), MoveFailed);
+        EXPECT_EQ(T::Live, static_cast<int>(arr.Size()));
+
+        T::MovesLeft = 1;
+        EXPECT_THROW(arr.Remove(arr.GetBegin()), MoveFailed);
+        EXPECT_EQ(T::Live, static_cast<int>(arr.Size()));
+
+        for (Usize i = 0; i < arr.Size(); ++i)
+            EXPECT_EQ(arr[i].ID, static_cast<int>(i) + 1);
+    }
+
+    EXPECT_EQ(T::Live, 0);
+}
@@ -0,0 +1,339 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Foundation/Logging/Logger.h"
+#include "Foundation/Logging/AsyncLogSink.h"
+#include "Foundation/Threading/Event.h"
+#include "Foundation/Memory/BadAllocException.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    struct Record
+    {
+        std::string Message;
+        std::string LoggerName;
+        SourceLocation Location;
+        LogSeverity Severity;
+    };
+
+    // Only ever called from the worker, no locking needed.
+    class RecordingSink : public ILogSink
+    {
+    public:
+        void Log(const LogMessage& message) override
+        {
+            Records.push_back({ std::string(message.Message.Data(), message.Message.Size()),
+                                std::string(message.LoggerName.Data(), message.LoggerName.Size()),
+                                message.Location, message.Severity });
+        }
+
+        void Flush() override { ++FlushCount; }
+
+    public:
+        std::vector<Record> Records;
+        int FlushCount = 0;
+    };
+
+    // Holds up the worker on the first message until it gets opened.
+    class GatedSink : public RecordingSink
+    {
+    public:
+        void Log(const LogMessage& message) override
+        {
+            if (Records.empty())
+            {
+                Entered.Signal();
+                Gate.Wait();
+            }
+
+            RecordingSink::Log(message);
+        }
+
+    public:
+        Event Entered;
+        Event Gate;
+    };
+
+    struct SinkFailed {};
+
+    // Throws on messages that say "Throw", and from every other Flush().
+    class ThrowingSink : public RecordingSink
+    {
+    public:
+        void Log(const LogMessage& message) override
+        {
+            if (message.Message == StringView("Throw"))
+                throw SinkFailed();
+
+            RecordingSink::Log(message);
+        }
+
+        void Flush() override
+        {
+            if (FlushCount++ % 2 == 0)
+                throw SinkFailed();
+        }
+    };
+
+    LogMessage MakeMessage(StringView text, LogSeverity severity = LogSeverity::Info,
+                           SourceLocation loc = SourceLocation())
+    {
+        return LogMessage(text, "LOGGER", loc, severity);
+    }
+}
+
+TEST(AsyncLogSinkTests, Ctor)
+{
+    auto sink = MakeShared<RecordingSink>();
+    AsyncLogSink async(sink, 100, LogOverflowPolicy::DropAndCount);
+
+    EXPECT_EQ(async.GetSinks()[0], sink);
+    EXPECT_EQ(async.GetCapacity(), 128);
+    EXPECT_EQ(async.GetOverflowPolicy(), LogOverflowPolicy::DropAndCount);
+    EXPECT_EQ(async.GetDroppedCount(), 0);
+}
+
+TEST(AsyncLogSinkTests, InitListCtor)
+{
+    SharedPtr<ILogSink> sinks[2] = { MakeShared<RecordingSink>(), MakeShared<RecordingSink>() };
+    AsyncLogSink async({ sinks[0], sinks[1] });
+
+    EXPECT_EQ(async.GetSinks()[0], sinks[0]);
+    EXPECT_EQ(async.GetSinks()[1], sinks[1]);
+    EXPECT_EQ(async.GetCapacity(), AsyncLogSink::s_DefaultCapacity);
+    EXPECT_EQ(async.GetOverflowPolicy(), LogOverflowPolicy::Block);
+}
+
+TEST(AsyncLogSinkTests, LogAndFlush)
+{
+    auto sink = MakeShared<RecordingSink>();
+    AsyncLogSink async(sink);
+
+    SourceLocation loc = SourceLocation::Current();
+    async.Log(MakeMessage("First", LogSeverity::Warning, loc));
+    async.Log(MakeMessage("Second", LogSeverity::Error));
+    async.Flush();
+
+    ASSERT_EQ(sink->Records.size(), 2);
+    EXPECT_EQ(sink->Records[0].Message, "First");
+    EXPECT_EQ(sink->Records[0].LoggerName, "LOGGER");
+    EXPECT_EQ(sink->Records[0].Location, loc);
+    EXPECT_EQ(sink->Records[0].Severity, LogSeverity::Warning);
+    EXPECT_EQ(sink->Records[1].Message, "Second");
+    EXPECT_EQ(sink->Records[1].Severity, LogSeverity::Error);
+
+    EXPECT_EQ(sink->FlushCount, 1);
+}
+
+TEST(AsyncLogSinkTests, LogLongMessage)
+{
+    auto sink = MakeShared<RecordingSink>();
+    AsyncLogSink async(sink);
+
+    std::string text(1000, 'x');
+    async.Log(MakeMessage(StringView(text.data(), text.size())));
+    async.Log(MakeMessage(""));
+    async.Flush();
+
+    ASSERT_EQ(sink->Records.size(), 2);
+    EXPECT_EQ(sink->Records[0].Message, text);
+    EXPECT_EQ(sink->Records[0].LoggerName, "LOGGER");
+    EXPECT_EQ(sink->Records[1].Message, "");
+}
+
+TEST(AsyncLogSinkTests, LogThrowsBadAlloc)
+{
+    auto sink = MakeShared<RecordingSink>();
+    AsyncLogSink async(sink, 2);
+
+    // Never read, the copy has nowhere to go.
+    const char* text = "x";
+    EXPECT_THROW(async.Log(MakeMessage(StringView(text, Usize(1) << 62))), BadAllocException);
+
+    // Didn't leave a slot behind that the worker would wait on forever.
+    for (int i = 0; i < 4; ++i)
+        async.Log(MakeMessage("After"));
+
+    async.Flush();
+
+    ASSERT_EQ(sink->Records.size(), 4);
+    EXPECT_EQ(sink->Records[3].Message, "After");
+}
+
+TEST(AsyncLogSinkTests, ThrowingSink)
+{
+    auto throwing = MakeShared<ThrowingSink>();
+    auto recording = MakeShared<RecordingSink>();
+
+    {
+        AsyncLogSink async({ throwing, recording }, 4);
+
+        for (int i = 0; i < 8; ++i)
+            async.Log(MakeMessage((i % 2 == 0) ? "Throw" : "Fine"));
+
+        // Kept from the worker, the queue kept moving and the other sink saw everything.
+        EXPECT_THROW(async.Flush(), SinkFailed);
+        EXPECT_EQ(throwing->Records.size(), 4);
+        EXPECT_EQ(recording->Records.size(), 8);
+
+        async.Flush();
+        EXPECT_EQ(throwing->FlushCount, 2);
+
+        async.Log(MakeMessage("Fine"));
+    }
+
+    // Throwing on the last flush didn't stop the destructor either.
+    EXPECT_EQ(throwing->Records.size(), 5);
+    EXPECT_EQ(recording->Records.size(), 9);
+}
+
+TEST(AsyncLogSinkTests, EverySink)
+{
+    auto a = MakeShared<RecordingSink>();
+    auto b = MakeShared<RecordingSink>();
+    AsyncLogSink async({ a, b });
+
+    async.Log(MakeMessage("Hello!"));
+    async.Flush();
+
+    ASSERT_EQ(a->Records.size(), 1);
+    ASSERT_EQ(b->Records.size(), 1);
+    EXPECT_EQ(a->FlushCount, 1);
+    EXPECT_EQ(b->FlushCount, 1);
+}
+
+TEST(AsyncLogSinkTests, DestructorDrains)
+{
+    auto sink = MakeShared<RecordingSink>();
+    {
+        AsyncLogSink async(sink, 4);
+        for (int i = 0; i < 100; ++i)
+            async.Log(MakeMessage("Message"));
+    }
+
+    EXPECT_EQ(sink->Records.size(), 100);
+    EXPECT_EQ(sink->FlushCount, 1);
+}
+
+TEST(AsyncLogSinkTests, BlockWithManyProducers)
+{
+    constexpr int threadCount = 4;
+    constexpr int messageCount = 2000;
+
+    auto sink = MakeShared<RecordingSink>();
+    AsyncLogSink async(sink, 8, LogOverflowPolicy::Block);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&async, t]()
+        {
+            for (int i = 0; i < messageCount; ++i)
+            {
+                std::string text = std::to_string(t) + ":" + std::to_string(i);
+                async.Log(MakeMessage(StringView(text.data(), text.size())));
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    async.Flush();
+    ASSERT_EQ(sink->Records.size(), threadCount * messageCount);
+
+    // Nothing lost, and every thread's messages in the order it logged them.
+    int next[threadCount] = {};
+    for (const Record& record : sink->Records)
+    {
+        Usize colon = record.Message.find(':');
+        int t = std::stoi(record.Message.substr(0, colon));
+        int i = std::stoi(record.Message.substr(colon + 1));
+
+        EXPECT_EQ(i, next[t]);
+        next[t] = i + 1;
+    }
+
+    EXPECT_EQ(async.GetDroppedCount(), 0);
+}
+
+TEST(AsyncLogSinkTests, Drop)
+{
+    auto sink = MakeShared<GatedSink>();
+    AsyncLogSink async(sink, 4, LogOverflowPolicy::Drop);
+
+    // The worker is stuck on the first one, which keeps its slot until it's done. Three
+    // more fill the queue.
+    async.Log(MakeMessage("Stuck"));
+    sink->Entered.Wait();
+
+    for (int i = 0; i < 10; ++i)
+        async.Log(MakeMessage("Message"));
+
+    sink->Gate.Signal();
+    async.Flush();
+
+    EXPECT_EQ(sink->Records.size(), 4);
+    EXPECT_EQ(async.GetDroppedCount(), 0);
+}
+
+TEST(AsyncLogSinkTests, DropAndCount)
+{
+    auto sink = MakeShared<GatedSink>();
+    AsyncLogSink async(sink, 4, LogOverflowPolicy::DropAndCount);
+
+    async.Log(MakeMessage("Stuck"));
+    sink->Entered.Wait();
+
+    for (int i = 0; i < 10; ++i)
+        async.Log(MakeMessage("Message"));
+
+    EXPECT_EQ(async.GetDroppedCount(), 7);
+
+    sink->Gate.Signal();
+    async.Flush();
+
+    // Whatever made it in, and how many didn't after the batch it was noticed in.
+    ASSERT_EQ(sink->Records.size(), 5);
+
+    int reports = 0;
+    for (const Record& record : sink->Records)
+    {
+        if (record.Severity != LogSeverity::Warning)
+            continue;
+
+        EXPECT_EQ(record.Message, "7 log messages were dropped, the queue was full.");
+        EXPECT_EQ(record.LoggerName, "");
+        ++reports;
+    }
+
+    EXPECT_EQ(reports, 1);
+
+    // Only ever reported once.
+    async.Log(MakeMessage("After"));
+    async.Flush();
+
+    ASSERT_EQ(sink->Records.size(), 6);
+    EXPECT_EQ(sink->Records[5].Message, "After");
+}
+
+TEST(AsyncLogSinkTests, WithLogger)
+{
+    auto sink = MakeShared<RecordingSink>();
+    {
+        Logger logger("LOGGER", MakeShared<AsyncLogSink>(sink));
+        logger.LogFormat(LogSeverity::Info, "Hello {0}!", 42);
+        logger.Flush();
+
+        ASSERT_EQ(sink->Records.size(), 1);
+        EXPECT_EQ(sink->Records[0].Message, "Hello 42!");
+    }
+
+    EXPECT_EQ(sink->FlushCount, 2);
+}
@@ -298,6 +298,55 @@ TEST(BasicStringTests, IsLocal)
     EXPECT_FALSE(heapAllocated.IsLocal());
 }
 
+TEST(BasicStringTests, Layout)
+{
+    EXPECT_EQ(sizeof(String), 3 * sizeof(Usize));
+    EXPECT_EQ(sizeof(U32String), 3 * sizeof(Usize));
+
+    EXPECT_EQ(String().Capacity(), 3 * sizeof(Usize) - 1);
+    EXPECT_EQ(U16String().Capacity(), 3 * sizeof(Usize) / 2 - 1);
+    EXPECT_EQ(U32String().Capacity(), 3 * sizeof(Usize) / 4 - 1);
+}
+
+TEST(BasicStringTests, FullLocalBuffer)
+{
+    Usize capacity = String().Capacity();
+    String full(capacity, 'x');
+
+    EXPECT_TRUE(full.IsLocal());
+    EXPECT_EQ(full.Size(), capacity);
+    EXPECT_EQ(full.Data()[capacity], '\0');
+
+    full.PopBack();
+    EXPECT_EQ(full.Size(), capacity - 1);
+    EXPECT_EQ(full.Data()[capacity - 1], '\0');
+
+    full.PushBack('y');
+    full.PushBack('z');
+
+    EXPECT_FALSE(full.IsLocal());
+    EXPECT_EQ(full.Size(), capacity + 1);
+    EXPECT_EQ(full, String(capacity - 1, 'x') + "yz");
+
+    full.Remove(full.GetBegin() + 2, full.GetEnd());
+    full.ShrinkToFit();
+
+    EXPECT_TRUE(full.IsLocal());
+    EXPECT_GENERAL_STREQ(full.Raw(), "xx");
+}
+
+TEST(BasicStringTests, MoveLocal)
+{
+    BasicString<char16_t> str = u"Kitsune";
+    BasicString<char16_t> moved = Move(str);
+
+    EXPECT_TRUE(moved.IsLocal());
+    EXPECT_GENERAL_STREQ(moved.Raw(), u"Kitsune");
+
+    EXPECT_TRUE(str.IsEmpty());
+    EXPECT_GENERAL_STREQ(str.Raw(), u"");
+}
+
 TEST(BasicStringTests, Size)
 {
     BasicString<char32_t> empty;
@@ -544,6 +593,21 @@ TEST(BasicStringTests, Substring)
     EXPECT_GENERAL_STREQ(substr.Data(), u"Star");
 }
 
+TEST(BasicStringTests, Slice)
+{
+    BasicString<char16_t> str = u"Twinkle Twinkle Little Star";
+
+    BasicStringView<char16_t> slice = str.Slice(8, 7);
+    EXPECT_EQ(slice.Data(), str.Data() + 8);
+    EXPECT_TRUE(slice == u"Twinkle");
+
+    EXPECT_TRUE(str.Slice(16) == u"Little Star");
+    EXPECT_TRUE(str.Slice(23, 100) == u"Star");
+    EXPECT_TRUE(str.Slice(str.Size()).IsEmpty());
+
+    EXPECT_THROW((void)str.Slice(str.Size() + 1), OutOfRangeException);
+}
+
 TEST(BasicStringTests, RangedForLoop)
 {
     BasicString<char8_t> str = u8"abcdefghijklmnopqrstuvwxyz";
@@ -617,3 +681,35 @@ TEST(BasicStringTests, Equal)
     EXPECT_TRUE(arr.Raw() == arr2);
     EXPECT_FALSE(arr.Raw() == diff);
 }
+
+TEST(BasicStringTests, ReserveKeepsContents)
+{
+    String str = "A string long enough to not fit in the small buffer.";
+
+    str.Reserve(100);
+    EXPECT_GE(str.Capacity(), 100);
+
+    str.Reserve(100000);
+    EXPECT_GE(str.Capacity(), 100000);
+    EXPECT_GENERAL_STREQ(str.Data(), "A string long enough to not fit in the small buffer.");
+
+    str.ShrinkToFit();
+    EXPECT_EQ(str.Capacity(), str.Size());
+    EXPECT_GENERAL_STREQ(str.Data(), "A string long enough to not fit in the small buffer.");
+}
+
+TEST(BasicStringTests, Find)
+{
+    String str = "error: file not found, error: permission denied";
+
+    EXPECT_EQ(str.Find("error"), 0);
+    EXPECT_EQ(str.Find("error", 1), 23);
+    EXPECT_EQ(str.Find(String("denied")), str.Size() - 6);
+    EXPECT_EQ(str.Find("warning"), String::s_NoPosition);
+
+    EXPECT_EQ(str.Find(','), 21);
+    EXPECT_EQ(str.FindAny(":,"), 5);
+
+    EXPECT_TRUE(str.Contains("permission"));
+    EXPECT_FALSE(str.Contains('!'));
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Foundation/String/CharTraits.h"
+
+namespace Testing
+{
+    // Runs `test` once for every character kernel set the CPU supports, then goes back to
+    // the default one.
+    template<typename Fn>
+    void ForEachCharKernelSet(Fn&& test)
+    {
+        using Kitsune::Internal::CharKernelSet;
+
+        constexpr CharKernelSet sets[] =
+        {
+            CharKernelSet::Scalar, CharKernelSet::SSE2, CharKernelSet::AVX2, CharKernelSet::NEON
+        };
+
+        CharKernelSet original = Kitsune::Internal::GetCharKernelSet();
+
+        for (CharKernelSet set : sets)
+        {
+            if (!Kitsune::Internal::SetCharKernelSet(set))
+                continue;
+
+            SCOPED_TRACE(static_cast<int>(set));
+            test();
+        }
+
+        Kitsune::Internal::SetCharKernelSet(original);
+    }
+}
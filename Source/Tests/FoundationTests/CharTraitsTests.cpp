@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 
 #include "CompareStrings.h"
+#include "CharKernelSets.h"
+
 #include "Foundation/String/CharTraits.h"
+#include "Foundation/Memory/VirtualMemory.h"
 
 #include <cstring>
+#include <vector>
 
 using namespace Kitsune;
 
@@ -126,3 +130,167 @@ TEST(CharTraitsTests, FindChr)
     EXPECT_EQ(CharTraits<char32_t>::Find(u32haystack, KITSUNE_ARRAY_SIZE(u32haystack), u32needle), u32haystack + 2);
     EXPECT_EQ(CharTraits<char32_t>::Find(u32haystack, KITSUNE_ARRAY_SIZE(u32haystack), u32incorrectNeedle), nullptr);
 }
+
+namespace
+{
+    template<typename T>
+    void TestLengthAgainstReference()
+    {
+        // Every length around the block sizes, at every alignment.
+        std::vector<T> buffer(200, T('a'));
+
+        for (Usize offset = 0; offset < 32 / sizeof(T); ++offset)
+        {
+            for (Usize length = 0; length < 150; ++length)
+            {
+                buffer[offset + length] = T();
+                EXPECT_EQ(CharTraits<T>::Length(buffer.data() + offset), length);
+                buffer[offset + length] = T('a');
+            }
+        }
+    }
+
+    template<typename T>
+    void TestCompareAgainstReference()
+    {
+        std::vector<T> str1(150, T('a'));
+        std::vector<T> str2(150, T('a'));
+
+        for (Usize count = 0; count < 130; ++count)
+        {
+            EXPECT_EQ(CharTraits<T>::Compare(str1.data(), str2.data(), count), 0);
+
+            for (Usize diff = 0; diff < count; ++diff)
+            {
+                str2[diff] = T('b');
+                EXPECT_LT(CharTraits<T>::Compare(str1.data(), str2.data(), count), 0);
+                EXPECT_GT(CharTraits<T>::Compare(str2.data(), str1.data(), count), 0);
+
+                // Only the first difference counts.
+                if (diff != count - 1)
+                {
+                    str1[count - 1] = T('z');
+                    EXPECT_LT(CharTraits<T>::Compare(str1.data(), str2.data(), count), 0);
+                    str1[count - 1] = T('a');
+                }
+
+                str2[diff] = T('a');
+            }
+
+            // Past the count doesn't matter.
+            str2[count] = T('b');
+            EXPECT_EQ(CharTraits<T>::Compare(str1.data(), str2.data(), count), 0);
+            str2[count] = T('a');
+        }
+    }
+
+    template<typename T>
+    void TestFindAgainstReference()
+    {
+        std::vector<T> haystack(150, T('a'));
+
+        for (Usize count = 0; count < 130; ++count)
+        {
+            EXPECT_EQ(CharTraits<T>::Find(haystack.data(), count, T('b')), nullptr);
+
+            for (Usize at = 0; at < count; ++at)
+            {
+                haystack[at] = T('b');
+                haystack[count - 1] = T('b');
+
+                EXPECT_EQ(CharTraits<T>::Find(haystack.data(), count, T('b')), haystack.data() + at);
+
+                haystack[at] = T('a');
+                haystack[count - 1] = T('a');
+            }
+
+            haystack[count] = T('b');
+            EXPECT_EQ(CharTraits<T>::Find(haystack.data(), count, T('b')), nullptr);
+            haystack[count] = T('a');
+        }
+    }
+}
+
+TEST(CharTraitsTests, LengthKernels)
+{
+    Testing::ForEachCharKernelSet([]()
+    {
+        TestLengthAgainstReference<char8_t>();
+        TestLengthAgainstReference<char16_t>();
+        TestLengthAgainstReference<char32_t>();
+    });
+}
+
+TEST(CharTraitsTests, CompareKernels)
+{
+    Testing::ForEachCharKernelSet([]()
+    {
+        TestCompareAgainstReference<char8_t>();
+        TestCompareAgainstReference<char16_t>();
+        TestCompareAgainstReference<char32_t>();
+    });
+}
+
+TEST(CharTraitsTests, FindKernels)
+{
+    Testing::ForEachCharKernelSet([]()
+    {
+        TestFindAgainstReference<char8_t>();
+        TestFindAgainstReference<char16_t>();
+        TestFindAgainstReference<char32_t>();
+    });
+}
+
+TEST(CharTraitsTests, KernelsHandleFullRange)
+{
+    // Signed comparisons or subtractions would get these wrong.
+    Testing::ForEachCharKernelSet([]()
+    {
+        char8_t u8str1[] = u8"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\x7F";
+        char8_t u8str2[] = u8"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\xFF";
+        EXPECT_LT(CharTraits<char8_t>::Compare(u8str1, u8str2, KITSUNE_ARRAY_SIZE(u8str1)), 0);
+
+        char32_t u32str1[] = U"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+        char32_t u32str2[] = U"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+        u32str1[20] = 0x00000001;
+        u32str2[20] = 0xFFFFFFFF;
+        EXPECT_LT(CharTraits<char32_t>::Compare(u32str1, u32str2, KITSUNE_ARRAY_SIZE(u32str1)), 0);
+        EXPECT_GT(CharTraits<char32_t>::Compare(u32str2, u32str1, KITSUNE_ARRAY_SIZE(u32str1)), 0);
+
+        EXPECT_EQ(CharTraits<char32_t>::Find(u32str2, KITSUNE_ARRAY_SIZE(u32str2), 0xFFFFFFFF), u32str2 + 20);
+
+        char16_t u16str[] = u"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+        u16str[30] = 0xFFFF;
+        EXPECT_EQ(CharTraits<char16_t>::Find(u16str, KITSUNE_ARRAY_SIZE(u16str), char16_t(0xFFFF)), u16str + 30);
+    });
+}
+
+TEST(CharTraitsTests, KernelsStopAtPageEnd)
+{
+    // Strings right at the end of the last committed page, anything reading past them faults.
+    Usize pageSize = VirtualMemory::GetPageSize();
+    char* pages = static_cast<char*>(VirtualMemory::Reserve(2 * pageSize));
+
+    ASSERT_NE(pages, nullptr);
+    ASSERT_TRUE(VirtualMemory::Commit(pages, pageSize));
+
+    Testing::ForEachCharKernelSet([&]()
+    {
+        for (Usize length = 0; length < 70; ++length)
+        {
+            char16_t* end = reinterpret_cast<char16_t*>(pages + pageSize);
+            char16_t* str = end - length - 1;
+
+            for (char16_t* it = str; it != end; ++it)
+                *it = u'a';
+
+            end[-1] = u'\0';
+
+            EXPECT_EQ(CharTraits<char16_t>::Length(str), length);
+            EXPECT_EQ(CharTraits<char16_t>::Find(str, length + 1, u'b'), nullptr);
+            EXPECT_EQ(CharTraits<char16_t>::Compare(str, str, length + 1), 0);
+        }
+    });
+
+    VirtualMemory::Release(pages, 2 * pageSize);
+}
@@ -28,6 +28,22 @@ TEST(CopyTests, Copy)
     EXPECT_EQ(destArr[4], 6);
 }
 
+TEST(CopyTests, CopyPointers)
+{
+    int arr[5] = { 2, 3, 1, 4, 6 };
+    int destArr[5] = { 54, 1, 2, 6, 3 };
+
+    int* it = Algorithms::Copy(arr, arr + 5, destArr);
+    EXPECT_EQ(it, destArr + 5);
+
+    EXPECT_EQ(destArr[0], 2);
+    EXPECT_EQ(destArr[4], 6);
+
+    // Empty ranges don't touch the output at all.
+    EXPECT_EQ(Algorithms::Copy(arr, arr, destArr), destArr);
+    EXPECT_EQ(Algorithms::CopyN(arr, 0, destArr), destArr);
+}
+
 TEST(CopyTests, CopyN)
 {
     int arr[5] = { 2, 3, 1, 4, 6 };
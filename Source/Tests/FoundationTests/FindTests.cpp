@@ -35,6 +35,21 @@ TEST(FindTests, FindRangeByEquality)
     EXPECT_EQ(Algorithms::Find(cont.Begin, cont.End, wontFind.Begin, wontFind.End), cont.End);
 }
 
+TEST(FindTests, FindRangeOfCharacters)
+{
+    const char str[] = "one two three two one";
+    const char16_t wide[] = u"one two three two one";
+
+    const char two[] = "two";
+    const char16_t wideThree[] = u"three";
+
+    EXPECT_EQ(Algorithms::Find(str, str + 21, two, two + 3), str + 4);
+    EXPECT_EQ(Algorithms::Find(str, str + 6, two, two + 3), str + 6);
+    EXPECT_EQ(Algorithms::Find(str, str + 21, two, two), str);
+
+    EXPECT_EQ(Algorithms::Find(wide, wide + 21, wideThree, wideThree + 5), wide + 8);
+}
+
 TEST(FindTests, FindIf)
 {
     int arr[5] = { 1, 2, 54, 2, 1 };
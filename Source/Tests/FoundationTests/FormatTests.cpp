@@ -1,11 +1,19 @@
 #include <gtest/gtest.h>
+#include <limits>
 #include "CompareStrings.h"
 
 #include "Foundation/String/Format.h"
+#include "Foundation/Logging/WriteStreamIterator.h"
 
 namespace
 {
     class A { /* ... */ };
+
+    // Writes more than fits on the stack, and counts how often it was asked to.
+    struct B
+    {
+        static inline int FormatCount = 0;
+    };
 }
 
 namespace Kitsune
@@ -33,6 +41,25 @@ namespace Kitsune
     private:
         bool m_Flag = false;
     };
+
+    template<>
+    class Formatter<B>
+    {
+    public:
+        void Parse(const ParseContext& /* context */) { /* ... */ }
+
+        template<typename Out>
+        Out Format(const FormatContext<B, Out>& context)
+        {
+            ++B::FormatCount;
+
+            Out out = context.GetOutput();
+            for (int i = 0; i < 600; ++i)
+                *out++ = 'b';
+
+            return out;
+        }
+    };
 }
 
 using namespace Kitsune;
@@ -86,9 +113,139 @@ TEST(FormatTests, IntegralFormatting)
     EXPECT_GENERAL_STREQ(Format("{0:X}", 256).Raw(), "100");
 }
 
-TEST(FormatTests, FloatingPointFormatting)
+TEST(FormatTests, IntegralLimits)
+{
+    EXPECT_GENERAL_STREQ(Format("{0}", 0).Raw(), "0");
+    EXPECT_GENERAL_STREQ(Format("{0:x}", 0).Raw(), "0");
+
+    EXPECT_GENERAL_STREQ(Format("{0} {1}", 9, 10).Raw(), "9 10");
+    EXPECT_GENERAL_STREQ(Format("{0} {1}", 99999, 100000).Raw(), "99999 100000");
+
+    EXPECT_GENERAL_STREQ(Format("{0}", ~Uint64(0)).Raw(), "18446744073709551615");
+    EXPECT_GENERAL_STREQ(Format("{0}", Int64(-9223372036854775807 - 1)).Raw(), "-9223372036854775808");
+}
+
+TEST(FormatTests, IntegralWidthAndFill)
+{
+    EXPECT_GENERAL_STREQ(Format("[{0:5}]", 42).Raw(), "[   42]");
+    EXPECT_GENERAL_STREQ(Format("[{0:<5}]", 42).Raw(), "[42   ]");
+    EXPECT_GENERAL_STREQ(Format("[{0:^6}]", 42).Raw(), "[  42  ]");
+    EXPECT_GENERAL_STREQ(Format("[{0:*>5}]", 42).Raw(), "[***42]");
+    EXPECT_GENERAL_STREQ(Format("[{0:1}]", 12345).Raw(), "[12345]");
+
+    EXPECT_GENERAL_STREQ(Format("{0:05}", -42).Raw(), "-0042");
+    EXPECT_GENERAL_STREQ(Format("{0:08X}", 255).Raw(), "000000FF");
+    EXPECT_GENERAL_STREQ(Format("{0:_>10b}", 5).Raw(), "_______101");
+}
+
+TEST(FormatTests, IntegralSign)
+{
+    EXPECT_GENERAL_STREQ(Format("{0:+}", 42).Raw(), "+42");
+    EXPECT_GENERAL_STREQ(Format("{0:+}", -42).Raw(), "-42");
+    EXPECT_GENERAL_STREQ(Format("{0: d}", 42).Raw(), " 42");
+    EXPECT_GENERAL_STREQ(Format("{0:-}", 42).Raw(), "42");
+
+    EXPECT_GENERAL_STREQ(Format("{0:+05}", 42).Raw(), "+0042");
+    EXPECT_GENERAL_STREQ(Format("[{0:<+5}]", 42).Raw(), "[+42  ]");
+}
+
+TEST(FormatTests, IntegralInvalidSpecifiers)
+{
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{0:q}"), 1)), FormatException);
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{0:5xx}"), 1)), FormatException);
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{0:99999}"), 1)), FormatException);
+}
+
+TEST(FormatTests, IntegerToChars)
+{
+    char buffer[MaxIntegerChars<Int64>];
+
+    EXPECT_EQ(StringView(buffer, IntegerToChars(buffer, 1234567)), "1234567");
+    EXPECT_EQ(StringView(buffer, IntegerToChars(buffer, Int16(-32768))), "-32768");
+    EXPECT_EQ(StringView(buffer, IntegerToChars(buffer, Uint8(255), 16, false)), "ff");
+    EXPECT_EQ(StringView(buffer, IntegerToChars(buffer, Int8(-1), 2)), "11111111");
+
+    for (Uint64 value = 1; value != 0 && value < ~Uint64(0) / 10; value *= 10)
+    {
+        EXPECT_EQ(StringView(buffer, IntegerToChars(buffer, value - 1)).Size(),
+                  (value == 1) ? 1u : Format("{0}", value).Size() - 1);
+    }
+}
+
+TEST(FormatTests, FloatingPointShortest)
+{
+    EXPECT_GENERAL_STREQ(Format("{0}", 0.0).Raw(), "0");
+    EXPECT_GENERAL_STREQ(Format("{0}", -0.0).Raw(), "-0");
+    EXPECT_GENERAL_STREQ(Format("{0}", 1.5).Raw(), "1.5");
+    EXPECT_GENERAL_STREQ(Format("{0}", 0.1).Raw(), "0.1");
+    EXPECT_GENERAL_STREQ(Format("{0}", 0.1f).Raw(), "0.1");
+    EXPECT_GENERAL_STREQ(Format("{0}", 0.3).Raw(), "0.3");
+    EXPECT_GENERAL_STREQ(Format("{0}", 0.1 + 0.2).Raw(), "0.30000000000000004");
+    EXPECT_GENERAL_STREQ(Format("{0}", -1234.5678).Raw(), "-1234.5678");
+    EXPECT_GENERAL_STREQ(Format("{0}", 100.0).Raw(), "100");
+
+    EXPECT_GENERAL_STREQ(Format("{0}", 1e17).Raw(), "1e+17");
+    EXPECT_GENERAL_STREQ(Format("{0}", 1.25e-5).Raw(), "1.25e-05");
+    EXPECT_GENERAL_STREQ(Format("{0}", 1.7976931348623157e308).Raw(), "1.7976931348623157e+308");
+    EXPECT_GENERAL_STREQ(Format("{0}", 5e-324).Raw(), "5e-324");
+    EXPECT_GENERAL_STREQ(Format("{0}", 3.4028235e38f).Raw(), "3.4028235e+38");
+}
+
+TEST(FormatTests, FloatingPointPrecision)
+{
+    EXPECT_GENERAL_STREQ(Format("{0:f}", 3.14159).Raw(), "3.141590");
+    EXPECT_GENERAL_STREQ(Format("{0:.2f}", 3.14159).Raw(), "3.14");
+    EXPECT_GENERAL_STREQ(Format("{0:.0f}", 2.5).Raw(), "2");
+    EXPECT_GENERAL_STREQ(Format("{0:.0f}", 3.5).Raw(), "4");
+    EXPECT_GENERAL_STREQ(Format("{0:.2f}", 2.675).Raw(), "2.67");   // Just below 2.675.
+    EXPECT_GENERAL_STREQ(Format("{0:.1f}", 0.04).Raw(), "0.0");
+    EXPECT_GENERAL_STREQ(Format("{0:.1f}", 0.06).Raw(), "0.1");
+    EXPECT_GENERAL_STREQ(Format("{0:.2f}", 9.999).Raw(), "10.00");
+    EXPECT_GENERAL_STREQ(Format("{0:.20f}", 0.1).Raw(), "0.10000000000000000555");
+
+    EXPECT_GENERAL_STREQ(Format("{0:e}", 1234.5).Raw(), "1.234500e+03");
+    EXPECT_GENERAL_STREQ(Format("{0:.2E}", 0.000123).Raw(), "1.23E-04");
+    EXPECT_GENERAL_STREQ(Format("{0:.0e}", 9.5).Raw(), "1e+01");
+
+    EXPECT_GENERAL_STREQ(Format("{0:g}", 1234.5).Raw(), "1234.5");
+    EXPECT_GENERAL_STREQ(Format("{0:g}", 1234567.0).Raw(), "1.23457e+06");
+    EXPECT_GENERAL_STREQ(Format("{0:.3g}", 0.0001234).Raw(), "0.000123");
+    EXPECT_GENERAL_STREQ(Format("{0:.3G}", 0.00001234).Raw(), "1.23E-05");
+    EXPECT_GENERAL_STREQ(Format("{0:.3}", 100.0).Raw(), "100");
+}
+
+TEST(FormatTests, FloatingPointWidthAndSign)
+{
+    EXPECT_GENERAL_STREQ(Format("[{0:8.2f}]", 3.14159).Raw(), "[    3.14]");
+    EXPECT_GENERAL_STREQ(Format("[{0:<8}]", 1.5).Raw(), "[1.5     ]");
+    EXPECT_GENERAL_STREQ(Format("[{0:*^9}]", -1.5).Raw(), "[**-1.5***]");
+    EXPECT_GENERAL_STREQ(Format("{0:+08.3f}", 2.0).Raw(), "+002.000");
+    EXPECT_GENERAL_STREQ(Format("{0:08}", -2.5).Raw(), "-00002.5");
+    EXPECT_GENERAL_STREQ(Format("{0: }", 2.5).Raw(), " 2.5");
+}
+
+TEST(FormatTests, FloatingPointNonFinite)
+{
+    double infinity = std::numeric_limits<double>::infinity();
+    double nan = std::numeric_limits<double>::quiet_NaN();
+
+    EXPECT_GENERAL_STREQ(Format("{0} {1}", infinity, -infinity).Raw(), "inf -inf");
+    EXPECT_GENERAL_STREQ(Format("{0:F} {1:+}", infinity, nan).Raw(), "INF +nan");
+    EXPECT_GENERAL_STREQ(Format("[{0:06}]", infinity).Raw(), "[   inf]");
+
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{0:x}"), 1.0)), FormatException);
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{0:.}"), 1.0)), FormatException);
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{0:.2}"), 1)), FormatException);
+}
+
+TEST(FormatTests, FloatToChars)
 {
-    // Implemented using std::snprintf()..
+    char buffer[MaxFloatChars];
+
+    EXPECT_EQ(StringView(buffer, FloatToChars(buffer, 0.25)), "0.25");
+    EXPECT_EQ(StringView(buffer, FloatToChars(buffer, 16777216.0f)), "16777216");
+    EXPECT_EQ(StringView(buffer, FloatToChars(buffer, -2.2250738585072014e-308)), "-2.2250738585072014e-308");
+    EXPECT_EQ(StringView(buffer, FloatToChars(buffer, 1e-7f)), "1e-07");
 }
 
 TEST(FormatTests, CharFormatting)
@@ -114,3 +271,145 @@ TEST(FormatTests, StringFormatting)
     EXPECT_GENERAL_STREQ(Format("{0}", StringView("Yoo!")).Raw(), "Yoo!");
     EXPECT_GENERAL_STREQ(Format("{0}", String("Flakjsdasdkasd")).Raw(), "Flakjsdasdkasd");
 }
+
+TEST(FormatTests, EscapedBraces)
+{
+    EXPECT_GENERAL_STREQ(Format("{{}}").Raw(), "{}");
+    EXPECT_GENERAL_STREQ(Format("{{{0}}}", 5).Raw(), "{5}");
+    EXPECT_GENERAL_STREQ(Format("a {{ b }} c").Raw(), "a { b } c");
+}
+
+TEST(FormatTests, RepeatedArguments)
+{
+    EXPECT_GENERAL_STREQ(Format("{0}{0}{1}{0}", 'a', "b").Raw(), "aaba");
+    EXPECT_GENERAL_STREQ(Format("{0:x} = {0:d}", 255).Raw(), "FF = 255");
+}
+
+TEST(FormatTests, FormatToBuffer)
+{
+    char buffer[32] = {};
+    char* end = FormatTo(buffer, "{0}-{1}", 12, "ab");
+
+    EXPECT_EQ(end, buffer + 5);
+    EXPECT_GENERAL_STREQ(buffer, "12-ab");
+}
+
+TEST(FormatTests, FormatToStreamWritesRuns)
+{
+    class CountingStream : public IWriteStream<char>
+    {
+    public:
+        void Write(const char* data, Usize count) override
+        {
+            Output.Append(data, count);
+            ++WriteCount;
+        }
+
+    public:
+        String Output;
+        int WriteCount = 0;
+    };
+
+    CountingStream stream;
+    FormatTo(WriteStreamIterator<char>(stream), "Hello {0}, {1}! [{2:5}]", "World", 42, 1.5);
+
+    EXPECT_GENERAL_STREQ(stream.Output.Raw(), "Hello World, 42! [  1.5]");
+    // One write per literal, argument and run of padding.
+    EXPECT_EQ(stream.WriteCount, 8);
+}
+
+TEST(FormatTests, FormattedSize)
+{
+    EXPECT_EQ(FormattedSize("abc"), 3u);
+    EXPECT_EQ(FormattedSize("{0} + {1} = {2}", 12, 30, 42), 12u);
+    EXPECT_EQ(FormattedSize("[{0:10}]", 1.5), 12u);
+    EXPECT_EQ(FormattedSize(RuntimeFormat("{0}{0}"), "ab"), 4u);
+}
+
+TEST(FormatTests, FormatToN)
+{
+    char buffer[8] = {};
+
+    auto result = FormatToN(buffer, 5, "{0}-{1}", 1234, "abcd");
+    EXPECT_EQ(result.Size, 9u);
+    EXPECT_EQ(result.Out, buffer + 5);
+    EXPECT_EQ(StringView(buffer, 5), "1234-");
+
+    result = FormatToN(buffer, sizeof(buffer), "{0}", 7);
+    EXPECT_EQ(result.Size, 1u);
+    EXPECT_EQ(result.Out, buffer + 1);
+    EXPECT_EQ(buffer[0], '7');
+
+    result = FormatToN(buffer, 0, "{0}", 7);
+    EXPECT_EQ(result.Size, 1u);
+    EXPECT_EQ(result.Out, buffer);
+}
+
+TEST(FormatTests, FormatLongOutput)
+{
+    String longString(1000, 'x');
+    String formatted = Format("<{0}>", longString);
+
+    ASSERT_EQ(formatted.Size(), 1002u);
+    EXPECT_EQ(formatted[0], '<');
+    EXPECT_EQ(formatted[500], 'x');
+    EXPECT_EQ(formatted[1001], '>');
+}
+
+TEST(FormatTests, FormatLongOutputOnce)
+{
+    B::FormatCount = 0;
+    String formatted = Format("{0}{1}", String(300, 'a'), B());
+
+    EXPECT_EQ(B::FormatCount, 1);
+    ASSERT_EQ(formatted.Size(), 900u);
+    EXPECT_EQ(formatted[299], 'a');
+    EXPECT_EQ(formatted[300], 'b');
+    EXPECT_EQ(formatted[899], 'b');
+}
+
+TEST(FormatTests, RuntimeFormat)
+{
+    String fmt = "{1}, {0}";
+    EXPECT_GENERAL_STREQ(Format(RuntimeFormat(fmt), "World!", "Hello").Raw(), "Hello, World!");
+
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{0"), 1)), FormatException);
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{0} }"), 1)), FormatException);
+    EXPECT_THROW(KITSUNE_UNUSED(Format(RuntimeFormat("{1}"), 1)), OutOfRangeException);
+}
+
+TEST(FormatTests, FormatStringSegments)
+{
+    constexpr FormatString<int, int> fmt = "a{0}bc{1:x}";
+
+    ASSERT_EQ(fmt.GetSegmentCount(), 2);
+    EXPECT_EQ(fmt.GetSegments()[0].LiteralSize, 1);
+    EXPECT_EQ(fmt.GetSegments()[0].Argument, 0);
+
+    EXPECT_EQ(fmt.GetSegments()[1].LiteralSize, 2);
+    EXPECT_EQ(fmt.GetSegments()[1].Argument, 1);
+    EXPECT_EQ(fmt.GetSegments()[1].SpecsSize, 1);
+
+    EXPECT_FALSE(fmt.IsRuntime());
+}
+
+TEST(FormatTests, FormatStringEscapes)
+{
+    constexpr FormatString<int> fmt = "{{a}} {0} }}{{";
+
+    ASSERT_EQ(fmt.GetSegmentCount(), 2);
+    EXPECT_TRUE(fmt.GetSegments()[0].Escaped);
+    EXPECT_TRUE(fmt.GetSegments()[1].Escaped);
+
+    EXPECT_GENERAL_STREQ(Format(fmt, 1).Raw(), "{a} 1 }{");
+    EXPECT_GENERAL_STREQ(Format("JSON: {{\"a\": {{}}, \"b\": {{}}}}").Raw(), "JSON: {\"a\": {}, \"b\": {}}");
+}
+
+TEST(FormatTests, FormatStringRepeatedFields)
+{
+    constexpr FormatString<int> fmt = "{0}{0}{0}{0}{0}{0}{0}{0}";
+    EXPECT_TRUE(fmt.IsRuntime());
+
+    EXPECT_GENERAL_STREQ(Format(fmt, 1).Raw(), "11111111");
+    EXPECT_GENERAL_STREQ(Format("{0}-{1}-{0}-{1}-{0}-{1}", 'a', 'b').Raw(), "a-b-a-b-a-b");
+}
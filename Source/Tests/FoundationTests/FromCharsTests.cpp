@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include "Foundation/String/FromChars.h"
+#include "Foundation/String/ToChars.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <charconv>
+
+using namespace Kitsune;
+
+TEST(FromCharsTests, ParseInt)
+{
+    EXPECT_EQ(ParseInt<Int32>("0").Value, 0);
+    EXPECT_EQ(ParseInt<Int32>("42").Value, 42);
+    EXPECT_EQ(ParseInt<Int32>("-42").Value, -42);
+    EXPECT_EQ(ParseInt<Int32>("+42").Value, 42);
+    EXPECT_EQ(ParseInt<Uint64>("00000000000000000000000123").Value, 123);
+    EXPECT_EQ(ParseInt<Uint64>("1234567890123456").Value, 1234567890123456ull);
+
+    auto result = ParseInt<Int32>("123abc");
+    EXPECT_TRUE(result.IsValid());
+    EXPECT_EQ(result.Value, 123);
+    EXPECT_EQ(result.Count, 3);
+}
+
+TEST(FromCharsTests, ParseIntLimits)
+{
+    EXPECT_EQ(ParseInt<Int8>("127").Value, 127);
+    EXPECT_EQ(ParseInt<Int8>("-128").Value, -128);
+    EXPECT_EQ(ParseInt<Int64>("-9223372036854775808").Value, std::numeric_limits<Int64>::min());
+    EXPECT_EQ(ParseInt<Uint64>("18446744073709551615").Value, std::numeric_limits<Uint64>::max());
+
+    EXPECT_EQ(ParseInt<Int8>("128").Error, ParseError::OutOfRange);
+    EXPECT_EQ(ParseInt<Int8>("-129").Error, ParseError::OutOfRange);
+    EXPECT_EQ(ParseInt<Uint64>("18446744073709551616").Error, ParseError::OutOfRange);
+
+    // Every digit is still part of the number.
+    auto result = ParseInt<Int32>("123456789012345678901234567890 rest");
+    EXPECT_EQ(result.Error, ParseError::OutOfRange);
+    EXPECT_EQ(result.Count, 30);
+}
+
+TEST(FromCharsTests, ParseIntInvalid)
+{
+    EXPECT_EQ(ParseInt<Int32>("").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseInt<Int32>("-").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseInt<Int32>(" 1").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseInt<Int32>("x1").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseInt<Uint32>("-1").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseInt<Int32>("1", 37).Error, ParseError::InvalidArgument);
+
+    EXPECT_FALSE(ParseInt<Int32>("--1"));
+    EXPECT_EQ(ParseInt<Int32>("").Count, 0);
+}
+
+TEST(FromCharsTests, ParseIntBases)
+{
+    EXPECT_EQ(ParseInt<Uint32>("ff", 16).Value, 255);
+    EXPECT_EQ(ParseInt<Uint32>("FF", 16).Value, 255);
+    EXPECT_EQ(ParseInt<Int32>("-101", 2).Value, -5);
+    EXPECT_EQ(ParseInt<Int32>("777", 8).Value, 511);
+    EXPECT_EQ(ParseInt<Int32>("zz", 36).Value, 1295);
+    EXPECT_EQ(ParseInt<Uint64>("ffffffffffffffff", 16).Value, std::numeric_limits<Uint64>::max());
+
+    EXPECT_EQ(ParseInt<Uint64>("10000000000000000", 16).Error, ParseError::OutOfRange);
+    EXPECT_EQ(ParseInt<Int32>("12", 2).Count, 1);
+}
+
+TEST(FromCharsTests, ParseIntRoundTrip)
+{
+    std::mt19937_64 random(1234);
+    char buffer[MaxIntegerChars<Int64>];
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        Int64 value = static_cast<Int64>(random()) >> (random() % 64);
+        char* end = IntegerToChars(buffer, value);
+
+        auto result = ParseInt<Int64>(StringView(buffer, end));
+        EXPECT_EQ(result.Value, value);
+        EXPECT_EQ(result.Count, static_cast<Usize>(end - buffer));
+    }
+}
+
+TEST(FromCharsTests, ParseFloat)
+{
+    EXPECT_EQ(ParseFloat<double>("0").Value, 0.0);
+    EXPECT_EQ(ParseFloat<double>("1.5").Value, 1.5);
+    EXPECT_EQ(ParseFloat<double>("-12.5e-1").Value, -1.25);
+    EXPECT_EQ(ParseFloat<double>("+.5").Value, 0.5);
+    EXPECT_EQ(ParseFloat<double>("5.").Value, 5.0);
+    EXPECT_EQ(ParseFloat<double>("1E3").Value, 1000.0);
+    EXPECT_EQ(ParseFloat<double>("0.1").Value, 0.1);
+    EXPECT_EQ(ParseFloat<float>("0.1").Value, 0.1f);
+    EXPECT_EQ(ParseFloat<double>("123456789012345678901234567890").Value, 123456789012345678901234567890.0);
+
+    EXPECT_TRUE(std::signbit(ParseFloat<double>("-0").Value));
+
+    // The exponent only counts if it has digits.
+    auto result = ParseFloat<double>("2e+x");
+    EXPECT_EQ(result.Value, 2.0);
+    EXPECT_EQ(result.Count, 1);
+}
+
+TEST(FromCharsTests, ParseFloatRounding)
+{
+    // Halfway between two doubles, rounds to the even one.
+    EXPECT_EQ(ParseFloat<double>("9007199254740993").Value, 9007199254740992.0);
+    EXPECT_EQ(ParseFloat<double>("9007199254740993.0000000000000000000000001").Value, 9007199254740994.0);
+
+    EXPECT_EQ(ParseFloat<double>("2.2250738585072011e-308").Value, 2.2250738585072009e-308);
+    EXPECT_EQ(ParseFloat<double>("4.9406564584124654e-324").Value, std::numeric_limits<double>::denorm_min());
+    EXPECT_EQ(ParseFloat<double>("1.7976931348623157e308").Value, std::numeric_limits<double>::max());
+    EXPECT_EQ(ParseFloat<float>("3.4028235e38").Value, std::numeric_limits<float>::max());
+}
+
+TEST(FromCharsTests, ParseFloatSpecialValues)
+{
+    EXPECT_EQ(ParseFloat<double>("inf").Value, std::numeric_limits<double>::infinity());
+    EXPECT_EQ(ParseFloat<double>("-Infinity").Value, -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(ParseFloat<double>("INFINITE").Count, 3);
+    EXPECT_TRUE(std::isnan(ParseFloat<double>("NaN").Value));
+    EXPECT_TRUE(std::isnan(ParseFloat<float>("nan").Value));
+}
+
+TEST(FromCharsTests, ParseFloatErrors)
+{
+    EXPECT_EQ(ParseFloat<double>("").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseFloat<double>(".").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseFloat<double>("-").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseFloat<double>("e5").Error, ParseError::InvalidArgument);
+    EXPECT_EQ(ParseFloat<double>("in").Error, ParseError::InvalidArgument);
+
+    auto overflow = ParseFloat<double>("1e309");
+    EXPECT_EQ(overflow.Error, ParseError::OutOfRange);
+    EXPECT_EQ(overflow.Value, std::numeric_limits<double>::infinity());
+    EXPECT_EQ(overflow.Count, 5);
+
+    EXPECT_EQ(ParseFloat<float>("1e39").Error, ParseError::OutOfRange);
+    EXPECT_EQ(ParseFloat<double>("1e-400").Error, ParseError::OutOfRange);
+    EXPECT_EQ(ParseFloat<double>("0e-400").Error, ParseError::None);
+}
+
+TEST(FromCharsTests, ParseFloatMatchesStandardLibrary)
+{
+    std::mt19937_64 random(5678);
+    char buffer[64];
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        // Random digits, a random amount of them and anywhere in the exponent range.
+        Usize size = random() % 25 + 1;
+        for (Usize j = 0; j < size; ++j)
+            buffer[j] = static_cast<char>('0' + random() % 10);
+
+        buffer[size++] = 'e';
+        char* end = IntegerToChars(buffer + size, static_cast<Int32>(random() % 700) - 350);
+
+        double expected = 0.0;
+        auto [ptr, error] = std::from_chars(buffer, end, expected);
+
+        auto result = ParseFloat<double>(StringView(buffer, end));
+        EXPECT_EQ(result.Count, static_cast<Usize>(ptr - buffer));
+
+        if (error == std::errc())
+        {
+            EXPECT_EQ(result.Value, expected);
+        }
+    }
+}
+
+TEST(FromCharsTests, FloatRoundTrip)
+{
+    std::mt19937_64 random(91011);
+    char buffer[MaxFloatChars];
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        double value = std::bit_cast<double>(random());
+        if (!std::isfinite(value))
+            continue;
+
+        char* end = FloatToChars(buffer, value);
+        EXPECT_EQ(ParseFloat<double>(StringView(buffer, end)).Value, value);
+
+        float single = std::bit_cast<float>(static_cast<Uint32>(random()));
+        if (!std::isfinite(single))
+            continue;
+
+        end = FloatToChars(buffer, single);
+        EXPECT_EQ(ParseFloat<float>(StringView(buffer, end)).Value, single);
+    }
+}
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+#include <cstring>
+
+#include "Foundation/Memory/LinearAllocator.h"
+#include "Foundation/Containers/Array.h"
+#include "Foundation/String/String.h"
+
+#include "CompareStrings.h"
+
+using namespace Kitsune;
+
+TEST(LinearArenaTests, BumpAllocation)
+{
+    LinearArena arena(1024);
+
+    Uint8* ptr1 = (Uint8*)arena.Allocate(16);
+    Uint8* ptr2 = (Uint8*)arena.Allocate(16);
+
+    EXPECT_EQ(ptr1 + 16, ptr2);
+}
+
+TEST(LinearArenaTests, Alignment)
+{
+    LinearArena arena(1024);
+
+    KITSUNE_UNUSED(arena.Allocate(1, 1));
+    void* ptr = arena.Allocate(8, 64);
+
+    EXPECT_EQ((Uintptr)ptr % 64, 0);
+    EXPECT_EQ((Uintptr)arena.Allocate(3) % LinearArena::s_DefaultAlignment, 0);
+}
+
+TEST(LinearArenaTests, ExternalBuffer)
+{
+    alignas(16) Uint8 buffer[64];
+    LinearArena arena(buffer, sizeof(buffer));
+
+    EXPECT_EQ(arena.Allocate(32), buffer);
+    EXPECT_EQ(arena.Allocate(32), buffer + 32);
+
+    // Out of room, has to come from the heap.
+    Uint8* heap = (Uint8*)arena.Allocate(32);
+    EXPECT_TRUE(heap < buffer || heap >= buffer + sizeof(buffer));
+
+    arena.Reset();
+    EXPECT_EQ(arena.Allocate(16), buffer);
+}
+
+TEST(LinearArenaTests, ChainsBlocks)
+{
+    LinearArena arena(256);
+
+    Uint8* small = (Uint8*)arena.Allocate(200);
+    std::memset(small, 0x11, 200);
+
+    Uint8* large = (Uint8*)arena.Allocate(4096);
+    std::memset(large, 0xAA, 4096);
+
+    EXPECT_EQ(small[0], 0x11);
+    EXPECT_EQ(small[199], 0x11);
+}
+
+TEST(LinearArenaTests, FreeLastAllocation)
+{
+    LinearArena arena(1024);
+
+    void* ptr1 = arena.Allocate(16);
+    void* ptr2 = arena.Allocate(16);
+
+    arena.Free(ptr1);                       // Not the last one, stays in use.
+    EXPECT_NE(arena.Allocate(16), ptr1);
+
+    LinearArena arena2(1024);
+
+    ptr1 = arena2.Allocate(16);
+    ptr2 = arena2.Allocate(16);
+
+    arena2.Free(ptr2);
+    EXPECT_EQ(arena2.Allocate(16), ptr2);
+    KITSUNE_UNUSED(ptr1);
+}
+
+TEST(LinearArenaTests, TryExpandLastAllocation)
+{
+    LinearArena arena(1024);
+
+    void* ptr1 = arena.Allocate(16);
+    void* ptr2 = arena.Allocate(16);
+
+    EXPECT_FALSE(arena.TryExpand(ptr1, 32));
+    EXPECT_TRUE(arena.TryExpand(ptr2, 256));
+    EXPECT_FALSE(arena.TryExpand(ptr2, 4096));
+
+    EXPECT_EQ((Uint8*)arena.Allocate(16, 1), (Uint8*)ptr2 + 256);
+}
+
+TEST(LinearArenaTests, MarkerRewind)
+{
+    LinearArena arena(128);
+
+    void* before = arena.Allocate(16);
+    LinearArena::Marker marker = arena.GetMarker();
+
+    void* inside = arena.Allocate(16);
+    for (int i = 0; i < 16; ++i)
+        KITSUNE_UNUSED(arena.Allocate(64));     // Spill into a few more blocks.
+
+    arena.Rewind(marker);
+
+    EXPECT_EQ(arena.Allocate(16), inside);
+    EXPECT_NE(before, inside);
+}
+
+TEST(LinearArenaTests, ResetReusesMemory)
+{
+    LinearArena arena(1024);
+
+    void* first = arena.Allocate(100);
+    KITSUNE_UNUSED(arena.Allocate(200));
+
+    arena.Reset();
+    EXPECT_EQ(arena.Allocate(100), first);
+}
+
+TEST(LinearArenaTests, ResetGrowsBlockSize)
+{
+    LinearArena arena(128);
+
+    for (int i = 0; i < 8; ++i)
+        KITSUNE_UNUSED(arena.Allocate(100));
+
+    arena.Reset();
+    EXPECT_GE(arena.GetBlockSize(), 800u);
+}
+
+TEST(LinearAllocatorTests, Equality)
+{
+    LinearArena arena1;
+    LinearArena arena2;
+
+    LinearAllocator alloc1(arena1);
+    LinearAllocator alloc2(arena2);
+
+    EXPECT_TRUE(alloc1 == LinearAllocator(arena1));
+    EXPECT_TRUE(alloc1 != alloc2);
+    EXPECT_TRUE(LinearAllocator() == LinearAllocator());
+    EXPECT_TRUE(LinearAllocator() != alloc1);
+}
+
+TEST(LinearAllocatorTests, DefaultForwardsToMemory)
+{
+    LinearAllocator alloc;
+
+    void* ptr = alloc.Allocate(64);
+    ASSERT_NE(ptr, nullptr);
+
+    alloc.Free(ptr);
+}
+
+TEST(LinearAllocatorTests, Array)
+{
+    LinearArena arena;
+    Array<int, LinearAllocator> array{ LinearAllocator(arena) };
+
+    for (int i = 0; i < 100; ++i)
+        array.PushBack(i);
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(array[i], i);
+
+    EXPECT_EQ(array.GetAllocator().GetArena(), &arena);
+}
+
+TEST(LinearAllocatorTests, ArrayGrowsInPlace)
+{
+    LinearArena arena;
+    Array<int, LinearAllocator> array{ LinearAllocator(arena) };
+
+    array.PushBack(0);
+    const int* data = array.Data();
+
+    for (int i = 1; i < 1000; ++i)
+        array.PushBack(i);
+
+    EXPECT_EQ(array.Data(), data);
+    EXPECT_EQ(array[999], 999);
+}
+
+TEST(LinearAllocatorTests, ArrayAssignDifferentArena)
+{
+    LinearArena arena1;
+    LinearArena arena2;
+
+    Array<int, LinearAllocator> array1({ 1, 2, 3 }, LinearAllocator(arena1));
+    Array<int, LinearAllocator> array2({ 4, 5 }, LinearAllocator(arena2));
+
+    array2 = array1;
+
+    EXPECT_EQ(array2.GetAllocator().GetArena(), &arena1);
+    EXPECT_EQ(array2, array1);
+}
+
+TEST(LinearAllocatorTests, String)
+{
+    LinearArena arena;
+    BasicString<char, LinearAllocator> string{ LinearAllocator(arena) };
+
+    string = "A string long enough to not fit in the small buffer.";
+    string.Append(" And a bit more.");
+
+    EXPECT_GENERAL_STREQ(string.Data(),
+        "A string long enough to not fit in the small buffer. And a bit more.");
+}
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <cstdlib>
+
 #include "Foundation/Memory/Memory.h"
 
 namespace MemoryTesting
@@ -48,3 +50,47 @@ TEST(MemoryTests, NewAlignment)
 
     EXPECT_EQ((Uintptr)ptr % alignof(B), 0);
 }
+
+TEST(MemoryTests, TryReallocate)
+{
+    Uint8* ptr = (Uint8*)Memory::Allocate(100);
+    for (int i = 0; i < 100; ++i)
+        ptr[i] = (Uint8)i;
+
+    Uint8* grown = (Uint8*)Memory::TryReallocate(ptr, 1 << 20, Memory::GetDefaultAlignment());
+    if (grown == nullptr)
+        return Memory::Free(ptr);       // Not supported by the backend.
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(grown[i], (Uint8)i);
+
+    grown[(1 << 20) - 1] = 117;
+    Memory::Free(grown);
+}
+
+TEST(MemoryTests, TryExpandNullptr)
+{
+    EXPECT_FALSE(Memory::TryExpand(nullptr, 100));
+}
+
+TEST(MemoryTests, FreeAfterTrackedShutdown)
+{
+    // Replaces the memory subsystem for good, so it runs in a process of its own.
+    EXPECT_EXIT({
+        Memory::Shutdown();
+        Memory::InitializeExplicit(MemoryBackend::CMalloc, MemoryTracking::Statistics);
+
+        // Over-aligned and large, so the C runtime notices if it gets handed the user pointer.
+        void* ptr = Memory::Allocate(1 << 20, 4096);
+        Memory::Shutdown();
+
+        if (Memory::GetTracker() != nullptr)
+            std::_Exit(1);
+
+        Memory::Free(ptr);
+        Memory::Free(Memory::Allocate(64));
+
+        // Skips static destructors, they'd free blocks from before the tracker through it.
+        std::_Exit(0);
+    }, ::testing::ExitedWithCode(0), "");
+}
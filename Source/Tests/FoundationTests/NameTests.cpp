@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include "CompareStrings.h"
+#include "Foundation/String/Name.h"
+#include "Foundation/String/String.h"
+#include "Foundation/String/Format.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Kitsune;
+
+TEST(NameTests, DefaultCtor)
+{
+    Name name;
+
+    EXPECT_TRUE(name.IsEmpty());
+    EXPECT_EQ(name.Size(), 0);
+    EXPECT_GENERAL_STREQ(name.Data(), "");
+    EXPECT_EQ(name.GetHash(), Internal::HashName("", 0));
+
+    EXPECT_EQ(name, Name(""));
+}
+
+TEST(NameTests, SameStringSameName)
+{
+    String string = "Renderer";
+    Name name1("Renderer");
+    Name name2{ StringView(string) };
+
+    EXPECT_EQ(name1, name2);
+    EXPECT_EQ(name1.Data(), name2.Data());
+    EXPECT_EQ(name1.GetHash(), Internal::HashName(string.Data(), string.Size()));
+
+    EXPECT_NE(name1, Name("Render"));
+    EXPECT_NE(name1, Name("Renderer2"));
+}
+
+TEST(NameTests, CompareWithString)
+{
+    Name name("Scene.Root");
+
+    EXPECT_TRUE(name == "Scene.Root");
+    EXPECT_TRUE("Scene.Root" == name);
+    EXPECT_TRUE(name != "Scene");
+    EXPECT_TRUE(name == StringView("Scene.Root.Child", 10));
+
+    EXPECT_TRUE(Name() == "");
+    EXPECT_FALSE(Name() == "Scene.Root");
+}
+
+TEST(NameTests, Characters)
+{
+    Name name{ StringView("Audio.Mixer", 5) };
+
+    EXPECT_EQ(name.Size(), 5);
+    EXPECT_GENERAL_STREQ(name.Data(), "Audio");
+    EXPECT_TRUE(name.ToStringView() == "Audio");
+    EXPECT_EQ(Format("[{0}]", name), String("[Audio]"));
+}
+
+TEST(NameTests, EmbeddedZeros)
+{
+    const char str[] = "ab\0cd\0";
+
+    Name name1{ StringView(str, 3) };
+    Name name2{ StringView(str, 6) };
+
+    EXPECT_NE(name1, name2);
+    EXPECT_EQ(name1, Name(StringView(str, 3)));
+    EXPECT_EQ(name2.Size(), 6);
+}
+
+TEST(NameTests, ManyNames)
+{
+    // Enough to grow every shard's slots a couple of times.
+    std::vector<Name> names;
+    for (int i = 0; i < 20000; ++i)
+        names.push_back(Name(("Name" + std::to_string(i)).c_str()));
+
+    // Long enough to not fit in an arena block.
+    std::string large(40000, 'x');
+    Name largeName(large.c_str());
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        std::string str = "Name" + std::to_string(i);
+
+        EXPECT_EQ(names[i], Name(str.c_str()));
+        EXPECT_GENERAL_STREQ(names[i].Data(), str.c_str());
+    }
+
+    EXPECT_EQ(largeName, Name(large.c_str()));
+    EXPECT_EQ(largeName.Size(), large.size());
+}
+
+TEST(NameTests, ConcurrentInterning)
+{
+    constexpr int threadCount = 4;
+    constexpr int nameCount = 5000;
+
+    std::vector<std::vector<Name>> names(threadCount);
+    std::vector<std::thread> threads;
+
+    // All threads race to add the same strings, every one of them has to end up with the
+    // same entries.
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&names, t]() {
+            for (int i = 0; i < nameCount; ++i)
+            {
+                int index = (t % 2 == 0) ? i : nameCount - 1 - i;
+                names[t].push_back(Name(("Concurrent" + std::to_string(index)).c_str()));
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (int t = 1; t < threadCount; ++t)
+    {
+        for (int i = 0; i < nameCount; ++i)
+        {
+            int index = (t % 2 == 0) ? i : nameCount - 1 - i;
+            EXPECT_EQ(names[t][i], names[0][index]);
+        }
+    }
+}
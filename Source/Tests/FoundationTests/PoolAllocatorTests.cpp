@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include "Foundation/Memory/PoolAllocator.h"
+#include "Foundation/Memory/SharedPtr.h"
+#include "Foundation/Containers/Array.h"
+#include "Foundation/Diagnostics/InvalidArgumentException.h"
+
+using namespace Kitsune;
+
+TEST(MemoryPoolTests, BlockLayout)
+{
+    EXPECT_EQ((MemoryPool<1, 1>::s_BlockSize), sizeof(void*));
+    EXPECT_EQ((MemoryPool<24, 16>::s_BlockSize), 32u);
+    EXPECT_EQ((MemoryPool<64, 64>::s_BlockAlignment), 64u);
+}
+
+TEST(MemoryPoolTests, Alignment)
+{
+    MemoryPool<40, 64> pool;
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ((Uintptr)pool.Allocate() % 64, 0);
+}
+
+TEST(MemoryPoolTests, ReusesFreedBlocks)
+{
+    MemoryPool<32> pool;
+
+    void* ptr1 = pool.Allocate();
+    void* ptr2 = pool.Allocate();
+
+    pool.Free(ptr1);
+    pool.Free(ptr2);
+
+    // Last in, first out.
+    EXPECT_EQ(pool.Allocate(), ptr2);
+    EXPECT_EQ(pool.Allocate(), ptr1);
+}
+
+TEST(MemoryPoolTests, FreeNullptr)
+{
+    MemoryPool<32> pool;
+    pool.Free(nullptr);
+}
+
+TEST(MemoryPoolTests, DistinctBlocks)
+{
+    MemoryPool<24> pool(4);
+    std::vector<Uint8*> blocks;
+
+    // Enough to go through a few chunks.
+    for (int i = 0; i < 5000; ++i)
+    {
+        Uint8* ptr = (Uint8*)pool.Allocate();
+        std::memset(ptr, i & 0xFF, 24);
+
+        blocks.push_back(ptr);
+    }
+
+    EXPECT_EQ(std::set<Uint8*>(blocks.begin(), blocks.end()).size(), blocks.size());
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        EXPECT_EQ(blocks[i][0], i & 0xFF);
+        EXPECT_EQ(blocks[i][23], i & 0xFF);
+
+        pool.Free(blocks[i]);
+    }
+}
+
+TEST(MemoryPoolTests, ConcurrentAllocations)
+{
+    MemoryPool<48, 16, ThreadSafety::ThreadSafe> pool;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&pool, t]() {
+            std::vector<Uint8*> live;
+
+            for (int i = 0; i < 20000; ++i)
+            {
+                Uint8* ptr = (Uint8*)pool.Allocate();
+                std::memset(ptr, t, 48);
+
+                live.push_back(ptr);
+                if (live.size() > 32)
+                {
+                    EXPECT_EQ(live.front()[47], (Uint8)t);
+
+                    pool.Free(live.front());
+                    live.erase(live.begin());
+                }
+            }
+
+            for (Uint8* ptr : live)
+                pool.Free(ptr);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+TEST(PoolAllocatorTests, Equality)
+{
+    EXPECT_TRUE(PoolAllocator<16>() == PoolAllocator<16>());
+    EXPECT_FALSE(PoolAllocator<16>() != PoolAllocator<16>());
+}
+
+TEST(PoolAllocatorTests, SharedPool)
+{
+    PoolAllocator<56> alloc1;
+    PoolAllocator<56> alloc2;
+
+    void* ptr = alloc1.Allocate(56);
+    alloc2.Free(ptr);
+
+    EXPECT_EQ(alloc2.Allocate(40), ptr);
+    alloc1.Free(ptr);
+}
+
+TEST(PoolAllocatorTests, TooLarge)
+{
+    PoolAllocator<16, 8> alloc;
+
+    EXPECT_THROW(KITSUNE_UNUSED(alloc.Allocate(17)), InvalidArgumentException);
+    EXPECT_THROW(KITSUNE_UNUSED(alloc.Allocate(8, 16)), InvalidArgumentException);
+}
+
+TEST(PoolAllocatorTests, Array)
+{
+    Array<int, PoolAllocator<64 * sizeof(int)>> array;
+    array.Reserve(64);
+
+    for (int i = 0; i < 64; ++i)
+        array.PushBack(i);
+
+    for (int i = 0; i < 64; ++i)
+        EXPECT_EQ(array[i], i);
+}
+
+TEST(PoolAllocatorTests, CrossThread)
+{
+    std::vector<void*> blocks(1000);
+
+    std::thread producer([&]() {
+        PoolAllocator<32> alloc;
+        for (void*& ptr : blocks)
+            ptr = alloc.Allocate(32);
+    });
+
+    producer.join();
+
+    std::thread consumer([&]() {
+        PoolAllocator<32> alloc;
+        for (void* ptr : blocks)
+            alloc.Free(ptr);
+    });
+
+    consumer.join();
+}
+
+TEST(PoolAllocatorTests, SharedPtrControlBlock)
+{
+    int destroyed = 0;
+
+    struct D
+    {
+        int* Counter;
+        ~D() { ++*Counter; }
+    };
+
+    WeakPtr<D> weak;
+    {
+        SharedPtr<D> ptr1(Memory::New<D>(&destroyed));
+        SharedPtr<D> ptr2 = ptr1;
+
+        weak = ptr1;
+    }
+
+    EXPECT_TRUE(weak.IsExpired());
+    EXPECT_EQ(destroyed, 1);
+}
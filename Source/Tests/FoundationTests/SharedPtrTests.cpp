@@ -148,6 +148,29 @@ namespace SharedPtrTesting
     class C : public B
     {
     };
+
+    class D
+    {
+    public:
+        D(bool* destroyed, int value = 0)
+            : Value(value), m_Destroyed(destroyed)
+        {
+        }
+
+        ~D() { *m_Destroyed = true; }
+
+    public:
+        int Value;
+
+    private:
+        bool* m_Destroyed;
+    };
+
+    class Throwing
+    {
+    public:
+        Throwing() { throw 0; }
+    };
 }
 
 using namespace Kitsune;
@@ -701,6 +724,79 @@ TEST(SharedPtrTests, Comparison)
     EXPECT_FALSE(larger != larger);
 }
 
+TEST(SharedPtrTests, MakeShared)
+{
+    bool destroyed = false;
+
+    {
+        SharedPtr<D> ptr = MakeShared<D>(&destroyed, 10);
+        SharedPtr<D> copy = ptr;
+
+        EXPECT_EQ(ptr->Value, 10);
+        EXPECT_EQ(ptr.GetCount(), 2);
+        EXPECT_FALSE(destroyed);
+    }
+
+    EXPECT_TRUE(destroyed);
+}
+
+TEST(SharedPtrTests, MakeSharedConvertible)
+{
+    SharedPtr<B> ptr = MakeShared<C>();
+    EXPECT_NE(ptr.Get(), nullptr);
+}
+
+TEST(SharedPtrTests, AllocateShared)
+{
+    bool destroyed = false;
+    void *allocated = nullptr, *freed = nullptr;
+
+    {
+        A alloc = A(&allocated, &freed);
+        SharedPtr<D> ptr = AllocateShared<D>(alloc, &destroyed, 5);
+
+        EXPECT_EQ(ptr->Value, 5);
+        EXPECT_FALSE(alloc.Moved);
+
+        // The value is stored inside the only allocation made.
+        EXPECT_NE(allocated, nullptr);
+        EXPECT_GT((void*)ptr.Get(), allocated);
+        EXPECT_LT((void*)ptr.Get(), (char*)allocated + 64);
+    }
+
+    EXPECT_TRUE(destroyed);
+    EXPECT_EQ(allocated, freed);
+}
+
+TEST(SharedPtrTests, AllocateSharedWeakOutlivesValue)
+{
+    bool destroyed = false;
+    void *allocated = nullptr, *freed = nullptr;
+
+    WeakPtr<D> weak;
+
+    {
+        SharedPtr<D> ptr = AllocateShared<D>(A(&allocated, &freed), &destroyed);
+        weak = ptr;
+    }
+
+    EXPECT_TRUE(destroyed);
+    EXPECT_TRUE(weak.IsExpired());
+    EXPECT_EQ(freed, nullptr);
+
+    weak.Reset();
+    EXPECT_EQ(allocated, freed);
+}
+
+TEST(SharedPtrTests, AllocateSharedThrowingCtor)
+{
+    void *allocated = nullptr, *freed = nullptr;
+
+    EXPECT_ANY_THROW(AllocateShared<Throwing>(A(&allocated, &freed)));
+    EXPECT_NE(allocated, nullptr);
+    EXPECT_EQ(allocated, freed);
+}
+
 TEST(WeakPtrTests, DefaultCtor)
 {
     WeakPtr<int> ptr;
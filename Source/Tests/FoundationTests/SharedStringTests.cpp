@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include "CompareStrings.h"
+#include "Foundation/String/SharedString.h"
+#include "Foundation/String/Format.h"
+
+#include <thread>
+#include <vector>
+
+using namespace Kitsune;
+
+TEST(SharedStringTests, DefaultCtor)
+{
+    SharedString string;
+
+    EXPECT_TRUE(string.IsEmpty());
+    EXPECT_EQ(string.Size(), 0);
+    EXPECT_EQ(string.GetUseCount(), 0);
+    EXPECT_GENERAL_STREQ(string.Data(), "");
+    EXPECT_EQ(string.GetMutableData(), nullptr);
+}
+
+TEST(SharedStringTests, StringCtor)
+{
+    SharedString string1 = "Hello, World";
+    SharedString string2 = StringView("Hello, World", 5);
+    SharedString string3(String("Hello, World"));
+
+    EXPECT_EQ(string1.Size(), 12);
+    EXPECT_GENERAL_STREQ(string1.Data(), "Hello, World");
+    EXPECT_GENERAL_STREQ(string2.Data(), "Hello");
+    EXPECT_EQ(string1, string3);
+
+    EXPECT_EQ(string1.GetUseCount(), 1);
+    EXPECT_TRUE(string1.IsUnique());
+}
+
+TEST(SharedStringTests, CopiesShare)
+{
+    SharedString string1 = "Shared characters";
+    SharedString string2 = string1;
+
+    EXPECT_EQ(string1.Data(), string2.Data());
+    EXPECT_EQ(string1.GetUseCount(), 2);
+
+    {
+        SharedString string3;
+        string3 = string2;
+
+        EXPECT_EQ(string1.GetUseCount(), 3);
+    }
+
+    EXPECT_EQ(string1.GetUseCount(), 2);
+
+    SharedString string4 = Move(string2);
+    EXPECT_TRUE(string2.IsEmpty());
+    EXPECT_EQ(string4.Data(), string1.Data());
+    EXPECT_EQ(string1.GetUseCount(), 2);
+}
+
+TEST(SharedStringTests, Assign)
+{
+    SharedString string1 = "First";
+    SharedString string2 = string1;
+
+    string2 = "Second";
+    EXPECT_GENERAL_STREQ(string1.Data(), "First");
+    EXPECT_GENERAL_STREQ(string2.Data(), "Second");
+    EXPECT_TRUE(string1.IsUnique());
+
+    string2 = StringView("Third");
+    EXPECT_GENERAL_STREQ(string2.Data(), "Third");
+
+    string2 = string2;
+    EXPECT_GENERAL_STREQ(string2.Data(), "Third");
+}
+
+TEST(SharedStringTests, CopyOnWrite)
+{
+    SharedString string1 = "Hello";
+    SharedString string2 = string1;
+
+    string2.Append(", World");
+
+    EXPECT_GENERAL_STREQ(string1.Data(), "Hello");
+    EXPECT_GENERAL_STREQ(string2.Data(), "Hello, World");
+    EXPECT_TRUE(string1.IsUnique());
+    EXPECT_TRUE(string2.IsUnique());
+
+    SharedString string3 = string2;
+    string3.GetMutableData()[0] = 'J';
+
+    EXPECT_GENERAL_STREQ(string2.Data(), "Hello, World");
+    EXPECT_GENERAL_STREQ(string3.Data(), "Jello, World");
+}
+
+TEST(SharedStringTests, AppendInPlace)
+{
+    SharedString string = "a";
+    string.Append("bcdefgh");
+    string += 'i';
+
+    // Grew with room to spare, the next append goes into the same block.
+    const char* data = string.Data();
+    string += StringView("jk");
+
+    EXPECT_EQ(string.Data(), data);
+    EXPECT_GENERAL_STREQ(string.Data(), "abcdefghijk");
+
+    // Doesn't fit, the characters get copied from the block that's being replaced.
+    string.Append(string.ToStringView());
+    EXPECT_GENERAL_STREQ(string.Data(), "abcdefghijkabcdefghijk");
+}
+
+TEST(SharedStringTests, Clear)
+{
+    SharedString string1 = "Cleared";
+    SharedString string2 = string1;
+
+    string2.Clear();
+
+    EXPECT_TRUE(string2.IsEmpty());
+    EXPECT_GENERAL_STREQ(string1.Data(), "Cleared");
+    EXPECT_TRUE(string1.IsUnique());
+}
+
+TEST(SharedStringTests, Compare)
+{
+    SharedString string1 = "Equal";
+    SharedString string2 = "Equal";
+
+    EXPECT_EQ(string1, string2);
+    EXPECT_EQ(string1, "Equal");
+    EXPECT_EQ(string1, StringView("Equal"));
+    EXPECT_NE(string1, SharedString("Not equal"));
+    EXPECT_EQ(SharedString(), SharedString(""));
+}
+
+TEST(SharedStringTests, Views)
+{
+    SharedString string = "Viewed";
+
+    StringView view = string;
+    EXPECT_EQ(view.Data(), string.Data());
+    EXPECT_EQ(view.Size(), string.Size());
+
+    EXPECT_EQ(string.ToString(), String("Viewed"));
+    EXPECT_EQ(Format("[{0}]", string), String("[Viewed]"));
+
+    EXPECT_EQ(string[1], 'i');
+    EXPECT_THROW((void)string[6], OutOfRangeException);
+}
+
+TEST(SharedStringTests, ConcurrentCopies)
+{
+    SharedString string = "Copied from every thread";
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([string]() {
+            for (int i = 0; i < 10000; ++i)
+            {
+                SharedString copy = string;
+                EXPECT_EQ(copy.Size(), 24);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_TRUE(string.IsUnique());
+}
+
+TEST(SharedStringTests, Relocatable)
+{
+    EXPECT_TRUE(IsTriviallyRelocatable<SharedString>);
+    EXPECT_EQ(sizeof(SharedString), sizeof(void*));
+}
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include "Foundation/Containers/SmallArray.h"
+#include "Foundation/Memory/LinearAllocator.h"
+#include "Foundation/Memory/SharedPtr.h"
+#include "Foundation/String/String.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    template<typename T>
+    bool IsInside(const T* ptr, const void* object, Usize size)
+    {
+        auto* bytes = reinterpret_cast<const Uint8*>(ptr);
+        auto* begin = static_cast<const Uint8*>(object);
+
+        return (bytes >= begin) && (bytes < begin + size);
+    }
+}
+
+TEST(SmallArrayTests, DefaultConstructor)
+{
+    SmallArray<int, 4> array;
+
+    EXPECT_TRUE(array.IsEmpty());
+    EXPECT_TRUE(array.IsInline());
+    EXPECT_EQ(array.Capacity(), 4);
+    EXPECT_TRUE(IsInside(array.Data(), &array, sizeof(array)));
+}
+
+TEST(SmallArrayTests, StaysInline)
+{
+    LinearArena arena;
+    SmallArray<int, 4, LinearAllocator> array{ LinearAllocator(arena) };
+
+    for (int i = 0; i < 4; ++i)
+        array.PushBack(i);
+
+    EXPECT_TRUE(array.IsInline());
+    EXPECT_EQ(arena.GetMarker().Block, nullptr);          // Nothing was allocated.
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(array[i], i);
+}
+
+TEST(SmallArrayTests, Spills)
+{
+    SmallArray<int, 4> array;
+
+    for (int i = 0; i < 100; ++i)
+        array.PushBack(i);
+
+    EXPECT_FALSE(array.IsInline());
+    EXPECT_GE(array.Capacity(), 100);
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(array[i], i);
+}
+
+TEST(SmallArrayTests, CountConstructor)
+{
+    SmallArray<String, 2> small(2, "Hello");
+    SmallArray<String, 2> large(5, "Hello");
+
+    EXPECT_TRUE(small.IsInline());
+    EXPECT_FALSE(large.IsInline());
+
+    EXPECT_EQ(small.Size(), 2);
+    EXPECT_EQ(large.Size(), 5);
+    EXPECT_EQ(large[4], "Hello");
+}
+
+TEST(SmallArrayTests, InitializerList)
+{
+    SmallArray<int, 3> array = { 1, 2, 3 };
+    EXPECT_TRUE(array.IsInline());
+
+    array = { 4, 5, 6, 7 };
+    EXPECT_FALSE(array.IsInline());
+
+    EXPECT_EQ(array, (SmallArray<int, 8>{ 4, 5, 6, 7 }));
+}
+
+TEST(SmallArrayTests, CopyConstructor)
+{
+    SmallArray<String, 2> inlineArray = { "a", "b" };
+    SmallArray<String, 2> heapArray = { "a", "b", "c" };
+
+    SmallArray<String, 2> copy1(inlineArray);
+    SmallArray<String, 2> copy2(heapArray);
+
+    EXPECT_EQ(copy1, inlineArray);
+    EXPECT_EQ(copy2, heapArray);
+    EXPECT_NE(copy2.Data(), heapArray.Data());
+}
+
+TEST(SmallArrayTests, MoveInline)
+{
+    SharedPtr<int> ptr = MakeShared<int>(5);
+
+    SmallArray<SharedPtr<int>, 4> array1 = { ptr, ptr };
+    SmallArray<SharedPtr<int>, 4> array2(Move(array1));
+
+    EXPECT_TRUE(array1.IsEmpty());
+    EXPECT_TRUE(array2.IsInline());
+    EXPECT_EQ(array2.Size(), 2);
+    EXPECT_EQ(ptr.GetCount(), 3);
+}
+
+TEST(SmallArrayTests, MoveHeap)
+{
+    SmallArray<int, 2> array1 = { 1, 2, 3, 4 };
+    const int* data = array1.Data();
+
+    SmallArray<int, 2> array2(Move(array1));
+
+    EXPECT_EQ(array2.Data(), data);
+    EXPECT_TRUE(array1.IsEmpty());
+    EXPECT_TRUE(array1.IsInline());
+
+    array1.PushBack(5);
+    EXPECT_EQ(array1[0], 5);
+}
+
+TEST(SmallArrayTests, MoveAssignment)
+{
+    SmallArray<String, 2> array1 = { "a" };
+    SmallArray<String, 2> array2 = { "b", "c", "d" };
+
+    array2 = Move(array1);
+
+    ASSERT_EQ(array2.Size(), 1);
+    EXPECT_EQ(array2[0], "a");
+    EXPECT_TRUE(array2.IsInline());
+}
+
+TEST(SmallArrayTests, Swap)
+{
+    SmallArray<int, 2> inlineArray = { 1 };
+    SmallArray<int, 2> heapArray = { 2, 3, 4 };
+
+    inlineArray.Swap(heapArray);
+
+    EXPECT_EQ(inlineArray, (SmallArray<int, 2>{ 2, 3, 4 }));
+    EXPECT_EQ(heapArray, (SmallArray<int, 2>{ 1 }));
+
+    Algorithms::Swap(inlineArray, heapArray);
+    EXPECT_EQ(inlineArray, (SmallArray<int, 2>{ 1 }));
+}
+
+TEST(SmallArrayTests, InsertAndRemove)
+{
+    SmallArray<int, 4> array = { 1, 4 };
+
+    array.Insert(array.GetBegin() + 1, { 2, 3 });
+    EXPECT_TRUE(array.IsInline());
+
+    array.Insert(array.GetEnd(), 2, 5);
+    EXPECT_FALSE(array.IsInline());
+    EXPECT_EQ(array, (SmallArray<int, 6>{ 1, 2, 3, 4, 5, 5 }));
+
+    array.Remove(array.GetBegin(), array.GetBegin() + 2);
+    EXPECT_EQ(array, (SmallArray<int, 6>{ 3, 4, 5, 5 }));
+
+    EXPECT_THROW(array.Remove(array.GetEnd()), OutOfRangeException);
+}
+
+TEST(SmallArrayTests, ShrinkToFitMovesBackInline)
+{
+    SmallArray<String, 2> array = { "a", "b", "c" };
+
+    array.PopBack();
+    array.ShrinkToFit();
+
+    EXPECT_TRUE(array.IsInline());
+    EXPECT_EQ(array, (SmallArray<String, 2>{ "a", "b" }));
+}
+
+TEST(SmallArrayTests, ClearKeepsCapacity)
+{
+    SmallArray<int, 2> array = { 1, 2, 3 };
+    const int* data = array.GetBegin();
+    Usize capacity = array.Capacity();
+
+    array.Clear();
+
+    EXPECT_TRUE(array.IsEmpty());
+    EXPECT_FALSE(array.IsInline());
+    EXPECT_EQ(array.Capacity(), capacity);
+
+    array.PushBack(4);
+    EXPECT_EQ(array.GetBegin(), data);
+}
+
+TEST(SmallArrayTests, ShrinkToFitReturnsInline)
+{
+    SmallArray<int, 2> array = { 1, 2, 3 };
+
+    array.Clear();
+    array.ShrinkToFit();
+
+    EXPECT_TRUE(array.IsEmpty());
+    EXPECT_TRUE(array.IsInline());
+    EXPECT_EQ(array.Capacity(), 2);
+}
+
+TEST(SmallArrayTests, OutOfRange)
+{
+    SmallArray<int, 2> array;
+
+    EXPECT_THROW(KITSUNE_UNUSED(array.Front()), OutOfRangeException);
+    EXPECT_THROW(KITSUNE_UNUSED(array.Back()), OutOfRangeException);
+    EXPECT_THROW(KITSUNE_UNUSED(array[0]), OutOfRangeException);
+    EXPECT_THROW(array.PopBack(), OutOfRangeException);
+}
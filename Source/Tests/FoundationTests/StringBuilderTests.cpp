@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include "CompareStrings.h"
+#include "Foundation/String/StringBuilder.h"
+#include "Foundation/String/Format.h"
+#include "Foundation/Memory/LinearAllocator.h"
+
+#include <string>
+#include <vector>
+
+using namespace Kitsune;
+
+namespace
+{
+    class MyStream : public IWriteStream<char>
+    {
+    public:
+        void Write(const char* str, Usize size) override
+        {
+            Output.append(str, size);
+            ++WriteCount;
+        }
+
+    public:
+        std::string Output;
+        int WriteCount = 0;
+    };
+
+    struct AllocationFailed {};
+
+    // Throws once AllocationsLeft runs out.
+    class ThrowingAllocator
+    {
+    public:
+        void* Allocate(Usize size) { return Allocate(size, Memory::GetDefaultAlignment()); }
+        void* Allocate(Usize size, Usize align)
+        {
+            if (AllocationsLeft-- == 0)
+                throw AllocationFailed();
+
+            return Memory::Allocate(size, align);
+        }
+
+        void Free(void* ptr) { Memory::Free(ptr); }
+
+        friend bool operator==(const ThrowingAllocator&, const ThrowingAllocator&) = default;
+
+    public:
+        static inline int AllocationsLeft = 0;
+    };
+}
+
+TEST(StringBuilderTests, DefaultCtor)
+{
+    StringBuilder builder;
+
+    EXPECT_TRUE(builder.IsEmpty());
+    EXPECT_EQ(builder.Size(), 0);
+    EXPECT_EQ(builder.GetChunkCount(), 0);
+    EXPECT_EQ(builder.GetChunkSize(), StringBuilder::s_DefaultChunkSize);
+
+    EXPECT_TRUE(builder.ToString().IsEmpty());
+}
+
+TEST(StringBuilderTests, Append)
+{
+    StringBuilder builder;
+    builder.Append("Hello");
+    builder.PushBack(',');
+    builder.Append(StringView(" World"));
+    builder.Append(3, '!');
+    builder.Append(String(" :)"));
+
+    EXPECT_EQ(builder.Size(), 18);
+    EXPECT_EQ(builder.GetChunkCount(), 1);
+    EXPECT_EQ(builder.ToString(), String("Hello, World!!! :)"));
+}
+
+TEST(StringBuilderTests, SpansChunks)
+{
+    StringBuilder builder(8);
+    std::string expected;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        std::string str = std::to_string(i) + ", ";
+
+        builder.Append(str.c_str(), str.size());
+        expected += str;
+    }
+
+    EXPECT_EQ(builder.Size(), expected.size());
+    EXPECT_GT(builder.GetChunkCount(), 1);
+
+    String string = builder.ToString();
+    EXPECT_GENERAL_STREQ(string.Data(), expected.c_str());
+
+    std::string joined;
+    for (StringView chunk : builder.GetChunks())
+        joined.append(chunk.Data(), chunk.Size());
+
+    EXPECT_EQ(joined, expected);
+}
+
+TEST(StringBuilderTests, LargeAppend)
+{
+    StringBuilder builder(16);
+    builder.Append("abc");
+
+    // Fills the first chunk, everything else goes into a single one.
+    std::string large(1000, 'x');
+    builder.Append(large.c_str(), large.size());
+
+    EXPECT_EQ(builder.GetChunkCount(), 2);
+    EXPECT_EQ(builder.Size(), 1003);
+
+    std::vector<Usize> sizes;
+    for (StringView chunk : builder.GetChunks())
+        sizes.push_back(chunk.Size());
+
+    EXPECT_EQ(sizes, (std::vector<Usize>{ 16, 987 }));
+}
+
+TEST(StringBuilderTests, ChunksStayPut)
+{
+    StringBuilder builder(4);
+    builder.Append("abcd");
+
+    const char* first = (*builder.GetChunks().GetBegin()).Data();
+    builder.Append("efghijkl");
+
+    EXPECT_EQ((*builder.GetChunks().GetBegin()).Data(), first);
+    EXPECT_GENERAL_STREQ(builder.ToString().Data(), "abcdefghijkl");
+}
+
+TEST(StringBuilderTests, WriteTo)
+{
+    StringBuilder builder(4);
+    builder.Append("0123456789");
+
+    MyStream stream;
+    builder.WriteTo(stream);
+
+    EXPECT_EQ(stream.Output, "0123456789");
+    EXPECT_EQ(stream.WriteCount, builder.GetChunkCount());
+}
+
+TEST(StringBuilderTests, FormatTo)
+{
+    StringBuilder builder(8);
+    FormatTo(builder.GetAppendIterator(), "{0} + {1} = {2}, {3}", 12, 30, 42, "quite a long string");
+
+    EXPECT_EQ(builder.ToString(), String("12 + 30 = 42, quite a long string"));
+}
+
+TEST(StringBuilderTests, Clear)
+{
+    StringBuilder builder(4);
+    builder.Append("Hello, World");
+    builder.Clear();
+
+    EXPECT_TRUE(builder.IsEmpty());
+    EXPECT_EQ(builder.GetChunkCount(), 1);
+    EXPECT_TRUE(builder.ToString().IsEmpty());
+
+    builder.Append("Again");
+    EXPECT_EQ(builder.ToString(), String("Again"));
+}
+
+TEST(StringBuilderTests, Move)
+{
+    StringBuilder builder1(4);
+    builder1.Append("Hello, World");
+
+    StringBuilder builder2 = Move(builder1);
+    EXPECT_TRUE(builder1.IsEmpty());
+    EXPECT_EQ(builder1.GetChunkCount(), 0);
+    EXPECT_EQ(builder2.ToString(), String("Hello, World"));
+
+    StringBuilder builder3;
+    builder3.Append("Replaced");
+    builder3 = Move(builder2);
+
+    EXPECT_EQ(builder3.ToString(), String("Hello, World"));
+
+    builder1.Append("Reused");
+    EXPECT_EQ(builder1.ToString(), String("Reused"));
+}
+
+TEST(StringBuilderTests, ArenaBacked)
+{
+    LinearArena arena(1024);
+    BasicStringBuilder<char, LinearAllocator> builder(LinearAllocator(arena), 16);
+
+    builder.Append("Lives in the arena, ");
+    builder.Append("until it's reset.");
+
+    // Chunks are the only thing allocated so far, the arena's first block holds both.
+    const char* next = static_cast<const char*>(arena.Allocate(1));
+    for (StringView chunk : builder.GetChunks())
+        EXPECT_LT(chunk.Data(), next);
+
+    EXPECT_EQ(builder.ToString(), String("Lives in the arena, until it's reset."));
+    EXPECT_EQ(builder.ToString(LinearAllocator(arena)).GetAllocator(), LinearAllocator(arena));
+}
+
+TEST(StringBuilderTests, ThrowingAllocator)
+{
+    ThrowingAllocator::AllocationsLeft = 1;
+    BasicStringBuilder<char, ThrowingAllocator> builder(ThrowingAllocator(), 8);
+
+    builder.Append("Kitsune");
+    EXPECT_THROW(builder.Append("Engine, Core"), AllocationFailed);
+
+    // Neither the size nor the first chunk saw any of it.
+    EXPECT_EQ(builder.Size(), 7);
+    EXPECT_EQ(builder.GetChunkCount(), 1);
+    EXPECT_EQ(builder.ToString(), String("Kitsune"));
+
+    ThrowingAllocator::AllocationsLeft = 1;
+    builder.Append(" Engine");
+
+    EXPECT_EQ(builder.Size(), 14);
+    EXPECT_EQ(builder.ToString(), String("Kitsune Engine"));
+}
+
+TEST(StringBuilderTests, WideCharacters)
+{
+    U16StringBuilder builder(3);
+    builder.Append(u"Wide ");
+    builder.Append(u"characters");
+
+    EXPECT_EQ(builder.ToString(), U16String(u"Wide characters"));
+}
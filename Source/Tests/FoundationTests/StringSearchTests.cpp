@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include "CharKernelSets.h"
+#include "Foundation/String/StringSearch.h"
+
+#include <vector>
+#include <algorithm>
+
+using namespace Kitsune;
+
+namespace
+{
+    template<typename T>
+    const T* NaiveFindSubstring(const T* haystack, Usize size, const T* needle, Usize needleSize)
+    {
+        for (Usize i = 0; i + needleSize <= size; ++i)
+        {
+            Usize j = 0;
+            while (j < needleSize && haystack[i + j] == needle[j])
+                ++j;
+
+            if (j == needleSize)
+                return haystack + i;
+        }
+
+        return nullptr;
+    }
+
+    template<typename T>
+    const T* NaiveFindAny(const T* str, Usize size, const T* set, Usize setSize)
+    {
+        for (Usize i = 0; i < size; ++i)
+        {
+            for (Usize j = 0; j < setSize; ++j)
+            {
+                if (str[i] == set[j])
+                    return str + i;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Small alphabets so that partial matches are everywhere, with some characters that only
+    // differ from the others past their low byte.
+    template<typename T>
+    T MakeChar(Uint32 random)
+    {
+        Uint32 ch = 'a' + random % 4;
+
+        if (random % 7 == 0)
+            ch |= 0x80;
+
+        if constexpr (sizeof(T) > 1)
+        {
+            if (random % 5 == 0)
+                ch |= 0x100;
+        }
+
+        return static_cast<T>(ch);
+    }
+
+    template<typename T>
+    void TestFindSubstringAgainstReference()
+    {
+        Uint32 seed = 12345;
+        auto next = [&seed]() { seed = seed * 1103515245 + 12345; return (seed >> 8); };
+
+        for (int round = 0; round < 3000; ++round)
+        {
+            std::vector<T> haystack(next() % 300 + 1);
+            std::vector<T> needle(next() % ((round % 4 == 0) ? 100 : 40) + 1);
+
+            for (T& ch : haystack) ch = MakeChar<T>(next());
+            for (T& ch : needle)   ch = MakeChar<T>(next());
+
+            // Plant the needle half of the time, so that long ones get found too.
+            if (needle.size() <= haystack.size() && next() % 2 == 0)
+            {
+                Usize at = next() % (haystack.size() - needle.size() + 1);
+                std::copy(needle.begin(), needle.end(), haystack.begin() + static_cast<Ptrdiff>(at));
+            }
+
+            EXPECT_EQ(Internal::FindSubstring(haystack.data(), haystack.size(), needle.data(), needle.size()),
+                      NaiveFindSubstring(haystack.data(), haystack.size(), needle.data(), needle.size()));
+        }
+    }
+
+    template<typename T>
+    void TestFindAnyAgainstReference()
+    {
+        Uint32 seed = 54321;
+        auto next = [&seed]() { seed = seed * 1103515245 + 12345; return (seed >> 8); };
+
+        for (int round = 0; round < 3000; ++round)
+        {
+            std::vector<T> str(next() % 200 + 1);
+            std::vector<T> set(next() % 40 + 1);
+
+            for (T& ch : str) ch = static_cast<T>(MakeChar<T>(next()) + next() % 64);
+            for (T& ch : set) ch = static_cast<T>(MakeChar<T>(next()) + next() % 64);
+
+            EXPECT_EQ(Internal::FindAny(str.data(), str.size(), set.data(), set.size()),
+                      NaiveFindAny(str.data(), str.size(), set.data(), set.size()));
+        }
+    }
+}
+
+TEST(StringSearchTests, FindSubstring)
+{
+    const char haystack[] = "The quick brown fox jumps over the lazy dog, then the dog sleeps.";
+    Usize size = sizeof(haystack) - 1;
+
+    EXPECT_EQ(Internal::FindSubstring(haystack, size, "the", 3), haystack + 31);
+    EXPECT_EQ(Internal::FindSubstring(haystack, size, "dog", 3), haystack + 40);
+    EXPECT_EQ(Internal::FindSubstring(haystack, size, "sleeps.", 7), haystack + size - 7);
+    EXPECT_EQ(Internal::FindSubstring(haystack, size, "cat", 3), nullptr);
+
+    EXPECT_EQ(Internal::FindSubstring(haystack, size, "", 0), haystack);
+    EXPECT_EQ(Internal::FindSubstring(haystack, 3, "The quick", 9), nullptr);
+}
+
+TEST(StringSearchTests, FindLongSubstring)
+{
+    // Long enough to go through Two-Way rather than the filter.
+    const char haystack[] = "abababababababababababababababababababababababababababababababababababababababac";
+    const char needle[] = "abababababababababababababababababababac";
+
+    EXPECT_EQ(Internal::FindSubstring(haystack, sizeof(haystack) - 1, needle, sizeof(needle) - 1),
+              haystack + (sizeof(haystack) - sizeof(needle)));
+
+    EXPECT_EQ(Internal::FindSubstring(haystack, sizeof(haystack) - 2, needle, sizeof(needle) - 1), nullptr);
+}
+
+TEST(StringSearchTests, FindAny)
+{
+    const char str[] = "key = value # comment";
+    Usize size = sizeof(str) - 1;
+
+    EXPECT_EQ(Internal::FindAny(str, size, "=#", 2), str + 4);
+    EXPECT_EQ(Internal::FindAny(str, size, "#", 1), str + 12);
+    EXPECT_EQ(Internal::FindAny(str, size, "\r\n", 2), nullptr);
+    EXPECT_EQ(Internal::FindAny(str, size, "", 0), nullptr);
+}
+
+TEST(StringSearchTests, FindSubstringKernels)
+{
+    Testing::ForEachCharKernelSet([]()
+    {
+        TestFindSubstringAgainstReference<char>();
+        TestFindSubstringAgainstReference<char16_t>();
+        TestFindSubstringAgainstReference<char32_t>();
+        TestFindSubstringAgainstReference<wchar_t>();
+    });
+}
+
+TEST(StringSearchTests, FindAnyKernels)
+{
+    Testing::ForEachCharKernelSet([]()
+    {
+        TestFindAnyAgainstReference<char>();
+        TestFindAnyAgainstReference<char8_t>();
+        TestFindAnyAgainstReference<char16_t>();
+        TestFindAnyAgainstReference<char32_t>();
+    });
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "Foundation/String/String.h"
+#include "Foundation/String/StringView.h"
+
+#include <string>
+#include <vector>
+
+using namespace Kitsune;
+
+namespace
+{
+    template<typename View>
+    std::vector<std::string> Collect(const View& view)
+    {
+        std::vector<std::string> pieces;
+        for (StringView piece : view)
+            pieces.emplace_back(piece.Data(), piece.Size());
+
+        return pieces;
+    }
+
+    using Pieces = std::vector<std::string>;
+}
+
+TEST(StringSplitTests, SplitChar)
+{
+    EXPECT_EQ(Collect(StringView("a,b,c").Split(',')), (Pieces{ "a", "b", "c" }));
+    EXPECT_EQ(Collect(StringView("abc").Split(',')), (Pieces{ "abc" }));
+
+    // Delimiters at the ends or next to each other give empty pieces.
+    EXPECT_EQ(Collect(StringView(",a,,b,").Split(',')), (Pieces{ "", "a", "", "b", "" }));
+    EXPECT_EQ(Collect(StringView("").Split(',')), (Pieces{ "" }));
+    EXPECT_EQ(Collect(StringView().Split(',')), (Pieces{ "" }));
+}
+
+TEST(StringSplitTests, SplitString)
+{
+    EXPECT_EQ(Collect(StringView("key => value => more").Split(" => ")), (Pieces{ "key", "value", "more" }));
+    EXPECT_EQ(Collect(StringView("aaaa").Split("aa")), (Pieces{ "", "", "" }));
+    EXPECT_EQ(Collect(StringView("no delimiter").Split("::")), (Pieces{ "no delimiter" }));
+
+    // An empty delimiter doesn't split anything.
+    EXPECT_EQ(Collect(StringView("abc").Split("")), (Pieces{ "abc" }));
+}
+
+TEST(StringSplitTests, SplitAny)
+{
+    EXPECT_EQ(Collect(StringView("C:\\Users/Kitsune\\file.txt").SplitAny("\\/")),
+              (Pieces{ "C:", "Users", "Kitsune", "file.txt" }));
+
+    EXPECT_EQ(Collect(StringView("a b\tc").SplitAny(" \t")), (Pieces{ "a", "b", "c" }));
+    EXPECT_EQ(Collect(StringView("abc").SplitAny("")), (Pieces{ "abc" }));
+}
+
+TEST(StringSplitTests, Lines)
+{
+    EXPECT_EQ(Collect(StringView("one\ntwo\r\nthree").Lines()), (Pieces{ "one", "two", "three" }));
+    EXPECT_EQ(Collect(StringView("one\n\nthree\n").Lines()), (Pieces{ "one", "", "three" }));
+    EXPECT_EQ(Collect(StringView("\n").Lines()), (Pieces{ "" }));
+    EXPECT_EQ(Collect(StringView("").Lines()), (Pieces{}));
+
+    // Only "\r\n" line endings lose the '\r'.
+    EXPECT_EQ(Collect(StringView("a\r\r\nb\r").Lines()), (Pieces{ "a\r", "b\r" }));
+}
+
+TEST(StringSplitTests, PiecesPointIntoString)
+{
+    String string = "first second third";
+
+    const char* expected = string.Data();
+    for (StringView piece : StringView(string).Split(' '))
+    {
+        EXPECT_EQ(piece.Data(), expected);
+        expected += piece.Size() + 1;
+    }
+}
+
+TEST(StringSplitTests, Iterators)
+{
+    auto split = StringView("x|y").Split('|');
+
+    auto it = split.GetBegin();
+    EXPECT_NE(it, split.GetEnd());
+    EXPECT_TRUE(*it++ == "x");
+    EXPECT_TRUE(*it == "y");
+
+    ++it;
+    EXPECT_EQ(it, split.GetEnd());
+}
+
+TEST(StringSplitTests, WideCharacters)
+{
+    std::vector<std::u16string> pieces;
+    for (U16StringView piece : U16StringView(u"α;β;γ").Split(u';'))
+        pieces.emplace_back(piece.Data(), piece.Size());
+
+    EXPECT_EQ(pieces, (std::vector<std::u16string>{ u"α", u"β", u"γ" }));
+}
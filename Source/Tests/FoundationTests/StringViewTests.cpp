@@ -126,6 +126,45 @@ TEST(BasicStringViewTests, Substring)
     EXPECT_EQ(std::char_traits<char16_t>::compare(substr.Data(), u"World", 5), 0);
 }
 
+TEST(BasicStringViewTests, Find)
+{
+    StringView str = "[Core] level=info; [Render] level=warn";
+
+    EXPECT_EQ(str.Find("level"), 7);
+    EXPECT_EQ(str.Find("level", 8), 28);
+    EXPECT_EQ(str.Find("level", 29), StringView::s_NoPosition);
+    EXPECT_EQ(str.Find("debug"), StringView::s_NoPosition);
+
+    EXPECT_EQ(str.Find('['), 0);
+    EXPECT_EQ(str.Find('[', 1), 19);
+    EXPECT_EQ(str.Find('?'), StringView::s_NoPosition);
+
+    EXPECT_EQ(str.Find(""), 0);
+    EXPECT_EQ(str.Find("", str.Size()), str.Size());
+    EXPECT_EQ(str.Find("info", str.Size() + 1), StringView::s_NoPosition);
+    EXPECT_EQ(StringView().Find("info"), StringView::s_NoPosition);
+}
+
+TEST(BasicStringViewTests, FindAny)
+{
+    U16StringView str = u"key = value; other = 2";
+
+    EXPECT_EQ(str.FindAny(u"=;"), 4);
+    EXPECT_EQ(str.FindAny(u"=;", 5), 11);
+    EXPECT_EQ(str.FindAny(u"#!"), U16StringView::s_NoPosition);
+    EXPECT_EQ(str.FindAny(u""), U16StringView::s_NoPosition);
+}
+
+TEST(BasicStringViewTests, Contains)
+{
+    StringView str = "Pig Listen Broken";
+
+    EXPECT_TRUE(str.Contains("Listen"));
+    EXPECT_TRUE(str.Contains('B'));
+    EXPECT_FALSE(str.Contains("listen"));
+    EXPECT_FALSE(str.Contains('z'));
+}
+
 TEST(BasicStringViewTests, Iterators)
 {
     BasicStringView<char> str = "Pig Listen Broken";
@@ -169,3 +208,17 @@ TEST(BasicStringViewTests, EqualCstr)
     EXPECT_TRUE(arr == arr2);
     EXPECT_FALSE(arr == diff);
 }
+
+TEST(BasicStringViewTests, Trim)
+{
+    StringView str = " \t Padded string\r\n";
+
+    EXPECT_TRUE(str.TrimStart() == "Padded string\r\n");
+    EXPECT_TRUE(str.TrimEnd() == " \t Padded string");
+    EXPECT_TRUE(str.Trim() == "Padded string");
+    EXPECT_EQ(str.Trim().Data(), str.Data() + 3);
+
+    EXPECT_TRUE(StringView("--[value]--").Trim("-[]") == "value");
+    EXPECT_TRUE(StringView(" \n ").Trim().IsEmpty());
+    EXPECT_TRUE(StringView().Trim().IsEmpty());
+}
@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include "Foundation/Memory/ThreadCachingMemoryApi.h"
+
+using namespace Kitsune;
+
+TEST(ThreadCachingMemoryApiTests, DefaultAlignment)
+{
+    ThreadCachingMemoryApi api;
+
+    for (Usize size : { 0, 1, 7, 16, 33, 100, 1000, 8192, 10000 })
+    {
+        void* ptr = api.TryAllocate(size, api.GetDefaultAlignment());
+
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ((Uintptr)ptr % api.GetDefaultAlignment(), 0);
+
+        std::memset(ptr, 0xAB, size);
+        api.Free(ptr);
+    }
+}
+
+TEST(ThreadCachingMemoryApiTests, SpecifiedAlignment)
+{
+    ThreadCachingMemoryApi api;
+
+    for (Usize align : { 1, 8, 16, 32, 64, 128, 4096 })
+    {
+        for (Usize size : { 1, 24, 48, 100, 5000 })
+        {
+            void* ptr = api.TryAllocate(size, align);
+
+            ASSERT_NE(ptr, nullptr);
+            EXPECT_EQ((Uintptr)ptr % align, 0);
+
+            std::memset(ptr, 0xCD, size);
+            api.Free(ptr);
+        }
+    }
+}
+
+TEST(ThreadCachingMemoryApiTests, FreeNullptr)
+{
+    ThreadCachingMemoryApi api;
+    api.Free(nullptr);
+}
+
+TEST(ThreadCachingMemoryApiTests, ReusesFreedBlocks)
+{
+    ThreadCachingMemoryApi api;
+
+    void* ptr = api.TryAllocate(40, 16);
+    api.Free(ptr);
+
+    EXPECT_EQ(api.TryAllocate(40, 16), ptr);
+    api.Free(ptr);
+}
+
+TEST(ThreadCachingMemoryApiTests, DistinctBlocks)
+{
+    ThreadCachingMemoryApi api;
+    std::vector<Uint8*> blocks;
+
+    // Enough to go through a few slabs.
+    for (int i = 0; i < 10000; ++i)
+    {
+        Uint8* ptr = (Uint8*)api.TryAllocate(64, 16);
+        ASSERT_NE(ptr, nullptr);
+
+        std::memset(ptr, i & 0xFF, 64);
+        blocks.push_back(ptr);
+    }
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        EXPECT_EQ(blocks[i][0], i & 0xFF);
+        EXPECT_EQ(blocks[i][63], i & 0xFF);
+
+        api.Free(blocks[i]);
+    }
+}
+
+TEST(ThreadCachingMemoryApiTests, MultipleInstances)
+{
+    ThreadCachingMemoryApi api1;
+    ThreadCachingMemoryApi api2;
+
+    void* ptr1 = api1.TryAllocate(32, 16);
+    void* ptr2 = api2.TryAllocate(32, 16);
+
+    EXPECT_NE(ptr1, ptr2);
+
+    api1.Free(ptr1);
+    api2.Free(ptr2);
+
+    EXPECT_EQ(api1.TryAllocate(32, 16), ptr1);
+    EXPECT_EQ(api2.TryAllocate(32, 16), ptr2);
+
+    api1.Free(ptr1);
+    api2.Free(ptr2);
+}
+
+TEST(ThreadCachingMemoryApiTests, CrossThreadFree)
+{
+    ThreadCachingMemoryApi api;
+
+    constexpr int count = 5000;
+    std::vector<void*> blocks(count);
+
+    std::thread producer([&]() {
+        for (int i = 0; i < count; ++i)
+        {
+            blocks[i] = api.TryAllocate(16 + (i % 500), 16);
+            std::memset(blocks[i], 0xEE, 16);
+        }
+    });
+
+    producer.join();
+
+    std::thread consumer([&]() {
+        for (void* ptr : blocks)
+            api.Free(ptr);
+    });
+
+    consumer.join();
+
+    // Both threads exited, their caches should have gone back to the central lists.
+    void* ptr = api.TryAllocate(16, 16);
+    EXPECT_NE(ptr, nullptr);
+
+    api.Free(ptr);
+}
+
+namespace ThreadCachingTesting
+{
+    // Constructed before the thread's caches, so it gets destroyed after them.
+    struct LateFree
+    {
+        ~LateFree()
+        {
+            if (Api == nullptr) return;
+            Api->Free(Block);
+
+            void* ptr = Api->TryAllocate(40, 16);
+            Allocated = (ptr != nullptr);
+
+            Api->Free(ptr);
+        }
+
+        ThreadCachingMemoryApi* Api = nullptr;
+        void* Block = nullptr;
+
+        static inline bool Allocated = false;
+    };
+}
+
+TEST(ThreadCachingMemoryApiTests, FreeAfterThreadCacheDestroyed)
+{
+    using namespace ThreadCachingTesting;
+
+    ThreadCachingMemoryApi api;
+    void* block = nullptr;
+
+    std::thread thread([&]() {
+        thread_local LateFree lateFree;
+        lateFree.Api = &api;
+
+        block = api.TryAllocate(40, 16);
+        lateFree.Block = block;
+    });
+
+    thread.join();
+    EXPECT_TRUE(LateFree::Allocated);
+
+    // The late free went straight back to the central lists, not into a cache nobody owns.
+    std::vector<void*> blocks;
+    bool found = false;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        blocks.push_back(api.TryAllocate(40, 16));
+        found = found || (blocks.back() == block);
+    }
+
+    EXPECT_TRUE(found);
+
+    for (void* ptr : blocks)
+        api.Free(ptr);
+}
+
+TEST(ThreadCachingMemoryApiTests, ConcurrentAllocations)
+{
+    ThreadCachingMemoryApi api;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&api, t]() {
+            std::vector<Uint8*> live;
+
+            for (int i = 0; i < 20000; ++i)
+            {
+                Usize size = 8 + ((i * 37 + t) % 2048);
+                Uint8* ptr = (Uint8*)api.TryAllocate(size, 16);
+
+                ASSERT_NE(ptr, nullptr);
+                ptr[0] = (Uint8)t;
+                ptr[size - 1] = (Uint8)t;
+
+                live.push_back(ptr);
+                if (live.size() > 64)
+                {
+                    EXPECT_EQ(live.front()[0], (Uint8)t);
+
+                    api.Free(live.front());
+                    live.erase(live.begin());
+                }
+            }
+
+            for (Uint8* ptr : live)
+                api.Free(ptr);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+TEST(ThreadCachingMemoryApiTests, TryExpandWithinSizeClass)
+{
+    ThreadCachingMemoryApi api;
+
+    void* ptr = api.TryAllocate(40, 16);
+
+    EXPECT_TRUE(api.TryExpand(ptr, 48));
+    EXPECT_FALSE(api.TryExpand(ptr, 4096));
+    EXPECT_EQ(api.TryReallocate(ptr, 44, 16), ptr);
+    EXPECT_EQ(api.TryReallocate(ptr, 4096, 16), nullptr);
+
+    api.Free(ptr);
+}
+
+TEST(ThreadCachingMemoryApiTests, TryReallocateLarge)
+{
+    ThreadCachingMemoryApi api;
+
+    Uint8* ptr = (Uint8*)api.TryAllocate(20000, 16);
+    std::memset(ptr, 0x5A, 20000);
+
+    Uint8* grown = (Uint8*)api.TryReallocate(ptr, 1 << 20, 16);
+    ASSERT_NE(grown, nullptr);
+
+    EXPECT_EQ(grown[0], 0x5A);
+    EXPECT_EQ(grown[19999], 0x5A);
+
+    // Would fit a size class now, has to go through a new allocation.
+    EXPECT_EQ(api.TryReallocate(grown, 100, 16), nullptr);
+    api.Free(grown);
+}
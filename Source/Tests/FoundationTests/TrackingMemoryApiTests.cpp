@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include "Foundation/Memory/CMallocApi.h"
+#include "Foundation/Memory/TrackingMemoryApi.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    MemoryTagStatistics FindTag(const TrackingMemoryApi& api, const char* tag)
+    {
+        MemoryTagStatistics found = {};
+        api.ForEachTag([&](const MemoryTagStatistics& stats)
+        {
+            if (std::strcmp(stats.Tag, tag) == 0)
+                found = stats;
+        });
+
+        return found;
+    }
+}
+
+TEST(TrackingMemoryApiTests, Alignment)
+{
+    TrackingMemoryApi api(new CMallocApi());
+
+    for (Usize align : { 1, 8, 16, 32, 64, 256 })
+    {
+        void* ptr = api.TryAllocate(24, align);
+
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ((Uintptr)ptr % align, 0);
+
+        std::memset(ptr, 0xAB, 24);
+        api.Free(ptr);
+    }
+}
+
+TEST(TrackingMemoryApiTests, Counters)
+{
+    TrackingMemoryApi api(new CMallocApi());
+
+    void* ptr1 = api.TryAllocate(100, 16);
+    void* ptr2 = api.TryAllocate(28, 16);
+
+    MemoryStatistics stats = api.GetStatistics();
+    EXPECT_EQ(stats.LiveBytes, 128u);
+    EXPECT_EQ(stats.LiveAllocations, 2u);
+    EXPECT_EQ(stats.TotalAllocations, 2u);
+    EXPECT_EQ(stats.TotalFrees, 0u);
+
+    api.Free(ptr1);
+    api.Free(ptr2);
+    api.Free(nullptr);
+
+    stats = api.GetStatistics();
+    EXPECT_EQ(stats.LiveBytes, 0u);
+    EXPECT_EQ(stats.LiveAllocations, 0u);
+    EXPECT_EQ(stats.TotalBytesAllocated, 128u);
+    EXPECT_EQ(stats.TotalFrees, 2u);
+    EXPECT_GE(stats.PeakBytes, 128u);
+}
+
+TEST(TrackingMemoryApiTests, PeakBytes)
+{
+    TrackingMemoryApi api(new CMallocApi());
+
+    void* big = api.TryAllocate(TrackingMemoryApi::s_PeakSampleBytes * 2, 16);
+    api.Free(big);
+
+    void* small = api.TryAllocate(64, 16);
+
+    MemoryStatistics stats = api.GetStatistics();
+    EXPECT_EQ(stats.LiveBytes, 64u);
+    EXPECT_EQ(stats.PeakBytes, TrackingMemoryApi::s_PeakSampleBytes * 2);
+
+    api.Free(small);
+}
+
+TEST(TrackingMemoryApiTests, SizeHistogram)
+{
+    TrackingMemoryApi api(new CMallocApi());
+
+    for (Usize size : { 1, 16, 17, 32, 33, 1024 })
+        api.Free(api.TryAllocate(size, 16));
+
+    MemoryStatistics stats = api.GetStatistics();
+    EXPECT_EQ(stats.SizeHistogram[0], 2u);          // ..16
+    EXPECT_EQ(stats.SizeHistogram[1], 2u);          // 17..32
+    EXPECT_EQ(stats.SizeHistogram[2], 1u);          // 33..64
+    EXPECT_EQ(stats.SizeHistogram[6], 1u);          // 513..1024
+}
+
+TEST(TrackingMemoryApiTests, TagBreakdown)
+{
+    TrackingMemoryApi api(new CMallocApi(), /* Tag breakdown: */ true);
+
+    void* untagged = api.TryAllocate(8, 16);
+    void* tagged;
+    {
+        MemoryTagScope scope("Renderer");
+
+        tagged = api.TryAllocate(48, 16);
+        api.Free(api.TryAllocate(16, 16));
+
+        {
+            MemoryTagScope inner("Audio");
+            api.Free(api.TryAllocate(32, 16));
+        }
+    }
+
+    MemoryTagStatistics renderer = FindTag(api, "Renderer");
+    EXPECT_EQ(renderer.TotalAllocations, 2u);
+    EXPECT_EQ(renderer.LiveAllocations, 1u);
+    EXPECT_EQ(renderer.LiveBytes, 48u);
+    EXPECT_NE(renderer.Site.Line(), 0u);
+
+    MemoryTagStatistics audio = FindTag(api, "Audio");
+    EXPECT_EQ(audio.TotalAllocations, 1u);
+    EXPECT_EQ(audio.LiveAllocations, 0u);
+
+    EXPECT_EQ(FindTag(api, "<untagged>").LiveBytes, 8u);
+
+    // Freed outside of the scope, still charged to it.
+    api.Free(tagged);
+    EXPECT_EQ(FindTag(api, "Renderer").LiveAllocations, 0u);
+
+    api.Free(untagged);
+}
+
+TEST(TrackingMemoryApiTests, ReportLeaks)
+{
+    TrackingMemoryApi api(new CMallocApi());
+    EXPECT_FALSE(api.ReportLeaks());
+
+    void* ptr = api.TryAllocate(10, 16);
+    EXPECT_TRUE(api.ReportLeaks());
+
+    api.Free(ptr);
+    EXPECT_FALSE(api.ReportLeaks());
+}
+
+TEST(TrackingMemoryApiTests, ConcurrentCounters)
+{
+    TrackingMemoryApi api(new CMallocApi(), /* Tag breakdown: */ true);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&api]() {
+            MemoryTagScope scope("Worker");
+            std::vector<void*> live;
+
+            for (int i = 0; i < 10000; ++i)
+                live.push_back(api.TryAllocate(32, 16));
+
+            for (void* ptr : live)
+                api.Free(ptr);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    MemoryStatistics stats = api.GetStatistics();
+    EXPECT_EQ(stats.TotalAllocations, 40000u);
+    EXPECT_EQ(stats.LiveBytes, 0u);
+    EXPECT_GE(stats.PeakBytes, TrackingMemoryApi::s_PeakSampleBytes);
+
+    EXPECT_EQ(FindTag(api, "Worker").TotalAllocations, 40000u);
+}
+
+TEST(TrackingMemoryApiTests, Resize)
+{
+    TrackingMemoryApi api(new CMallocApi(), /* Tag breakdown: */ true);
+
+    Uint8* ptr = (Uint8*)api.TryAllocate(100, 16);
+    std::memset(ptr, 0x11, 100);
+
+    Uint8* grown = (Uint8*)api.TryReallocate(ptr, 5000, 16);
+    ASSERT_NE(grown, nullptr);
+    EXPECT_EQ(grown[99], 0x11);
+
+    MemoryStatistics stats = api.GetStatistics();
+    EXPECT_EQ(stats.LiveBytes, 5000u);
+    EXPECT_EQ(stats.LiveAllocations, 1u);
+    EXPECT_EQ(FindTag(api, "<untagged>").LiveBytes, 5000u);
+
+    if (api.TryExpand(grown, 10))
+    {
+        EXPECT_EQ(api.GetStatistics().LiveBytes, 10u);
+    }
+
+    api.Free(grown);
+    EXPECT_EQ(api.GetStatistics().LiveBytes, 0u);
+}
@@ -0,0 +1,343 @@
+#include <gtest/gtest.h>
+
+#include "CharKernelSets.h"
+#include "Foundation/String/Unicode.h"
+
+#include <vector>
+
+using namespace Kitsune;
+
+namespace
+{
+    template<typename T>
+    void AppendEncoded(std::vector<T>& str, char32_t cp)
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            if (cp < 0x80)
+            {
+                str.push_back(static_cast<T>(cp));
+            }
+            else if (cp < 0x800)
+            {
+                str.push_back(static_cast<T>(0xC0 | (cp >> 6)));
+                str.push_back(static_cast<T>(0x80 | (cp & 0x3F)));
+            }
+            else if (cp < 0x10000)
+            {
+                str.push_back(static_cast<T>(0xE0 | (cp >> 12)));
+                str.push_back(static_cast<T>(0x80 | ((cp >> 6) & 0x3F)));
+                str.push_back(static_cast<T>(0x80 | (cp & 0x3F)));
+            }
+            else
+            {
+                str.push_back(static_cast<T>(0xF0 | (cp >> 18)));
+                str.push_back(static_cast<T>(0x80 | ((cp >> 12) & 0x3F)));
+                str.push_back(static_cast<T>(0x80 | ((cp >> 6) & 0x3F)));
+                str.push_back(static_cast<T>(0x80 | (cp & 0x3F)));
+            }
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            if (cp < 0x10000)
+            {
+                str.push_back(static_cast<T>(cp));
+            }
+            else
+            {
+                str.push_back(static_cast<T>(0xD800 + ((cp - 0x10000) >> 10)));
+                str.push_back(static_cast<T>(0xDC00 + (cp & 0x3FF)));
+            }
+        }
+        else
+        {
+            str.push_back(static_cast<T>(cp));
+        }
+    }
+
+    template<typename T>
+    std::vector<T> Encode(const std::vector<char32_t>& codePoints)
+    {
+        std::vector<T> str;
+        for (char32_t cp : codePoints)
+            AppendEncoded(str, cp);
+
+        return str;
+    }
+
+    // Mostly ASCII with some of every sequence length, in runs long enough for the vector
+    // kernels to see both kinds of blocks.
+    std::vector<char32_t> MakeCodePoints(Uint32& seed, Usize count)
+    {
+        auto next = [&seed]() { seed = seed * 1103515245 + 12345; return (seed >> 8); };
+
+        std::vector<char32_t> codePoints;
+        Uint32 kind = 0;
+
+        for (Usize i = 0; i < count; ++i)
+        {
+            if (next() % 24 == 0)
+                kind = next() % 4;
+
+            Uint32 random = next();
+            switch (kind)
+            {
+            case 0:  codePoints.push_back(0x20 + random % 0x5F);      break;
+            case 1:  codePoints.push_back(0x80 + random % 0x780);     break;
+            case 2:  codePoints.push_back(0xE000 + random % 0x2000);  break;
+            default: codePoints.push_back(0x10000 + random % 0xFFFFF); break;
+            }
+        }
+
+        return codePoints;
+    }
+
+    // Straight from the table of well-formed byte sequences in the standard.
+    Usize ReferenceFindInvalidUtf8(const std::vector<Uint8>& str)
+    {
+        for (Usize i = 0; i < str.size(); )
+        {
+            Uint8 lead = str[i];
+            Usize length;
+            Uint8 low = 0x80, high = 0xBF;
+
+            if (lead < 0x80)                       { ++i; continue; }
+            else if (lead >= 0xC2 && lead <= 0xDF) length = 2;
+            else if (lead == 0xE0)                 { length = 3; low = 0xA0; }
+            else if (lead >= 0xE1 && lead <= 0xEC) length = 3;
+            else if (lead == 0xED)                 { length = 3; high = 0x9F; }
+            else if (lead >= 0xEE && lead <= 0xEF) length = 3;
+            else if (lead == 0xF0)                 { length = 4; low = 0x90; }
+            else if (lead >= 0xF1 && lead <= 0xF3) length = 4;
+            else if (lead == 0xF4)                 { length = 4; high = 0x8F; }
+            else                                   return i;
+
+            if (i + length > str.size() || str[i + 1] < low || str[i + 1] > high)
+                return i;
+
+            for (Usize j = 2; j < length; ++j)
+            {
+                if (str[i + j] < 0x80 || str[i + j] > 0xBF)
+                    return i;
+            }
+
+            i += length;
+        }
+
+        return str.size();
+    }
+
+    Usize ReferenceFindInvalidUtf16(const std::vector<char16_t>& str)
+    {
+        for (Usize i = 0; i < str.size(); ++i)
+        {
+            if (str[i] < 0xD800 || str[i] > 0xDFFF)
+                continue;
+
+            if (str[i] > 0xDBFF || i + 1 == str.size() || str[i + 1] < 0xDC00 || str[i + 1] > 0xDFFF)
+                return i;
+
+            ++i;
+        }
+
+        return str.size();
+    }
+
+    Usize ReferenceFindInvalidUtf32(const std::vector<char32_t>& str)
+    {
+        for (Usize i = 0; i < str.size(); ++i)
+        {
+            if (str[i] > 0x10FFFF || (str[i] >= 0xD800 && str[i] <= 0xDFFF))
+                return i;
+        }
+
+        return str.size();
+    }
+
+    template<typename To, typename From>
+    void ExpectConverts(const std::vector<From>& from, const std::vector<To>& expected)
+    {
+        ASSERT_EQ(ConvertedLength<To>(from.data(), from.size()), expected.size());
+
+        std::vector<To> converted(expected.size() + 1, To(0x7F));
+        EXPECT_EQ(ConvertUnicode(from.data(), from.size(), converted.data()), expected.size());
+        EXPECT_EQ(converted.back(), To(0x7F));
+
+        converted.pop_back();
+        EXPECT_EQ(converted, expected);
+    }
+
+    template<typename From>
+    void ExpectConvertsToAll(const std::vector<char32_t>& codePoints)
+    {
+        std::vector<From> from = Encode<From>(codePoints);
+
+        ExpectConverts(from, Encode<char8_t>(codePoints));
+        ExpectConverts(from, Encode<char16_t>(codePoints));
+        ExpectConverts(from, Encode<char32_t>(codePoints));
+        ExpectConverts(from, Encode<wchar_t>(codePoints));
+    }
+}
+
+TEST(UnicodeTests, IsValidUnicode)
+{
+    EXPECT_TRUE(IsValidUnicode(StringView("Kitsune")));
+    EXPECT_TRUE(IsValidUnicode(StringView("\xE7\x8B\x90 \xF0\x9F\xA6\x8A")));
+    EXPECT_TRUE(IsValidUnicode(U16StringView(u"狐 \U0001F98A")));
+    EXPECT_TRUE(IsValidUnicode(U32StringView(U"狐 \U0001F98A")));
+    EXPECT_TRUE(IsValidUnicode(StringView()));
+
+    // Overlong, surrogate, past U+10FFFF, stray continuation, truncated.
+    EXPECT_EQ(FindInvalidUnicode("ab\xC0\x80", 4), 2u);
+    EXPECT_EQ(FindInvalidUnicode("ab\xE0\x80\x80", 5), 2u);
+    EXPECT_EQ(FindInvalidUnicode("ab\xED\xA0\x80", 5), 2u);
+    EXPECT_EQ(FindInvalidUnicode("ab\xF4\x90\x80\x80", 6), 2u);
+    EXPECT_EQ(FindInvalidUnicode("ab\xF5\x80\x80\x80", 6), 2u);
+    EXPECT_EQ(FindInvalidUnicode("ab\x80", 3), 2u);
+    EXPECT_EQ(FindInvalidUnicode("ab\xE7\x8B", 4), 2u);
+
+    const char16_t lowFirst[] = { u'a', 0xDC00, 0xD800 };
+    const char16_t loneHigh[] = { u'a', 0xD800, u'b' };
+    EXPECT_EQ(FindInvalidUnicode(lowFirst, 3), 1u);
+    EXPECT_EQ(FindInvalidUnicode(loneHigh, 3), 1u);
+    EXPECT_EQ(FindInvalidUnicode(loneHigh, 2), 1u);
+
+    const char32_t outOfRange[] = { U'a', 0xDFFF, 0x110000 };
+    EXPECT_EQ(FindInvalidUnicode(outOfRange, 3), 1u);
+    EXPECT_EQ(FindInvalidUnicode(outOfRange + 2, 1), 0u);
+}
+
+TEST(UnicodeTests, ConvertString)
+{
+    String utf8 = "Kitsune \xE7\x8B\x90 \xF0\x9F\xA6\x8A";
+
+    EXPECT_EQ(ConvertString<char16_t>(utf8), u"Kitsune 狐 \U0001F98A");
+    EXPECT_EQ(ConvertString<char32_t>(utf8), U"Kitsune 狐 \U0001F98A");
+    EXPECT_EQ(ConvertString<wchar_t>(utf8), L"Kitsune 狐 \U0001F98A");
+    EXPECT_EQ(ConvertString<char>(L"Kitsune 狐 \U0001F98A"), utf8);
+    EXPECT_EQ(ConvertString<char8_t>(U"Kitsune 狐 \U0001F98A"), u8"Kitsune 狐 \U0001F98A");
+
+    U16String empty = ConvertString<char16_t>(StringView());
+    EXPECT_TRUE(empty.IsEmpty());
+
+    EXPECT_THROW((void)ConvertString<char16_t>(StringView("ab\xFF")), InvalidUnicodeException);
+}
+
+TEST(UnicodeTests, ConvertStringLossy)
+{
+    EXPECT_EQ(ConvertStringLossy<char>(u"Kitsune 狐"), String("Kitsune \xE7\x8B\x90"));
+
+    const char16_t unpaired[] = { u'a', 0xD83E, u'b', 0xDD8A, 0 };
+    EXPECT_EQ(ConvertStringLossy<char>(unpaired), String("a\xEF\xBF\xBD" "b\xEF\xBF\xBD"));
+    EXPECT_EQ(ConvertStringLossy<char32_t>(unpaired), U32String(U"a\uFFFDb\uFFFD"));
+
+    EXPECT_EQ(ConvertStringLossy<char16_t>("ab\xFF" "c\xE7\x8B"), U16String(u"ab\uFFFDc\uFFFD\uFFFD"));
+    EXPECT_TRUE(ConvertStringLossy<char16_t>("").IsEmpty());
+    EXPECT_EQ(ConvertStringLossy<wchar_t>(String("Fox \xF0\x9F")), WideString(L"Fox \uFFFD\uFFFD"));
+}
+
+TEST(UnicodeTests, ConvertUnicodeThrowsWithoutWriting)
+{
+    const char str[] = "abc\xE0\x80\x80";
+    char16_t dest[8] = { u'x', u'x', u'x', u'x', u'x', u'x', u'x', u'x' };
+
+    EXPECT_THROW(ConvertUnicode(str, sizeof(str) - 1, dest), InvalidUnicodeException);
+    EXPECT_EQ(dest[0], u'x');
+}
+
+TEST(UnicodeTests, StreamConverter)
+{
+    Uint32 seed = 1234;
+    std::vector<char32_t> codePoints = MakeCodePoints(seed, 200);
+
+    std::vector<char8_t> utf8 = Encode<char8_t>(codePoints);
+    std::vector<char16_t> expected = Encode<char16_t>(codePoints);
+
+    for (Usize chunkSize = 1; chunkSize <= 9; ++chunkSize)
+    {
+        UnicodeStreamConverter<char16_t, char8_t> converter;
+        std::vector<char16_t> converted;
+
+        for (Usize i = 0; i < utf8.size(); i += chunkSize)
+        {
+            Usize size = KITSUNE_MIN(chunkSize, utf8.size() - i);
+            Usize offset = converted.size();
+
+            converted.resize(offset + converter.MaxConvertedLength(size));
+            converted.resize(offset + converter.Convert(utf8.data() + i, size, converted.data() + offset));
+        }
+
+        EXPECT_FALSE(converter.HasPending());
+        EXPECT_NO_THROW(converter.Finish());
+        EXPECT_EQ(converted, expected);
+    }
+
+    std::vector<char32_t> utf32(8);
+    UnicodeStreamConverter<char32_t, char16_t> converter;
+
+    const char16_t pair[] = { 0xD83E, 0xDD8A };
+    EXPECT_EQ(converter.Convert(pair, 1, utf32.data()), 0u);
+    EXPECT_TRUE(converter.HasPending());
+    EXPECT_EQ(converter.Convert(pair + 1, 1, utf32.data()), 1u);
+    EXPECT_EQ(utf32[0], U'\U0001F98A');
+
+    EXPECT_EQ(converter.Convert(pair, 1, utf32.data()), 0u);
+    EXPECT_THROW(converter.Finish(), InvalidUnicodeException);
+    EXPECT_FALSE(converter.HasPending());
+
+    const char16_t broken[] = { 0xD83E, u'a' };
+    EXPECT_THROW(converter.Convert(broken, 2, utf32.data()), InvalidUnicodeException);
+}
+
+TEST(UnicodeTests, ConvertKernels)
+{
+    Testing::ForEachCharKernelSet([]()
+    {
+        Uint32 seed = 42;
+
+        for (int round = 0; round < 200; ++round)
+        {
+            std::vector<char32_t> codePoints = MakeCodePoints(seed, seed % 300);
+
+            ExpectConvertsToAll<char>(codePoints);
+            ExpectConvertsToAll<char16_t>(codePoints);
+            ExpectConvertsToAll<char32_t>(codePoints);
+        }
+    });
+}
+
+TEST(UnicodeTests, ValidateKernels)
+{
+    Testing::ForEachCharKernelSet([]()
+    {
+        Uint32 seed = 7;
+        auto next = [&seed]() { seed = seed * 1103515245 + 12345; return (seed >> 8); };
+
+        for (int round = 0; round < 2000; ++round)
+        {
+            std::vector<char32_t> codePoints = MakeCodePoints(seed, next() % 100);
+            std::vector<Uint8> utf8 = Encode<Uint8>(codePoints);
+            std::vector<char16_t> utf16 = Encode<char16_t>(codePoints);
+            std::vector<char32_t> utf32 = Encode<char32_t>(codePoints);
+
+            // Break a byte or two, or cut the end off, most of the time.
+            if (!utf8.empty() && next() % 4 != 0)
+            {
+                for (Uint32 i = next() % 3; i > 0; --i)
+                    utf8[next() % utf8.size()] = static_cast<Uint8>(next());
+
+                if (next() % 4 == 0)
+                    utf8.resize(next() % utf8.size());
+
+                utf16[next() % utf16.size()] = static_cast<char16_t>(0xD800 + next() % 0x800);
+                utf32[next() % utf32.size()] = (next() % 2) ? 0xD800 + next() % 0x800 : 0x110000 + next();
+            }
+
+            EXPECT_EQ(FindInvalidUnicode(reinterpret_cast<const char*>(utf8.data()), utf8.size()),
+                      ReferenceFindInvalidUtf8(utf8));
+
+            EXPECT_EQ(FindInvalidUnicode(utf16.data(), utf16.size()), ReferenceFindInvalidUtf16(utf16));
+            EXPECT_EQ(FindInvalidUnicode(utf32.data(), utf32.size()), ReferenceFindInvalidUtf32(utf32));
+        }
+    });
+}
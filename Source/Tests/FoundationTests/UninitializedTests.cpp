@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include "Foundation/Algorithms/Uninitialized.h"
 
+#include "Foundation/String/String.h"
+#include "Foundation/Memory/SharedPtr.h"
+#include "Foundation/Containers/Array.h"
+#include "Foundation/Maths/Vector2.h"
+
 #include <cstring>
 #include "TestContainer.h"
 
@@ -24,6 +29,20 @@ namespace UninitializedTesting
     public:
         int Value;
     };
+
+    // Only nothrow-movable types can be relocated onto ranges they overlap.
+    class NothrowC
+    {
+    public:
+        NothrowC(int x) : Value(x) { /* ... */ }
+        NothrowC(NothrowC&& c) noexcept
+        {
+            Value = std::exchange(c.Value, 0);
+        }
+
+    public:
+        int Value;
+    };
 }
 
 using namespace UninitializedTesting;
@@ -190,3 +209,80 @@ TEST_F(UninitializedTests, UninitializedFillN)
     EXPECT_GENERAL_STREQ(begin[3].c_str(), "Hello!");
     EXPECT_GENERAL_STREQ(begin[4].c_str(), "Hello!");
 }
+
+TEST(UninitializedRelocateTests, Trait)
+{
+    EXPECT_TRUE(IsTriviallyRelocatable<int>);
+    EXPECT_TRUE(IsTriviallyRelocatable<Vector2<float>>);
+    EXPECT_TRUE(IsTriviallyRelocatable<SharedPtr<C>>);
+    EXPECT_TRUE(IsTriviallyRelocatable<WeakPtr<C>>);
+    EXPECT_TRUE(IsTriviallyRelocatable<ScopedPtr<C>>);
+    EXPECT_TRUE(IsTriviallyRelocatable<Array<String>>);
+    EXPECT_TRUE(IsTriviallyRelocatable<String>);
+
+    EXPECT_FALSE(IsTriviallyRelocatable<C>);
+    EXPECT_FALSE(Algorithms::IsNothrowRelocatable<C>);
+    EXPECT_TRUE(Algorithms::IsNothrowRelocatable<NothrowC>);
+}
+
+TEST(UninitializedRelocateTests, Overlapping)
+{
+    SharedPtr<int> storage[6] = { MakeShared<int>(0), MakeShared<int>(1), MakeShared<int>(2),
+                                  MakeShared<int>(3) };
+
+    // Shift right by two, then back again.
+    storage[4].~SharedPtr();
+    storage[5].~SharedPtr();
+
+    Algorithms::UninitializedRelocateBackward(storage, storage + 4, storage + 6);
+    new (storage) SharedPtr<int>();
+    new (storage + 1) SharedPtr<int>();
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(*storage[i + 2], i);
+        EXPECT_EQ(storage[i + 2].GetCount(), 1);
+    }
+
+    storage[0].~SharedPtr();
+    storage[1].~SharedPtr();
+    Algorithms::UninitializedRelocate(storage + 2, storage + 6, storage);
+    new (storage + 4) SharedPtr<int>();
+    new (storage + 5) SharedPtr<int>();
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(*storage[i], i);
+}
+
+TEST(UninitializedRelocateTests, NonTrivial)
+{
+    alignas(NothrowC) unsigned char buffer[5 * sizeof(NothrowC)];
+    NothrowC* objects = reinterpret_cast<NothrowC*>(buffer);
+
+    for (int i = 0; i < 3; ++i)
+        new (objects + i) NothrowC(i + 1);
+
+    NothrowC* end = Algorithms::UninitializedRelocateBackward(objects, objects + 3, objects + 5);
+    EXPECT_EQ(end, objects + 2);
+
+    for (int i = 0; i < 3; ++i)
+        EXPECT_EQ(objects[i + 2].Value, i + 1);
+}
+
+TEST(UninitializedRelocateTests, MayThrow)
+{
+    alignas(C) unsigned char srcBuffer[3 * sizeof(C)];
+    alignas(C) unsigned char destBuffer[3 * sizeof(C)];
+
+    C* src = reinterpret_cast<C*>(srcBuffer);
+    C* dest = reinterpret_cast<C*>(destBuffer);
+
+    for (int i = 0; i < 3; ++i)
+        new (src + i) C(i + 1);
+
+    C* end = Algorithms::UninitializedRelocate(src, src + 3, dest);
+    EXPECT_EQ(end, dest + 3);
+
+    for (int i = 0; i < 3; ++i)
+        EXPECT_EQ(dest[i].Value, i + 1);
+}
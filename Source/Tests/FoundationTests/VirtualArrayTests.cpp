@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include "Foundation/Containers/VirtualArray.h"
+#include "Foundation/Memory/SharedPtr.h"
+#include "Foundation/String/String.h"
+
+using namespace Kitsune;
+
+TEST(VirtualArrayTests, DefaultConstructor)
+{
+    VirtualArray<int> array;
+
+    EXPECT_EQ(array.Data(), nullptr);
+    EXPECT_EQ(array.Size(), 0);
+    EXPECT_EQ(array.MaxCapacity(), 0);
+
+    EXPECT_THROW(array.PushBack(1), BadAllocException);
+}
+
+TEST(VirtualArrayTests, ReservesWithoutCommitting)
+{
+    VirtualArray<int> array(1024 * 1024);
+
+    EXPECT_NE(array.Data(), nullptr);
+    EXPECT_TRUE(array.IsEmpty());
+    EXPECT_EQ(array.Capacity(), 0);
+    EXPECT_GE(array.MaxCapacity(), 1024 * 1024);
+}
+
+TEST(VirtualArrayTests, PushBack)
+{
+    VirtualArray<int> array(100000);
+
+    for (int i = 0; i < 100000; ++i)
+        array.PushBack(i);
+
+    ASSERT_EQ(array.Size(), 100000);
+    for (int i = 0; i < 100000; ++i)
+        EXPECT_EQ(array[i], i);
+
+    EXPECT_EQ(array.Front(), 0);
+    EXPECT_EQ(array.Back(), 99999);
+}
+
+TEST(VirtualArrayTests, StableAddresses)
+{
+    VirtualArray<Int64> array(1024 * 1024);
+
+    Int64* first = &array.EmplaceBack(42);
+    const Int64* data = array.Data();
+
+    for (Int64 i = 0; i < 500000; ++i)
+        array.PushBack(i);
+
+    EXPECT_EQ(&array.Front(), first);
+    EXPECT_EQ(array.Data(), data);
+    EXPECT_EQ(*first, 42);
+}
+
+TEST(VirtualArrayTests, CommitsInPages)
+{
+    VirtualArray<Uint8> array(16 * 1024 * 1024);
+
+    array.PushBack(0);
+    EXPECT_EQ(array.Capacity() % VirtualMemory::GetPageSize(), 0);
+    EXPECT_GE(array.Capacity(), VirtualArray<Uint8>::s_MinCommitBytes);
+
+    array.Reserve(1024 * 1024);
+    EXPECT_GE(array.Capacity(), 1024 * 1024);
+    EXPECT_LT(array.Capacity(), array.MaxCapacity());
+}
+
+TEST(VirtualArrayTests, ExceedsMaxCapacity)
+{
+    VirtualArray<int> array(10);
+
+    while (array.Size() < array.MaxCapacity())
+        array.PushBack(1);
+
+    EXPECT_THROW(array.PushBack(1), BadAllocException);
+    EXPECT_THROW(array.Reserve(array.MaxCapacity() + 1), BadAllocException);
+    EXPECT_EQ(array.Size(), array.MaxCapacity());
+}
+
+TEST(VirtualArrayTests, OddSizedElements)
+{
+    struct Element { Uint8 Bytes[24]; };
+    VirtualArray<Element> array(100000);
+
+    for (int i = 0; i < 100000; ++i)
+        array.PushBack(Element{ { static_cast<Uint8>(i) } });
+
+    for (int i = 0; i < 100000; ++i)
+        EXPECT_EQ(array[i].Bytes[0], static_cast<Uint8>(i));
+}
+
+TEST(VirtualArrayTests, PopBackAndClear)
+{
+    VirtualArray<String> array(1024);
+
+    array.PushBack("A string long enough to not fit in the small buffer.");
+    array.PushBack("Short");
+
+    array.PopBack();
+    EXPECT_EQ(array.Size(), 1);
+    EXPECT_EQ(array.Back(), "A string long enough to not fit in the small buffer.");
+
+    Usize capacity = array.Capacity();
+
+    array.Clear();
+    EXPECT_TRUE(array.IsEmpty());
+    EXPECT_EQ(array.Capacity(), capacity);
+
+    EXPECT_THROW(array.PopBack(), OutOfRangeException);
+    EXPECT_THROW(KITSUNE_UNUSED(array.Front()), OutOfRangeException);
+    EXPECT_THROW(KITSUNE_UNUSED(array[0]), OutOfRangeException);
+}
+
+TEST(VirtualArrayTests, DestroysElements)
+{
+    SharedPtr<int> ptr = MakeShared<int>(5);
+    {
+        VirtualArray<SharedPtr<int>> array(1024);
+        for (int i = 0; i < 100; ++i)
+            array.PushBack(ptr);
+
+        EXPECT_EQ(ptr.GetCount(), 101);
+    }
+
+    EXPECT_EQ(ptr.GetCount(), 1);
+}
+
+TEST(VirtualArrayTests, ShrinkToFit)
+{
+    VirtualArray<Uint8> array(16 * 1024 * 1024);
+
+    array.Reserve(4 * 1024 * 1024);
+    array.PushBack(7);
+
+    array.ShrinkToFit();
+    EXPECT_LT(array.Capacity(), 4 * 1024 * 1024);
+    EXPECT_GE(array.Capacity(), 1);
+
+    // Decommitted pages have to come back zeroed once committed again.
+    array.Reserve(4 * 1024 * 1024);
+    EXPECT_EQ(array.Data()[3 * 1024 * 1024], 0);
+    EXPECT_EQ(array[0], 7);
+}
+
+TEST(VirtualArrayTests, MoveConstructor)
+{
+    VirtualArray<int> array1(1024);
+    array1.PushBack(1);
+    array1.PushBack(2);
+
+    const int* data = array1.Data();
+    VirtualArray<int> array2(Move(array1));
+
+    EXPECT_EQ(array1.Data(), nullptr);
+    EXPECT_EQ(array2.Data(), data);
+    EXPECT_EQ(array2.Size(), 2);
+    EXPECT_EQ(array2[1], 2);
+}
+
+TEST(VirtualArrayTests, MoveAssignment)
+{
+    VirtualArray<int> array1(1024);
+    VirtualArray<int> array2(2048);
+
+    array1.PushBack(1);
+    array2.PushBack(2);
+
+    array2 = Move(array1);
+
+    ASSERT_EQ(array2.Size(), 1);
+    EXPECT_EQ(array2[0], 1);
+    EXPECT_TRUE(array1.IsEmpty());
+}
+
+TEST(VirtualArrayTests, HugePages)
+{
+    VirtualArray<Uint8> array(64 * 1024 * 1024, true);
+
+    EXPECT_EQ(reinterpret_cast<Uintptr>(array.Data()) % VirtualMemory::GetHugePageSize(), 0);
+
+    array.PushBack(1);
+    EXPECT_EQ(array.Capacity() % VirtualMemory::GetHugePageSize(), 0);
+    EXPECT_EQ(array[0], 1);
+}
+
+TEST(VirtualArrayTests, RangeBasedFor)
+{
+    VirtualArray<int> array(16);
+    for (int i = 0; i < 16; ++i)
+        array.PushBack(i);
+
+    int expected = 0;
+    for (int value : array)
+        EXPECT_EQ(value, expected++);
+
+    EXPECT_EQ(expected, 16);
+}
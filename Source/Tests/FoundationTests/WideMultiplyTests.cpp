@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "Foundation/Maths/WideMultiply.h"
+
+using namespace Kitsune;
+
+namespace
+{
+    constexpr Uint64 s_Max = ~Uint64(0);
+
+    void ExpectProduct(Product128 product, Uint64 high, Uint64 low)
+    {
+        EXPECT_EQ(product.High, high);
+        EXPECT_EQ(product.Low, low);
+    }
+}
+
+TEST(WideMultiplyTests, Small)
+{
+    ExpectProduct(MultiplyWide(0, s_Max), 0, 0);
+    ExpectProduct(MultiplyWide(6, 7), 0, 42);
+    ExpectProduct(MultiplyWide(Uint64(1) << 32, Uint64(1) << 32), 1, 0);
+}
+
+TEST(WideMultiplyTests, Large)
+{
+    ExpectProduct(MultiplyWide(s_Max, s_Max), s_Max - 1, 1);
+    ExpectProduct(MultiplyWide(s_Max, 2), 1, s_Max - 1);
+    ExpectProduct(MultiplyWide(0x0123'4567'89AB'CDEF, 0xFEDC'BA98'7654'3210),
+                  0x0121'FA00'AD77'D742, 0x2236'D88F'E561'8CF0);
+}
+
+TEST(WideMultiplyTests, PortableMatches)
+{
+    Uint64 values[] = { 0, 1, 0xFFFF'FFFF, Uint64(1) << 32, 0x8000'0000'0000'0000,
+                        0x0123'4567'89AB'CDEF, 0xFEDC'BA98'7654'3210, s_Max };
+
+    for (Uint64 lhs : values)
+    {
+        for (Uint64 rhs : values)
+        {
+            Product128 product = MultiplyWide(lhs, rhs);
+            ExpectProduct(MultiplyWidePortable(lhs, rhs), product.High, product.Low);
+        }
+    }
+
+    static_assert(MultiplyWidePortable(s_Max, s_Max).High == s_Max - 1);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "Foundation/Logging/WriteStreamIterator.h"
+#include "Foundation/Algorithms/Copy.h"
 
 using namespace Kitsune;
 
@@ -12,12 +13,15 @@ namespace
         {
             std::vector<int> put(x, x + size);
             Output.insert(Output.end(), put.begin(), put.end());
+
+            ++WriteCount;
         }
 
         void Flush() override { /* ... */ }
 
     public:
         std::vector<int> Output;
+        int WriteCount = 0;
     };
 }
 
@@ -45,3 +49,15 @@ TEST(WriteStreamIteratorTests, Assign)
     EXPECT_EQ(stream.Output.size(), 1);
     EXPECT_EQ(stream.Output[0], 27);
 }
+
+TEST(WriteStreamIteratorTests, CopyWritesOnce)
+{
+    MyStream stream;
+    int values[] = { 1, 2, 3, 4, 5 };
+
+    KITSUNE_UNUSED(Algorithms::Copy(values, values + 5, WriteStreamIterator<int>(stream)));
+    KITSUNE_UNUSED(Algorithms::CopyN(values, 2, WriteStreamIterator<int>(stream)));
+
+    EXPECT_EQ(stream.WriteCount, 2);
+    EXPECT_EQ(stream.Output, std::vector<int>({ 1, 2, 3, 4, 5, 1, 2 }));
+}